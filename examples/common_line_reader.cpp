@@ -0,0 +1,29 @@
+/*!
+    \file common_line_reader.cpp
+    \brief Streaming line reader example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+#include "system/stream.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Count lines and characters of the standard input without reading it into memory
+    CppCommon::StdInput input;
+    CppCommon::LineReader reader(input);
+
+    size_t characters = 0;
+    std::string_view line;
+    while (reader.ReadLine(line))
+        characters += line.size();
+
+    std::cout << "Lines: " << reader.lines() << std::endl;
+    std::cout << "Characters: " << characters << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+/*!
+    \file common_record_reader.cpp
+    \brief Streaming record reader example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "common/record_reader.h"
+#include "system/stream.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Count length-prefixed records of the standard input without reading it into memory
+    CppCommon::StdInput input;
+    CppCommon::RecordReader reader(input);
+
+    uint64_t bytes = 0;
+    std::span<const uint8_t> record;
+    while (reader.ReadPrefixedRecord(record))
+        bytes += record.size();
+
+    std::cout << "Records: " << reader.records() << std::endl;
+    std::cout << "Bytes: " << bytes << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,45 @@
+/*!
+    \file filesystem_async_io.cpp
+    \brief Asynchronous file I/O engine example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_io.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    std::string header = "The quick brown fox ";
+    std::string payload = "jumps over the lazy dog";
+
+    // Create file for reading and writing
+    CppCommon::File file("example.txt");
+    file.Create(true, true);
+
+    // Create asynchronous I/O engine
+    CppCommon::AsyncIO engine;
+    std::cout << "io_uring backend: " << ((engine.backend() == CppCommon::AsyncIOBackend::URING) ? "yes" : "no") << std::endl;
+
+    // Prepare a batch of positional writes
+    engine.Write(file, header.data(), header.size(), 0, [](int64_t result) { std::cout << "Header written: " << result << std::endl; });
+    engine.Write(file, payload.data(), payload.size(), header.size(), [](int64_t result) { std::cout << "Payload written: " << result << std::endl; });
+
+    // Submit the batch and wait for all completions
+    engine.Drain();
+
+    // Read the file content asynchronously
+    std::string text(header.size() + payload.size(), 0);
+    auto result = engine.Read(file, text.data(), text.size(), 0);
+    engine.Wait();
+    std::cout << "Bytes read: " << result.get() << std::endl;
+    std::cout << "File content: " << text << std::endl;
+
+    // Close and remove file
+    file.Close();
+    CppCommon::File::Remove(file);
+
+    return 0;
+}
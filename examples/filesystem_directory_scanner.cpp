@@ -0,0 +1,35 @@
+/*!
+    \file filesystem_directory_scanner.cpp
+    \brief Filesystem directory scanner example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_scanner.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    CppCommon::Path root = (argc > 1) ? CppCommon::Path(argv[1]) : CppCommon::Path(".");
+
+    // Count all files and their total size with the parallel scan
+    std::atomic<uint64_t> files(0);
+    std::atomic<uint64_t> size(0);
+    CppCommon::DirectoryScanner::Scan(root, [&](const CppCommon::DirectoryEntry& entry)
+    {
+        if (entry.type == CppCommon::FileType::REGULAR)
+        {
+            ++files;
+            size += entry.size;
+        }
+    }, true, true, std::thread::hardware_concurrency());
+
+    std::cout << "Files: " << files << std::endl;
+    std::cout << "Size: " << size << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,46 @@
+/*!
+    \file filesystem_journal_writer.cpp
+    \brief Group commit journal writer example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/journal_writer.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Create the journal
+    CppCommon::JournalWriter journal("example.journal");
+
+    // Append records from several threads
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&journal, i]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                std::string record = "thread " + std::to_string(i) + " record " + std::to_string(j) + "\n";
+                journal.Append(record.data(), record.size());
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::cout << "Durable records: " << journal.records() << std::endl;
+    std::cout << "Group commits: " << journal.commits() << std::endl;
+    std::cout << "Journal size: " << journal.size() << std::endl;
+
+    // Close and remove the journal
+    journal.Close();
+    CppCommon::File::Remove("example.journal");
+
+    return 0;
+}
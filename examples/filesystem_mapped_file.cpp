@@ -0,0 +1,50 @@
+/*!
+    \file filesystem_mapped_file.cpp
+    \brief Filesystem memory-mapped file example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
+
+#include <cstring>
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    std::string text = "The quick brown fox jumps over the lazy dog";
+
+    // Create a file with some content
+    CppCommon::File::WriteAllText("example.txt", text);
+
+    // Map the whole file for writing
+    CppCommon::MappedFile file("example.txt");
+    file.Map(true);
+
+    // Modify the mapped content in place
+    std::memcpy(file.data() + 4, "QUICK", 5);
+
+    // Grow the file and append some content
+    file.Resize(file.size() + 8);
+    file.Seek(text.size());
+    file.Write(" and cat");
+
+    // Flush the modified pages and unmap the file
+    file.Flush();
+    file.Unmap();
+
+    std::cout << "File content: " << CppCommon::File::ReadAllText("example.txt") << std::endl;
+
+    // Map a window of the file for sequential reading
+    file.Map(false, 4, 5);
+    file.Advise(CppCommon::MappedFileAdvice::SEQUENTIAL);
+    std::cout << "Window content: " << file.ReadAllText() << std::endl;
+    file.Unmap();
+
+    // Remove file
+    CppCommon::File::Remove("example.txt");
+
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*!
+    \file memory_shared.cpp
+    \brief Shared memory allocator example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "containers/hashmap.h"
+#include "memory/allocator_shared.h"
+#include "system/shared_memory.h"
+
+#include <iostream>
+
+typedef CppCommon::SharedAllocator<std::pair<int, int>> SharedPairAllocator;
+typedef CppCommon::HashMap<int, int, std::hash<int>, std::equal_to<int>, SharedPairAllocator> SharedHashMap;
+
+int main(int argc, char** argv)
+{
+    // Create or open a shared memory buffer
+    CppCommon::SharedMemory buffer("shared_allocator_example", 1024 * 1024);
+
+    // Create or attach the shared memory manager with the hash map as its root object
+    CppCommon::SharedMemoryManager* manager;
+    SharedHashMap* hashmap;
+    if (buffer.owner())
+    {
+        manager = CppCommon::SharedMemoryManager::Create(buffer.ptr(), buffer.size());
+        hashmap = new(manager->malloc(sizeof(SharedHashMap))) SharedHashMap(128, 0, std::hash<int>(), std::equal_to<int>(), SharedPairAllocator(*manager));
+        manager->SetRoot(hashmap);
+        std::cout << "Shared hash map created!" << std::endl;
+    }
+    else
+    {
+        manager = CppCommon::SharedMemoryManager::Attach(buffer.ptr());
+        if (manager == nullptr)
+        {
+            std::cerr << "Shared memory manager is not created!" << std::endl;
+            return -1;
+        }
+        hashmap = (SharedHashMap*)manager->root();
+        std::cout << "Shared hash map opened! Size = " << hashmap->size() << std::endl;
+    }
+
+    // Show help message
+    std::cout << "Please enter a number to increment its counter in the shared hash map (several processes support). Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        int key = std::atoi(line.c_str());
+        if (key == 0)
+            break;
+
+        // Increment the counter of the given key
+        auto result = hashmap->emplace(key, 0);
+        int counter = ++result.first->second;
+
+        // Show the counter value
+        std::cout << "Counter of " << key << " = " << counter << std::endl;
+    }
+
+    return 0;
+}
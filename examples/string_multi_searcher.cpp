@@ -0,0 +1,23 @@
+/*!
+    \file string_multi_searcher.cpp
+    \brief Multiple substrings searcher example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/multi_searcher.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Compile patterns once and search all of them in a single pass
+    CppCommon::MultiSearcher searcher({ "content-length", "transfer-encoding", "connection" }, true);
+
+    std::string request = "POST / HTTP/1.1\r\nConnection: close\r\nContent-Length: 5\r\n\r\nHello";
+    for (const auto& match : searcher.FindAll(request))
+        std::cout << "Found '" << searcher.pattern(match.pattern) << "' at position " << match.position << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*!
+    \file string_pattern_set.cpp
+    \brief Compiled pattern set example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/pattern_set.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Compile patterns once and match them many times
+    CppCommon::PatternSet patterns("!.*\\.tmp;.*\\.(log|txt)");
+
+    for (auto name : { "server.log", "notes.txt", "server.log.tmp", "image.png" })
+        std::cout << name << " -> " << (patterns.Match(name) ? "matched" : "not matched") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,27 @@
+/*!
+    \file string_tokenizer.cpp
+    \brief String tokenizer example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/string_utils.h"
+#include "string/tokenizer.h"
+
+#include <iostream>
+
+int main(int argc, char** argv)
+{
+    // Tokens are string views into the source string without any allocation
+    std::string_view csv = "id,name,,price";
+    for (auto token : CppCommon::StringTokenizer(csv, ',', true))
+        std::cout << "Token: " << token << std::endl;
+
+    // Split by any delimiter and join the result into the reusable buffer
+    std::string result;
+    CppCommon::StringUtils::Join(result, CppCommon::StringUtils::TokenizeByAny("a b;c\td", " ;\t"), "|");
+    std::cout << "Joined: " << result << std::endl;
+
+    return 0;
+}
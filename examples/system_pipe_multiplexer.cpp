@@ -0,0 +1,53 @@
+/*!
+    \file system_pipe_multiplexer.cpp
+    \brief Pipe multiplexer example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "system/pipe_multiplexer.h"
+#include "system/process.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: system_pipe_multiplexer <command> [<command>...]" << std::endl;
+        return -1;
+    }
+
+    std::vector<std::unique_ptr<CppCommon::Pipe>> outputs;
+    std::vector<CppCommon::Process> children;
+    CppCommon::PipeMultiplexer multiplexer;
+
+    // Execute child processes and register their output pipes
+    for (int i = 1; i < argc; ++i)
+    {
+        outputs.emplace_back(std::make_unique<CppCommon::Pipe>(1024 * 1024));
+        children.emplace_back(CppCommon::Process::Execute(argv[i], nullptr, nullptr, nullptr, nullptr, outputs.back().get(), nullptr));
+        multiplexer.Add(*outputs.back(), [i](CppCommon::Pipe&, const void* buffer, size_t size)
+        {
+            if (size > 0)
+                std::cout << "[" << i << "] " << std::string((const char*)buffer, size);
+            else
+                std::cout << "[" << i << "] <end of output>" << std::endl;
+        });
+    }
+
+    // Drain child processes output from the current thread
+    size_t total = multiplexer.Drain();
+
+    // Wait for child processes
+    for (auto& child : children)
+        child.Wait();
+
+    std::cout << "Total output size: " << total << std::endl;
+
+    return 0;
+}
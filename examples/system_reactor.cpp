@@ -0,0 +1,61 @@
+/*!
+    \file system_reactor.cpp
+    \brief Event loop reactor example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "system/reactor.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "Usage: system_reactor <command> [<command>...]" << std::endl;
+        return -1;
+    }
+
+    CppCommon::Reactor reactor;
+
+    std::vector<std::unique_ptr<CppCommon::Pipe>> outputs;
+    std::vector<std::unique_ptr<CppCommon::Process>> children;
+    size_t running = argc - 1;
+
+    // Execute child processes and watch their output pipes and exits
+    for (int i = 1; i < argc; ++i)
+    {
+        outputs.emplace_back(std::make_unique<CppCommon::Pipe>());
+        children.emplace_back(std::make_unique<CppCommon::Process>(CppCommon::Process::Execute(argv[i], nullptr, nullptr, nullptr, nullptr, outputs.back().get(), nullptr)));
+        reactor.AddPipe(*outputs.back(), [i](CppCommon::Pipe&, const void* buffer, size_t size)
+        {
+            if (size > 0)
+                std::cout << "[" << i << "] " << std::string((const char*)buffer, size);
+        });
+        reactor.AddProcess(*children.back(), [i, &running, &reactor](CppCommon::Process&, int result)
+        {
+            std::cout << "[" << i << "] exited with code " << result << std::endl;
+            if (--running == 0)
+                reactor.Stop();
+        });
+    }
+
+    // Report the progress periodically
+    reactor.AddTimer(CppCommon::Timespan::seconds(1), [&running]() { std::cout << "Running processes: " << running << std::endl; }, true);
+
+    // Signal the reactor event from another thread
+    CppCommon::Reactor::Token event = reactor.AddEvent([]() { std::cout << "Event signaled from another thread" << std::endl; });
+    std::thread thread([&reactor, event]() { reactor.Signal(event); });
+
+    // Dispatch all sources from the current thread
+    reactor.Run();
+    thread.join();
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*!
+    \file threads_async_writer.cpp
+    \brief Asynchronous buffered writer example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/file.h"
+#include "threads/async_writer.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    // Create the log file and the asynchronous writer over it
+    CppCommon::File file("example.log");
+    file.Create(false, true);
+    CppCommon::AsyncWriter writer(file);
+
+    // Write log lines from several threads without waiting for the disk
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&writer, i]()
+        {
+            for (int j = 0; j < 1000; ++j)
+                writer.Write("thread " + std::to_string(i) + " line " + std::to_string(j) + "\n");
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // Wait until all lines are written into the file
+    writer.Flush();
+
+    std::cout << "Written bytes: " << writer.written() << std::endl;
+    std::cout << "Coalesced writes: " << writer.writes() << std::endl;
+
+    // Close the writer and remove the log file
+    writer.Close();
+    file.Close();
+    CppCommon::File::Remove("example.log");
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*!
+    \file threads_shared_ring_buffer.cpp
+    \brief Process-shared ring buffer and queue example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_mpsc_ring_queue.h"
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+struct Message
+{
+    char text[64];
+};
+
+int main(int argc, char** argv)
+{
+    // Run the example with any argument to start the consumer process
+    if (argc > 1)
+    {
+        CppCommon::SharedMPSCRingQueue<Message> queue("shared_ring_queue_example", 1024, 8, CppCommon::SharedRingRole::CONSUMER);
+        std::cout << "Consumer attached! Waiting for messages. Send 'exit' to stop..." << std::endl;
+
+        for (;;)
+        {
+            // Sleep until any producer enqueues a message
+            queue.Wait();
+
+            Message message;
+            while (queue.Dequeue(message))
+            {
+                std::cout << "Received: " << message.text << std::endl;
+                if (std::strcmp(message.text, "exit") == 0)
+                    return 0;
+            }
+        }
+    }
+
+    CppCommon::SharedMPSCRingQueue<Message> queue("shared_ring_queue_example", 1024, 8, CppCommon::SharedRingRole::PRODUCER);
+    std::cout << "Producer attached! Please enter messages (several producer processes support). Enter '0' to exit..." << std::endl;
+
+    // Perform text input
+    std::string line;
+    while (getline(std::cin, line))
+    {
+        if (line == "0")
+            break;
+
+        Message message = {};
+        std::strncpy(message.text, line.c_str(), sizeof(message.text) - 1);
+        if (!queue.Enqueue(message))
+            std::cout << "Queue is full!" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+    \file time_clock.cpp
+    \brief Clock policies example
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "cache/memcache.h"
+#include "time/clock.h"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char** argv)
+{
+    std::cout << "Coarse clock resolution: " << CppCommon::CoarseClock::resolution().nanoseconds() << " ns" << std::endl;
+    for (int i = 0; i < 5; ++i)
+    {
+        std::cout << "UTC value: " << CppCommon::Timestamp::utc() << std::endl;
+        std::cout << "Coarse UTC value: " << CppCommon::CoarseClock::utc() << std::endl;
+        std::cout << "Coarse nano value: " << CppCommon::CoarseClock::nano() << std::endl;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << std::endl;
+
+    // Start the background thread which updates the cached clock every 100 microseconds
+    CppCommon::CachedClock::Start(CppCommon::Timespan::microseconds(100));
+
+    // Memory cache gets timestamps of its entries from the cached clock
+    CppCommon::MemCache<std::string, int, CppCommon::CachedClock> cache;
+    cache.insert("key", 123, CppCommon::Timespan::milliseconds(10));
+
+    CppCommon::Timestamp timeout;
+    int value;
+    if (cache.find("key", value, timeout))
+        std::cout << "Cached value " << value << " expires in " << (timeout - CppCommon::CachedClock::now()).microseconds() << " us" << std::endl;
+
+    CppCommon::CachedClock::Stop();
+
+    return 0;
+}
@@ -21,6 +21,7 @@ void show(const CppCommon::Time& time)
     std::cout << "Time.millisecond() = " << time.millisecond() << std::endl;
     std::cout << "Time.microsecond() = " << time.microsecond() << std::endl;
     std::cout << "Time.nanosecond() = " << time.nanosecond() << std::endl;
+    std::cout << "Time.string() = " << time.string() << std::endl;
     std::cout << std::endl;
 }
 
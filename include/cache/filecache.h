@@ -12,8 +12,7 @@
 #include "filesystem/directory.h"
 #include "filesystem/file.h"
 #include "filesystem/path.h"
-#include "time/timespan.h"
-#include "time/timestamp.h"
+#include "time/clock.h"
 
 #include <functional>
 #include <map>
@@ -30,6 +29,10 @@ namespace CppCommon {
 /*!
     File cache is used to cache files in memory with optional timeouts.
 
+    Clock function is used to get timestamps of cache entries with timeouts.
+    CoarseClock::now() or CachedClock::now() functions avoid the precise
+    clock access for each cache insert operation.
+
     Thread-safe.
 */
 class FileCache
@@ -37,8 +40,14 @@ class FileCache
 public:
     //! File cache insert handler type
     typedef std::function<bool (FileCache& cache, const std::string& key, const std::string& value, const Timespan& timeout)> InsertHandler;
+    //! File cache clock function type
+    typedef Timestamp (*Clock)();
 
-    FileCache() = default;
+    //! Initialize the file cache with a given clock function
+    /*!
+        \param clock - Clock function (default is UtcClock::now)
+    */
+    explicit FileCache(Clock clock = UtcClock::now) : _clock(clock) {}
     FileCache(const FileCache&) = delete;
     FileCache(FileCache&&) = delete;
     ~FileCache() = default;
@@ -128,8 +137,13 @@ public:
     //! Clear the memory cache
     void clear();
 
+    //! Watchdog the file cache with the current timestamp of the cache clock
+    void watchdog() { watchdog(_clock()); }
     //! Watchdog the file cache
-    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+    /*!
+        \param utc - Current UTC timestamp
+    */
+    void watchdog(const Timestamp& utc);
 
     //! Swap two instances
     void swap(FileCache& cache) noexcept;
@@ -137,6 +151,7 @@ public:
 
 private:
     mutable std::shared_mutex _lock;
+    Clock _clock;
     Timestamp _timestamp;
 
     struct MemCacheEntry
@@ -9,8 +9,7 @@
 #ifndef CPPCOMMON_CACHE_MEMCACHE_H
 #define CPPCOMMON_CACHE_MEMCACHE_H
 
-#include "time/timespan.h"
-#include "time/timestamp.h"
+#include "time/clock.h"
 
 #include <mutex>
 #include <map>
@@ -23,9 +22,13 @@ namespace CppCommon {
 /*!
     Memory cache is used to cache data in memory with optional timeouts.
 
+    Clock policy is used to get timestamps of cache entries with timeouts.
+    CoarseClock or CachedClock policies avoid the precise clock access
+    for each cache insert operation.
+
     Thread-safe.
 */
-template <typename TKey, typename TValue>
+template <typename TKey, typename TValue, class TClock = UtcClock>
 class MemCache
 {
 public:
@@ -97,12 +100,12 @@ public:
     void clear();
 
     //! Watchdog the memory cache
-    void watchdog(const UtcTimestamp& utc = UtcTimestamp());
+    void watchdog(const Timestamp& utc = TClock::now());
 
     //! Swap two instances
     void swap(MemCache& cache) noexcept;
-    template <typename UKey, typename UValue>
-    friend void swap(MemCache<UKey, UValue>& cache1, MemCache<UKey, UValue>& cache2) noexcept;
+    template <typename UKey, typename UValue, class UClock>
+    friend void swap(MemCache<UKey, UValue, UClock>& cache1, MemCache<UKey, UValue, UClock>& cache2) noexcept;
 
 private:
     mutable std::shared_mutex _lock;
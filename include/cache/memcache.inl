@@ -8,22 +8,22 @@
 
 namespace CppCommon {
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::empty() const
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::empty() const
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
     return _entries_by_key.empty();
 }
 
-template <typename TKey, typename TValue>
-inline size_t MemCache<TKey, TValue>::size() const
+template <typename TKey, typename TValue, class TClock>
+inline size_t MemCache<TKey, TValue, TClock>::size() const
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
     return _entries_by_key.size();
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::emplace(TKey&& key, TValue&& value, const Timespan& timeout)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
@@ -33,7 +33,7 @@ inline bool MemCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Ti
     // Update the cache entry
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
+        Timestamp current = TClock::now();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
         _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
         _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
@@ -44,8 +44,8 @@ inline bool MemCache<TKey, TValue>::emplace(TKey&& key, TValue&& value, const Ti
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::insert(const TKey& key, const TValue& value, const Timespan& timeout)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
@@ -55,7 +55,7 @@ inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value,
     // Update the cache entry
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
+        Timestamp current = TClock::now();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
         _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
         _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
@@ -66,8 +66,8 @@ inline bool MemCache<TKey, TValue>::insert(const TKey& key, const TValue& value,
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::find(const TKey& key)
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
 
@@ -79,8 +79,8 @@ inline bool MemCache<TKey, TValue>::find(const TKey& key)
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::find(const TKey& key, TValue& value)
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
 
@@ -93,8 +93,8 @@ inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value)
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value, Timestamp& timeout)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::find(const TKey& key, TValue& value, Timestamp& timeout)
 {
     std::shared_lock<std::shared_mutex> locker(_lock);
 
@@ -108,16 +108,16 @@ inline bool MemCache<TKey, TValue>::find(const TKey& key, TValue& value, Timesta
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove(const TKey& key)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::remove(const TKey& key)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
     return remove_internal(key);
 }
 
-template <typename TKey, typename TValue>
-inline bool MemCache<TKey, TValue>::remove_internal(const TKey& key)
+template <typename TKey, typename TValue, class TClock>
+inline bool MemCache<TKey, TValue, TClock>::remove_internal(const TKey& key)
 {
     // Try to find the given key
     auto it = _entries_by_key.find(key);
@@ -134,8 +134,8 @@ inline bool MemCache<TKey, TValue>::remove_internal(const TKey& key)
     return true;
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::clear()
+template <typename TKey, typename TValue, class TClock>
+inline void MemCache<TKey, TValue, TClock>::clear()
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
@@ -144,8 +144,8 @@ inline void MemCache<TKey, TValue>::clear()
     _entries_by_timestamp.clear();
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
+template <typename TKey, typename TValue, class TClock>
+inline void MemCache<TKey, TValue, TClock>::watchdog(const Timestamp& utc)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
@@ -168,8 +168,8 @@ inline void MemCache<TKey, TValue>::watchdog(const UtcTimestamp& utc)
     }
 }
 
-template <typename TKey, typename TValue>
-inline void MemCache<TKey, TValue>::swap(MemCache& cache) noexcept
+template <typename TKey, typename TValue, class TClock>
+inline void MemCache<TKey, TValue, TClock>::swap(MemCache& cache) noexcept
 {
     std::unique_lock<std::shared_mutex> locker1(_lock);
     std::unique_lock<std::shared_mutex> locker2(cache._lock);
@@ -180,8 +180,8 @@ inline void MemCache<TKey, TValue>::swap(MemCache& cache) noexcept
     swap(_entries_by_timestamp, cache._entries_by_timestamp);
 }
 
-template <typename TKey, typename TValue>
-inline void swap(MemCache<TKey, TValue>& cache1, MemCache<TKey, TValue>& cache2) noexcept
+template <typename TKey, typename TValue, class TClock>
+inline void swap(MemCache<TKey, TValue, TClock>& cache1, MemCache<TKey, TValue, TClock>& cache2) noexcept
 {
     cache1.swap(cache2);
 }
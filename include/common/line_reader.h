@@ -0,0 +1,77 @@
+/*!
+    \file line_reader.h
+    \brief Streaming line reader definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_LINE_READER_H
+#define CPPCOMMON_LINE_READER_H
+
+#include "common/reader.h"
+
+#include <string_view>
+
+namespace CppCommon {
+
+//! Streaming line reader
+/*!
+    Line reader reads text lines from any reader (file, pipe, standard input)
+    through the reusable internal buffer without materializing the whole
+    stream. Each line is returned as a string view into the internal buffer,
+    which is valid until the next read. Delimiter is searched with memchr()
+    which is vectorized by the C runtime.
+
+    Empty lines are preserved. Trailing '\r' of the line is removed if the
+    delimiter is '\n'. The last line without the trailing delimiter is also
+    returned. The internal buffer grows if some line does not fit into it.
+
+    Not thread-safe.
+*/
+class LineReader
+{
+public:
+    //! Default line reader buffer size (65536)
+    static const size_t DEFAULT_BUFFER;
+
+    //! Initialize line reader over the given reader
+    /*!
+        \param reader - Source reader
+        \param buffer - Initial buffer size (default is LineReader::DEFAULT_BUFFER)
+        \param delimiter - Line delimiter (default is '\n')
+    */
+    explicit LineReader(Reader& reader, size_t buffer = LineReader::DEFAULT_BUFFER, char delimiter = '\n');
+    LineReader(const LineReader&) = delete;
+    LineReader(LineReader&&) = delete;
+    ~LineReader() = default;
+
+    LineReader& operator=(const LineReader&) = delete;
+    LineReader& operator=(LineReader&&) = delete;
+
+    //! Get the count of read lines
+    uint64_t lines() const noexcept { return _lines; }
+
+    //! Read the next line
+    /*!
+        \param line - Line view which is valid until the next read
+        \return 'true' if the line was read, 'false' if the end of the stream was met
+    */
+    bool ReadLine(std::string_view& line);
+
+private:
+    Reader& _reader;
+    char _delimiter;
+    std::vector<char> _buffer;
+    size_t _begin;
+    size_t _end;
+    size_t _scan;
+    bool _eof;
+    uint64_t _lines;
+};
+
+/*! \example common_line_reader.cpp Streaming line reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_LINE_READER_H
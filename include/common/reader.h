@@ -10,11 +10,19 @@
 #define CPPCOMMON_READER_H
 
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace CppCommon {
 
+//! Read buffer (scatter vector element)
+struct IOBuffer
+{
+    void* data;         //!< Buffer data
+    size_t size;        //!< Buffer size
+};
+
 //! Reader interface
 /*!
     Reader interface is based on a read byte buffer method and provides
@@ -39,6 +47,17 @@ public:
     */
     virtual size_t Read(void* buffer, size_t size) = 0;
 
+    //! Read into multiple buffers (scatter read)
+    /*!
+        Buffers are filled in order. Reading stops when less bytes than
+        requested were read into the current buffer. Default implementation
+        calls Read() for each buffer.
+
+        \param buffers - Buffers to read
+        \return Total count of read bytes
+    */
+    virtual size_t ReadV(std::span<const IOBuffer> buffers);
+
     //! Read all bytes
     /*!
         \return Bytes buffer
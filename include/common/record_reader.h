@@ -0,0 +1,91 @@
+/*!
+    \file record_reader.h
+    \brief Streaming record reader definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_RECORD_READER_H
+#define CPPCOMMON_RECORD_READER_H
+
+#include "common/reader.h"
+
+namespace CppCommon {
+
+//! Streaming record reader
+/*!
+    Record reader reads binary records from any reader (file, pipe, standard
+    input) through the reusable internal buffer without materializing the
+    whole stream. Records could be fixed-size or prefixed with a little-endian
+    length of 1, 2, 4 or 8 bytes. Each record is returned as a span into the
+    internal buffer, which is valid until the next read. The internal buffer
+    grows if some record does not fit into it, but never above the maximal
+    record size, so a corrupted or hostile length prefix could not exhaust
+    the memory.
+
+    If the stream ends in the middle of a record or the record is greater
+    than the maximal record size the reader will raise a runtime exception!
+
+    Not thread-safe.
+*/
+class RecordReader
+{
+public:
+    //! Default record reader buffer size (65536)
+    static const size_t DEFAULT_BUFFER;
+    //! Default maximal record size (16777216)
+    static const size_t DEFAULT_MAX_RECORD;
+
+    //! Initialize record reader over the given reader
+    /*!
+        \param reader - Source reader
+        \param buffer - Initial buffer size (default is RecordReader::DEFAULT_BUFFER)
+        \param max_record - Maximal record size including the length prefix (default is RecordReader::DEFAULT_MAX_RECORD)
+    */
+    explicit RecordReader(Reader& reader, size_t buffer = RecordReader::DEFAULT_BUFFER, size_t max_record = RecordReader::DEFAULT_MAX_RECORD);
+    RecordReader(const RecordReader&) = delete;
+    RecordReader(RecordReader&&) = delete;
+    ~RecordReader() = default;
+
+    RecordReader& operator=(const RecordReader&) = delete;
+    RecordReader& operator=(RecordReader&&) = delete;
+
+    //! Get the count of read records
+    uint64_t records() const noexcept { return _records; }
+    //! Get the maximal record size
+    size_t max_record() const noexcept { return _max_record; }
+
+    //! Read the next fixed-size record
+    /*!
+        \param size - Record size
+        \param record - Record span which is valid until the next read
+        \return 'true' if the record was read, 'false' if the end of the stream was met
+    */
+    bool ReadRecord(size_t size, std::span<const uint8_t>& record);
+    //! Read the next length-prefixed record
+    /*!
+        \param record - Record span (without the length prefix) which is valid until the next read
+        \param prefix - Little-endian length prefix size: 1, 2, 4 or 8 bytes (default is 4)
+        \return 'true' if the record was read, 'false' if the end of the stream was met
+    */
+    bool ReadPrefixedRecord(std::span<const uint8_t>& record, size_t prefix = 4);
+
+private:
+    Reader& _reader;
+    std::vector<uint8_t> _buffer;
+    size_t _max_record;
+    size_t _begin;
+    size_t _end;
+    bool _eof;
+    uint64_t _records;
+
+    // Fill the buffer to have at least the given count of available bytes
+    bool Fill(size_t size);
+};
+
+/*! \example common_record_reader.cpp Streaming record reader example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_RECORD_READER_H
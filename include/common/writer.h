@@ -9,11 +9,19 @@
 #ifndef CPPCOMMON_WRITER_H
 #define CPPCOMMON_WRITER_H
 
+#include <span>
 #include <string>
 #include <vector>
 
 namespace CppCommon {
 
+//! Write buffer (gather vector element)
+struct ConstIOBuffer
+{
+    const void* data;   //!< Buffer data
+    size_t size;        //!< Buffer size
+};
+
 //! Writer interface
 /*!
     Writer interface is based on a write byte buffer method and provides
@@ -38,6 +46,17 @@ public:
     */
     virtual size_t Write(const void* buffer, size_t size) = 0;
 
+    //! Write multiple buffers (gather write)
+    /*!
+        Buffers are written in order. Writing stops when less bytes than
+        requested were written from the current buffer. Default implementation
+        calls Write() for each buffer.
+
+        \param buffers - Buffers to write
+        \return Total count of written bytes
+    */
+    virtual size_t WriteV(std::span<const ConstIOBuffer> buffers);
+
     //! Write a text string
     /*!
         \param text - Text string
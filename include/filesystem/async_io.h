@@ -0,0 +1,215 @@
+/*!
+    \file async_io.h
+    \brief Asynchronous file I/O engine definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_ASYNC_IO_H
+#define CPPCOMMON_FILESYSTEM_ASYNC_IO_H
+
+#include "filesystem/file.h"
+
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Asynchronous I/O backend
+enum class AsyncIOBackend
+{
+    AUTO,               //!< Select io_uring if it is available, otherwise use thread pool
+    URING,              //!< Linux io_uring
+    THREADS             //!< Thread pool with synchronous positional I/O
+};
+
+//! Asynchronous I/O engine
+/*!
+    Asynchronous I/O engine performs positional file reads, writes and
+    synchronizations without blocking the caller thread. Operations are
+    prepared with Read(), Write() and Sync() methods and batched until
+    Submit() is called. Completions are processed with Poll() or Wait()
+    methods which invoke completion handlers in the caller thread.
+
+    Completion handler receives a count of transferred bytes or a negative
+    system error code.
+
+    On Linux io_uring backend is used when it is available. Registered
+    buffers and files are used automatically by the io_uring backend for
+    all operations which target them. On other platforms or if io_uring is
+    not available the thread pool backend is used.
+
+    Operations are issued on the native file handle. So read and write
+    operations on the file opened for direct I/O (see File::IsFileDirect())
+    must use buffers, sizes and offsets aligned to File::DIRECT_ALIGNMENT.
+
+    Count of in-flight operations is limited by the engine queue depth.
+    Preparing a new operation when the queue is full will submit all
+    prepared operations and wait for at least one completion.
+
+    Not thread-safe.
+*/
+class AsyncIO
+{
+public:
+    //! Completion handler
+    typedef std::function<void(int64_t)> Handler;
+
+    //! Default queue depth (128)
+    static const size_t DEFAULT_DEPTH;
+    //! Default count of worker threads for the thread pool backend (4)
+    static const size_t DEFAULT_THREADS;
+
+    //! Initialize asynchronous I/O engine
+    /*!
+        If the required backend is not available the method will raise
+        a system exception!
+
+        \param depth - Queue depth (default is AsyncIO::DEFAULT_DEPTH)
+        \param backend - Asynchronous I/O backend (default is AsyncIOBackend::AUTO)
+        \param threads - Count of worker threads for the thread pool backend (default is AsyncIO::DEFAULT_THREADS)
+    */
+    explicit AsyncIO(size_t depth = DEFAULT_DEPTH, AsyncIOBackend backend = AsyncIOBackend::AUTO, size_t threads = DEFAULT_THREADS);
+    AsyncIO(const AsyncIO&) = delete;
+    AsyncIO(AsyncIO&&) = delete;
+    ~AsyncIO();
+
+    AsyncIO& operator=(const AsyncIO&) = delete;
+    AsyncIO& operator=(AsyncIO&&) = delete;
+
+    //! Get the selected backend
+    AsyncIOBackend backend() const noexcept;
+    //! Get the queue depth
+    size_t depth() const noexcept;
+    //! Get the count of in-flight (prepared or submitted, but not completed) operations
+    size_t pending() const noexcept;
+
+    //! Is io_uring backend available on the current system?
+    static bool IsUringAvailable();
+
+    //! Register buffers for zero-copy operations
+    /*!
+        Any operation with the buffer range inside one of the registered
+        buffers will use the fixed buffer. Previously registered buffers
+        will be unregistered. Does nothing for the thread pool backend.
+
+        \param buffers - Registered buffers (pointer and size pairs)
+    */
+    void RegisterBuffers(const std::vector<std::pair<void*, size_t>>& buffers);
+    //! Unregister all registered buffers
+    void UnregisterBuffers();
+
+    //! Register files to avoid file descriptor lookup for each operation
+    /*!
+        Any operation with one of the registered files will use the fixed
+        file index. Previously registered files will be unregistered.
+        Does nothing for the thread pool backend.
+
+        \param files - Registered files (must be opened)
+    */
+    void RegisterFiles(const std::vector<const File*>& files);
+    //! Unregister all registered files
+    void UnregisterFiles();
+
+    //! Prepare asynchronous positional read operation
+    /*!
+        If the file is opened for direct I/O and the buffer, size or offset
+        is not aligned to File::DIRECT_ALIGNMENT the method will raise
+        a filesystem exception!
+
+        \param file - File opened for reading
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param offset - File offset
+        \param handler - Completion handler
+    */
+    void Read(const File& file, void* buffer, size_t size, uint64_t offset, const Handler& handler);
+    //! Prepare asynchronous positional read operation with the future result
+    /*!
+        The future becomes ready when the operation completion is processed
+        with Poll() or Wait() methods.
+
+        If the file is opened for direct I/O and the buffer, size or offset
+        is not aligned to File::DIRECT_ALIGNMENT the method will raise
+        a filesystem exception!
+
+        \param file - File opened for reading
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param offset - File offset
+        \return Future of the count of read bytes or a negative system error code
+    */
+    std::future<int64_t> Read(const File& file, void* buffer, size_t size, uint64_t offset);
+
+    //! Prepare asynchronous positional write operation
+    /*!
+        Operation bypasses the file internal write buffer.
+
+        If the file is opened for direct I/O and the buffer, size or offset
+        is not aligned to File::DIRECT_ALIGNMENT the method will raise
+        a filesystem exception!
+
+        \param file - File opened for writing
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param offset - File offset
+        \param handler - Completion handler
+    */
+    void Write(const File& file, const void* buffer, size_t size, uint64_t offset, const Handler& handler);
+    //! Prepare asynchronous positional write operation with the future result
+    /*!
+        The future becomes ready when the operation completion is processed
+        with Poll() or Wait() methods.
+
+        If the file is opened for direct I/O and the buffer, size or offset
+        is not aligned to File::DIRECT_ALIGNMENT the method will raise
+        a filesystem exception!
+
+        \param file - File opened for writing
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param offset - File offset
+        \return Future of the count of written bytes or a negative system error code
+    */
+    std::future<int64_t> Write(const File& file, const void* buffer, size_t size, uint64_t offset);
+
+    //! Prepare asynchronous file synchronization operation
+    /*!
+        \param file - File opened for writing
+        \param handler - Completion handler
+    */
+    void Sync(const File& file, const Handler& handler);
+
+    //! Submit all prepared operations
+    /*!
+        \return Count of submitted operations
+    */
+    size_t Submit();
+
+    //! Process all available completions without waiting
+    /*!
+        \return Count of processed completions
+    */
+    size_t Poll();
+    //! Submit all prepared operations and wait for the given count of completions
+    /*!
+        \param count - Count of completions to wait (default is 1)
+        \return Count of processed completions
+    */
+    size_t Wait(size_t count = 1);
+    //! Submit all prepared operations and wait for all of them to complete
+    void Drain();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+/*! \example filesystem_async_io.cpp Asynchronous file I/O engine example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_ASYNC_IO_H
@@ -12,6 +12,7 @@
 #include "filesystem/directory_iterator.h"
 #include "filesystem/file.h"
 #include "filesystem/symlink.h"
+#include "string/pattern_set.h"
 
 namespace CppCommon {
 
@@ -65,55 +66,143 @@ public:
 
     //! Get all entries (directories, files, symbolic links) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Entries collection
     */
     std::vector<Path> GetEntries(const std::string& pattern = "");
+    //! Get all entries (directories, files, symbolic links) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Entries collection
+    */
+    std::vector<Path> GetEntries(const PatternSet& patterns);
     //! Recursively get all entries (directories, files, symbolic links) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Entries collection
     */
     std::vector<Path> GetEntriesRecursive(const std::string& pattern = "");
+    //! Recursively get all entries (directories, files, symbolic links) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Entries collection
+    */
+    std::vector<Path> GetEntriesRecursive(const PatternSet& patterns);
 
     //! Get all directories (including symbolic link directories) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Directories collection
     */
     std::vector<Directory> GetDirectories(const std::string& pattern = "");
+    //! Get all directories (including symbolic link directories) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Directories collection
+    */
+    std::vector<Directory> GetDirectories(const PatternSet& patterns);
     //! Recursively get all directories (including symbolic link directories) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Directories collection
     */
     std::vector<Directory> GetDirectoriesRecursive(const std::string& pattern = "");
+    //! Recursively get all directories (including symbolic link directories) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Directories collection
+    */
+    std::vector<Directory> GetDirectoriesRecursive(const PatternSet& patterns);
 
     //! Get all files (including symbolic link files) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Files collection
     */
     std::vector<File> GetFiles(const std::string& pattern = "");
+    //! Get all files (including symbolic link files) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Files collection
+    */
+    std::vector<File> GetFiles(const PatternSet& patterns);
     //! Recursively get all files (including symbolic link files) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Files collection
     */
     std::vector<File> GetFilesRecursive(const std::string& pattern = "");
+    //! Recursively get all files (including symbolic link files) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Files collection
+    */
+    std::vector<File> GetFilesRecursive(const PatternSet& patterns);
 
     //! Get all symbolic links (including symbolic link directories) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Symbolic links collection
     */
     std::vector<Symlink> GetSymlinks(const std::string& pattern = "");
+    //! Get all symbolic links (including symbolic link directories) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Symbolic links collection
+    */
+    std::vector<Symlink> GetSymlinks(const PatternSet& patterns);
     //! Recursively get all symbolic links (including symbolic link directories) in the current directory
     /*!
+        If the regular expression pattern is invalid the method will raise
+        an argument exception!
+
         \param pattern - Regular expression pattern (default is "")
         \return Symbolic links collection
     */
     std::vector<Symlink> GetSymlinksRecursive(const std::string& pattern = "");
+    //! Recursively get all symbolic links (including symbolic link directories) in the current directory matched to the given pattern set
+    /*!
+        Empty pattern set matches all entries.
+
+        \param patterns - Compiled pattern set
+        \return Symbolic links collection
+    */
+    std::vector<Symlink> GetSymlinksRecursive(const PatternSet& patterns);
 
     //! Create directory from the given path
     /*!
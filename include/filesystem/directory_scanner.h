@@ -0,0 +1,94 @@
+/*!
+    \file directory_scanner.h
+    \brief Filesystem directory scanner definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_DIRECTORY_SCANNER_H
+#define CPPCOMMON_FILESYSTEM_DIRECTORY_SCANNER_H
+
+#include "filesystem/path.h"
+
+#include <functional>
+#include <vector>
+
+namespace CppCommon {
+
+//! Filesystem directory scanner entry
+/*!
+    Plain directory entry which is filled from the directory stream without
+    any additional system calls. Size and modified timestamp are available
+    only if the scanner was asked to get the entry status.
+*/
+struct DirectoryEntry
+{
+    Path path;          //!< Entry path
+    FileType type;      //!< Entry type (symbolic links are not followed)
+    uint64_t inode;     //!< Entry inode number (0 on Windows)
+    uint64_t size;      //!< Entry size in bytes (status only)
+    uint64_t modified;  //!< Entry modified UTC timestamp in nanoseconds (status only)
+
+    DirectoryEntry() : type(FileType::NONE), inode(0), size(0), modified(0) {}
+};
+
+//! Filesystem directory scanner
+/*!
+    Filesystem directory scanner is a lightweight alternative to the directory
+    iterator for indexing large directory trees. Directory entries are read in
+    large batches (getdents64 on Linux, FindFirstFileEx with large fetch on
+    Windows) and returned as plain entry structures. The entry status (statx on
+    Linux) is requested only if it is required. Subdirectories are traversed in
+    parallel if several threads are requested.
+
+    Symbolic links to directories are not followed. No sort order is guarantied!
+
+    Thread-safe.
+*/
+class DirectoryScanner
+{
+public:
+    //! Directory entry handler
+    typedef std::function<void(const DirectoryEntry&)> Handler;
+
+    DirectoryScanner() = delete;
+    DirectoryScanner(const DirectoryScanner&) = delete;
+    DirectoryScanner(DirectoryScanner&&) = delete;
+    ~DirectoryScanner() = delete;
+
+    DirectoryScanner& operator=(const DirectoryScanner&) = delete;
+    DirectoryScanner& operator=(DirectoryScanner&&) = delete;
+
+    //! Scan the given directory and call the handler for each found entry
+    /*!
+        If several threads are used the handler is called concurrently from
+        all of them, so it must be thread-safe.
+
+        If some directory cannot be read the method will raise a filesystem
+        exception!
+
+        \param directory - Directory to scan
+        \param handler - Directory entry handler
+        \param recursive - Recursive scan (default is true)
+        \param status - Get the entry status (size, modified timestamp) (default is false)
+        \param threads - Count of scanning threads (default is 1)
+    */
+    static void Scan(const Path& directory, const Handler& handler, bool recursive = true, bool status = false, size_t threads = 1);
+
+    //! Scan the given directory and collect all found entries
+    /*!
+        \param directory - Directory to scan
+        \param recursive - Recursive scan (default is true)
+        \param status - Get the entry status (size, modified timestamp) (default is false)
+        \param threads - Count of scanning threads (default is 1)
+        \return Directory entries
+    */
+    static std::vector<DirectoryEntry> ScanAll(const Path& directory, bool recursive = true, bool status = false, size_t threads = 1);
+};
+
+/*! \example filesystem_directory_scanner.cpp Filesystem directory scanner example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_DIRECTORY_SCANNER_H
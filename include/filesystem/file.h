@@ -18,10 +18,36 @@
 
 namespace CppCommon {
 
+//! File access pattern advice
+enum class FileAdvice
+{
+    NORMAL,             //!< No special treatment (default read-ahead window)
+    SEQUENTIAL,         //!< Expect sequential access (enlarged read-ahead window)
+    RANDOM,             //!< Expect random access (no read-ahead)
+    WILLNEED,           //!< Expect access of the range in the near future (start read-ahead now)
+    DONTNEED,           //!< Do not expect access of the range in the near future (drop cached pages)
+    NOREUSE             //!< Expect access of the range only once
+};
+
 //! Filesystem file
 /*!
     Filesystem file wraps file management operations (create, open, read, write, flush, close).
 
+    Internal read/write buffers are allocated lazily on the first buffered
+    I/O operation from the thread-cached buffer pool and returned into it on
+    close, so opening and closing files does not touch the heap allocator.
+    Caller supplied buffers could be set with SetBuffers().
+
+    File opened with FileAttributes::DIRECT bypasses the system page cache
+    (O_DIRECT on Linux, F_NOCACHE on MacOS). Internal buffers of the direct
+    file are aligned and sized to File::DIRECT_ALIGNMENT. Aligned operations
+    go directly to the disk, while unaligned ones (e.g. the tail of the file)
+    go through the page cache with the second descriptor of the same file
+    (Linux only). Direct I/O mode is never changed after the file is opened,
+    so positional operations of the direct file are thread-safe as well.
+    Direct I/O is silently disabled if the filesystem does not support it
+    (see IsFileDirect()).
+
     Not thread-safe.
 */
 class File : public Path, public Reader, public Writer
@@ -33,6 +59,8 @@ public:
     static const Flags<FilePermissions> DEFAULT_PERMISSIONS;
     //! Default file buffer size (8192)
     static const size_t DEFAULT_BUFFER;
+    //! Direct I/O buffer, size and offset alignment (4096)
+    static const size_t DIRECT_ALIGNMENT;
 
     //! Initialize file with an empty path
     File();
@@ -41,6 +69,11 @@ public:
         \param path - File path
     */
     File(const Path& path);
+    //! Initialize file with a given moved path
+    /*!
+        \param path - File path
+    */
+    File(Path&& path);
     File(const File& file);
     File(File&& file) noexcept;
     virtual ~File();
@@ -53,6 +86,14 @@ public:
     //! Check if the file opened
     explicit operator bool() const noexcept { return IsFileOpened(); }
 
+    //! Get the native file handler
+    void* native() const noexcept;
+
+    //! Get the current read buffer of the opened file (empty if not allocated yet)
+    std::span<const uint8_t> read_buffer() const noexcept;
+    //! Get the current write buffer of the opened file (empty if not allocated yet)
+    std::span<const uint8_t> write_buffer() const noexcept;
+
     //! Get the current read/write offset of the opened file
     uint64_t offset() const;
     //! Get the current file size
@@ -69,6 +110,8 @@ public:
     bool IsFileReadOpened() const;
     //! Is the file opened for writing?
     bool IsFileWriteOpened() const;
+    //! Is the file opened for direct I/O?
+    bool IsFileDirect() const;
 
     //! Create a new file
     /*!
@@ -134,6 +177,126 @@ public:
 
     using Writer::Write;
 
+    //! Read into multiple buffers from the opened file (scatter read)
+    /*!
+        Small requests are served through the internal read buffer. Large
+        requests consume the buffered data and then read directly into the
+        given buffers with a single readv() call.
+
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        \param buffers - Buffers to read
+        \return Total count of read bytes
+    */
+    size_t ReadV(std::span<const IOBuffer> buffers) override;
+    //! Write multiple buffers into the opened file (gather write)
+    /*!
+        Small requests are collected in the internal write buffer. Large
+        requests flush the buffered data and then are written directly from
+        the given buffers with a single writev() call.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param buffers - Buffers to write
+        \return Total count of written bytes
+    */
+    size_t WriteV(std::span<const ConstIOBuffer> buffers) override;
+
+    //! Read a bytes buffer from the given offset of the opened file
+    /*!
+        Positional read does not use the internal read buffer and does not
+        change the current file offset (except Windows), so it is safe to
+        call it from several threads concurrently.
+
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \param offset - File offset
+        \return Count of read bytes
+    */
+    size_t ReadAt(void* buffer, size_t size, uint64_t offset) const;
+    //! Read into multiple buffers from the given offset of the opened file
+    /*!
+        \param buffers - Buffers to read
+        \param offset - File offset
+        \return Total count of read bytes
+    */
+    size_t ReadAt(std::span<const IOBuffer> buffers, uint64_t offset) const;
+    //! Write a byte buffer into the given offset of the opened file
+    /*!
+        Positional write bypasses the internal write buffer and does not
+        change the current file offset (except Windows). Flush the file
+        before if there is some unwritten data in the internal buffer.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \param offset - File offset
+        \return Count of written bytes
+    */
+    size_t WriteAt(const void* buffer, size_t size, uint64_t offset);
+    //! Write multiple buffers into the given offset of the opened file
+    /*!
+        \param buffers - Buffers to write
+        \param offset - File offset
+        \return Total count of written bytes
+    */
+    size_t WriteAt(std::span<const ConstIOBuffer> buffers, uint64_t offset);
+
+    //! Copy data from the current offset of the opened file into another opened file
+    /*!
+        Data is copied in the kernel without passing through the user space
+        when possible: the whole file is cloned into the empty destination
+        file (FICLONE reflink), otherwise copy_file_range() and sendfile()
+        are used on Linux. Other platforms and unsupported filesystems fall
+        back to the user space copy. Both file offsets are advanced by the
+        count of copied bytes.
+
+        If the file is not opened for reading or the destination file is not
+        opened for writing the method will raise a filesystem exception!
+
+        \param file - Destination file
+        \param size - Size of data to copy (default is 0 which means up to the end of the file)
+        \return Count of copied bytes
+    */
+    uint64_t CopyTo(File& file, uint64_t size = 0);
+    //! Transfer data from the current offset of the opened file into the given native handle
+    /*!
+        Native handle could be any writable file descriptor (socket, pipe,
+        file, etc). Data is transferred with sendfile() on Linux and falls
+        back to the user space transfer on other platforms. The file offset
+        is advanced by the count of transferred bytes.
+
+        If the file is not opened for reading the method will raise
+        a filesystem exception!
+
+        \param handle - Native destination handle
+        \param size - Size of data to transfer (default is 0 which means up to the end of the file)
+        \return Count of transferred bytes
+    */
+    uint64_t Transfer(void* handle, uint64_t size = 0);
+
+    //! Set caller supplied buffers for the opened file
+    /*!
+        Caller supplied buffers (e.g. from the arena memory manager) are used
+        instead of the pooled ones until the file is closed. Empty buffer makes
+        the corresponding direction unbuffered. Buffers must outlive the opened
+        file.
+
+        If the file is not opened or buffers were already used by some I/O
+        operation the method will raise a filesystem exception!
+
+        \param read - Read buffer
+        \param write - Write buffer
+    */
+    void SetBuffers(std::span<uint8_t> read, std::span<uint8_t> write);
+
     //! Seek into the opened file
     /*!
         If the file is not opened for writing the method will raise
@@ -157,12 +320,59 @@ public:
 
     //! Flush the file
     /*!
-        Flush any unwritten data of the opened file to the physical file
-        on a disk. If the file is not opened for writing the method will
-        raise a filesystem exception!
+        Flush any unwritten data of the internal write buffer to the
+        operating system. Data is not guaranteed to be stored on a disk,
+        use Sync() or DataSync() for durability. If the file is not opened
+        for writing the method will raise a filesystem exception!
     */
     void Flush() override;
 
+    //! Synchronize the file
+    /*!
+        Flush the internal write buffer and synchronize the file data and
+        metadata with the physical file on a disk (fsync). If the file is
+        not opened for writing the method will raise a filesystem exception!
+    */
+    void Sync();
+    //! Synchronize the file data
+    /*!
+        Flush the internal write buffer and synchronize the file data with
+        the physical file on a disk (fdatasync). Metadata which is not
+        required to read the data back (e.g. modification time) is not
+        synchronized. If the file is not opened for writing the method will
+        raise a filesystem exception!
+    */
+    void DataSync();
+    //! Synchronize the file range
+    /*!
+        Flush the internal write buffer and start the write-out of the dirty
+        pages in the given file range (sync_file_range on Linux). This is not
+        a durability guarantee: neither metadata nor disk write cache are
+        flushed. On other platforms the whole file data is synchronized if
+        waiting is required.
+
+        If the file is not opened for writing the method will raise
+        a filesystem exception!
+
+        \param offset - Range offset
+        \param size - Range size (0 means up to the end of the file)
+        \param wait - Wait for the write-out to complete (default is true)
+    */
+    void SyncRange(uint64_t offset, uint64_t size, bool wait = true);
+
+    //! Give the kernel an advice about the access pattern of the file range
+    /*!
+        Advice controls the read-ahead window of the opened file (posix_fadvise
+        on Linux, F_RDAHEAD/F_RDADVISE on MacOS, ignored on Windows).
+
+        If the file is not opened the method will raise a filesystem exception!
+
+        \param advice - Access pattern advice
+        \param offset - Range offset (default is 0)
+        \param size - Range size (default is 0 which means up to the end of the file)
+    */
+    void Advise(FileAdvice advice, uint64_t offset = 0, uint64_t size = 0);
+
     //! Close the file
     /*!
         If the file is not opened for writing the method will raise a
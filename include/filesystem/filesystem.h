@@ -10,8 +10,10 @@
 #define CPPCOMMON_FILESYSTEM_H
 
 #include "filesystem/directory.h"
+#include "filesystem/directory_scanner.h"
 #include "filesystem/exceptions.h"
 #include "filesystem/file.h"
+#include "filesystem/mapped_file.h"
 #include "filesystem/path.h"
 #include "filesystem/symlink.h"
 
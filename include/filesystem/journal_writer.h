@@ -0,0 +1,113 @@
+/*!
+    \file journal_writer.h
+    \brief Group commit journal writer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_JOURNAL_WRITER_H
+#define CPPCOMMON_FILESYSTEM_JOURNAL_WRITER_H
+
+#include "filesystem/file.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+
+#include <exception>
+#include <vector>
+
+namespace CppCommon {
+
+//! Group commit journal writer
+/*!
+    Group commit journal writer appends records to the end of the journal
+    file and returns only when the record is durably stored on a disk.
+
+    Records of concurrent appenders are batched: the first appender becomes
+    a leader, writes all records accumulated so far with a single write and
+    a single file synchronization, and wakes all appenders whose records
+    were included into the batch. Appenders which arrive during the leader's
+    synchronization form the next batch. So the cost of the synchronization
+    is shared between all concurrent appenders.
+
+    If the batch write or synchronization fails the journal becomes broken
+    and all waiting and further appenders will rethrow the original exception
+    of the failed commit.
+
+    Thread-safe.
+*/
+class JournalWriter : public Writer
+{
+public:
+    //! Open or create the journal file with the given path
+    /*!
+        \param path - Journal file path
+        \param data - Synchronize only the file data (fdatasync) instead of the data and metadata (fsync) (default is true)
+    */
+    explicit JournalWriter(const Path& path, bool data = true);
+    JournalWriter(const JournalWriter&) = delete;
+    JournalWriter(JournalWriter&&) = delete;
+    virtual ~JournalWriter();
+
+    JournalWriter& operator=(const JournalWriter&) = delete;
+    JournalWriter& operator=(JournalWriter&&) = delete;
+
+    //! Get the journal file path
+    const Path& path() const noexcept { return _file; }
+
+    //! Get the journal size
+    uint64_t size() const;
+    //! Get the count of durably appended records
+    uint64_t records() const;
+    //! Get the count of performed group commits
+    uint64_t commits() const;
+
+    //! Append a record into the journal and wait until it is durable
+    /*!
+        Will block.
+
+        \param buffer - Record buffer
+        \param size - Record size
+        \return Offset of the record in the journal file
+    */
+    uint64_t Append(const void* buffer, size_t size);
+
+    //! Write a byte buffer into the journal
+    /*!
+        The buffer is appended as a single record. Will block.
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+
+    using Writer::Write;
+
+    //! Close the journal
+    /*!
+        Will block until all pending records are committed.
+    */
+    void Close();
+
+private:
+    mutable CriticalSection _cs;
+    ConditionVariable _cv;
+    File _file;
+    bool _data;
+    // Exception of the failed commit which broke the journal
+    std::exception_ptr _error;
+    bool _committing;
+    std::vector<uint8_t> _batch;
+    std::vector<uint8_t> _commit;
+    uint64_t _size;
+    uint64_t _appended;
+    uint64_t _durable;
+    uint64_t _commits;
+};
+
+/*! \example filesystem_journal_writer.cpp Group commit journal writer example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_FILESYSTEM_JOURNAL_WRITER_H
@@ -0,0 +1,203 @@
+/*!
+    \file mapped_file.h
+    \brief Filesystem memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+#define CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
+
+#include "common/reader.h"
+#include "common/writer.h"
+#include "filesystem/path.h"
+
+#include <memory>
+
+namespace CppCommon {
+
+//! Memory-mapped file access pattern advice
+enum class MappedFileAdvice
+{
+    NORMAL,             //!< No special treatment
+    SEQUENTIAL,         //!< Expect sequential page references (aggressive read-ahead)
+    RANDOM,             //!< Expect random page references (no read-ahead)
+    WILLNEED,           //!< Expect access in the near future (start read-ahead now)
+    DONTNEED            //!< Do not expect access in the near future (pages may be dropped)
+};
+
+//! Filesystem memory-mapped file
+/*!
+    Memory-mapped file maps the whole file or a window of the file into the
+    process address space in read-only or read-write mode. Mapped data can
+    be accessed directly through data() or with Reader/Writer interfaces
+    which operate with the internal mapped cursor.
+
+    Window offset is not required to be page aligned. Mapping is optionally
+    aligned to the huge page boundary to allow the kernel to back it with
+    transparent huge pages.
+
+    Not thread-safe.
+*/
+class MappedFile : public Path, public Reader, public Writer
+{
+public:
+    //! Huge page size used for the mapping alignment (2 MB)
+    static const size_t HUGE_PAGE_SIZE;
+
+    //! Initialize memory-mapped file with an empty path
+    MappedFile();
+    //! Initialize memory-mapped file with a given path
+    /*!
+        \param path - File path
+    */
+    MappedFile(const Path& path);
+    MappedFile(const MappedFile& file);
+    MappedFile(MappedFile&& file) noexcept;
+    virtual ~MappedFile();
+
+    MappedFile& operator=(const Path& path)
+    { Assign(path); return *this; }
+    MappedFile& operator=(const MappedFile& file);
+    MappedFile& operator=(MappedFile&& file) noexcept;
+
+    //! Check if the file is mapped
+    explicit operator bool() const noexcept { return IsMapped(); }
+
+    //! Get the mapped data pointer
+    uint8_t* data() noexcept;
+    //! Get the constant mapped data pointer
+    const uint8_t* data() const noexcept;
+    //! Get the mapped window size
+    size_t size() const noexcept;
+    //! Get the mapped window offset in the file
+    uint64_t offset() const noexcept;
+    //! Get the current read/write cursor position in the mapped window
+    size_t position() const noexcept;
+
+    //! Is the file mapped?
+    bool IsMapped() const noexcept;
+    //! Is the file mapped for writing?
+    bool IsWritable() const noexcept;
+
+    //! Map the file into memory
+    /*!
+        Map a window of the file with a given offset and size into memory.
+        The window size of zero means to map the file from the given offset
+        up to its end. In this case the window follows the file size after
+        the Resize() call.
+
+        If the file is not exist or the window is out of the file bounds
+        the method will raise a filesystem exception!
+
+        \param write - Write mode
+        \param offset - Window offset in the file (default is 0)
+        \param size - Window size (default is 0 which means the whole file)
+        \param huge - Align the mapping to the huge page boundary (default is false)
+    */
+    void Map(bool write, uint64_t offset = 0, size_t size = 0, bool huge = false);
+    //! Unmap the file
+    /*!
+        If the file is mapped for writing all modified pages will be
+        asynchronously scheduled for the write-back.
+    */
+    void Unmap();
+
+    //! Give the kernel an advice about the access pattern of the mapped window range
+    /*!
+        \param advice - Access pattern advice
+        \param offset - Range offset in the mapped window (default is 0)
+        \param size - Range size (default is 0 which means up to the end of the mapped window)
+    */
+    void Advise(MappedFileAdvice advice, size_t offset = 0, size_t size = 0);
+
+    //! Resize the file and remap the current window
+    /*!
+        If the file is mapped for the whole range then the window will
+        follow the new file size. Otherwise the window keeps its size,
+        but it is truncated if the file becomes shorter.
+
+        Works for mapped and not mapped files!
+
+        \param size - File size
+    */
+    void Resize(uint64_t size);
+
+    //! Synchronize the mapped window range with the file on a disk
+    /*!
+        \param offset - Range offset in the mapped window (default is 0)
+        \param size - Range size (default is 0 which means up to the end of the mapped window)
+        \param async - Only schedule the write-back and do not wait for it to complete (default is false)
+    */
+    void Sync(size_t offset = 0, size_t size = 0, bool async = false);
+
+    //! Read a bytes buffer from the mapped window at the current cursor position
+    /*!
+        If the file is not mapped the method will raise a filesystem exception!
+
+        \param buffer - Buffer to read
+        \param size - Buffer size
+        \return Count of read bytes
+    */
+    size_t Read(void* buffer, size_t size) override;
+
+    using Reader::ReadAllBytes;
+    using Reader::ReadAllText;
+    using Reader::ReadAllLines;
+
+    //! Write a byte buffer into the mapped window at the current cursor position
+    /*!
+        Writing is limited by the mapped window size. Use Resize() to grow
+        the file and the mapped window.
+
+        If the file is not mapped for writing the method will raise
+        a filesystem exception!
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of written bytes
+    */
+    size_t Write(const void* buffer, size_t size) override;
+
+    using Writer::Write;
+
+    //! Seek the read/write cursor in the mapped window
+    /*!
+        If the file is not mapped or the position is out of the mapped
+        window the method will raise a filesystem exception!
+
+        \param position - Cursor position
+    */
+    void Seek(size_t position);
+
+    //! Flush the mapped window
+    /*!
+        Schedule the write-back of all modified pages of the mapped window
+        without waiting for it. Use Sync() for durability. Does nothing if
+        the file is not mapped for writing.
+    */
+    void Flush() override;
+
+    //! Swap two instances
+    void swap(MappedFile& file) noexcept;
+    friend void swap(MappedFile& file1, MappedFile& file2) noexcept;
+
+private:
+    class Impl;
+
+    Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
+    const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
+
+    static const size_t StorageSize = 128;
+    static const size_t StorageAlign = 8;
+    alignas(StorageAlign) std::byte _storage[StorageSize];
+};
+
+/*! \example filesystem_mapped_file.cpp Filesystem memory-mapped file example */
+
+} // namespace CppCommon
+
+#include "mapped_file.inl"
+
+#endif // CPPCOMMON_FILESYSTEM_MAPPED_FILE_H
@@ -0,0 +1,16 @@
+/*!
+    \file mapped_file.inl
+    \brief Filesystem memory-mapped file inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void swap(MappedFile& file1, MappedFile& file2) noexcept
+{
+    file1.swap(file2);
+}
+
+} // namespace CppCommon
@@ -43,7 +43,8 @@ enum class FileAttributes
     OFFLINE   = 0x10,   //!< Offline
     READONLY  = 0x20,   //!< Readonly
     SYSTEM    = 0x40,   //!< System
-    TEMPORARY = 0x80    //!< Temporary
+    TEMPORARY = 0x80,   //!< Temporary
+    DIRECT    = 0x100   //!< Direct I/O which bypasses the system cache (file open flag, Unix only)
 };
 
 //! File permissions (Unix specific)
@@ -0,0 +1,333 @@
+/*!
+    \file allocator_shared.h
+    \brief Shared memory allocator definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+#define CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
+
+#include "allocator.h"
+#include "system/process.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Offset pointer class
+/*!
+    Offset pointer stores the distance from its own address to the pointed
+    object instead of the absolute address. So offset pointers placed into
+    the shared memory block stay valid in all processes even if the block is
+    mapped at different addresses. Copying an offset pointer recalculates
+    the distance for the new location.
+
+    Offset pointer satisfies the fancy pointer requirements, so it is used
+    by standard containers through the allocator pointer type.
+
+    Not thread-safe.
+*/
+template <typename T>
+class OffsetPtr
+{
+    template <typename U>
+    friend class OffsetPtr;
+
+public:
+    //! Element type
+    typedef T element_type;
+    //! Value type
+    typedef typename std::remove_cv<T>::type value_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+    //! Pointer to element
+    typedef OffsetPtr pointer;
+    //! Reference to element
+    typedef typename std::add_lvalue_reference<T>::type reference;
+    //! Iterator category
+    typedef std::random_access_iterator_tag iterator_category;
+
+    //! Rebind offset pointer
+    template <typename U>
+    using rebind = OffsetPtr<U>;
+
+    OffsetPtr() noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(std::nullptr_t) noexcept : _offset(NULL_OFFSET) {}
+    OffsetPtr(T* ptr) noexcept { set(ptr); }
+    OffsetPtr(const OffsetPtr& ptr) noexcept { set(ptr.get()); }
+    template <typename U, typename = typename std::enable_if<std::is_convertible<U*, T*>::value>::type>
+    OffsetPtr(const OffsetPtr<U>& ptr) noexcept { set(ptr.get()); }
+    template <typename U, typename = typename std::enable_if<!std::is_convertible<U*, T*>::value>::type, typename = void>
+    explicit OffsetPtr(const OffsetPtr<U>& ptr) noexcept { set(static_cast<T*>(ptr.get())); }
+    ~OffsetPtr() noexcept = default;
+
+    OffsetPtr& operator=(const OffsetPtr& ptr) noexcept { set(ptr.get()); return *this; }
+    OffsetPtr& operator=(T* ptr) noexcept { set(ptr); return *this; }
+    OffsetPtr& operator=(std::nullptr_t) noexcept { _offset = NULL_OFFSET; return *this; }
+
+    //! Check if the offset pointer is not null
+    explicit operator bool() const noexcept { return (_offset != NULL_OFFSET); }
+
+    //! Get the raw pointer
+    // Integer arithmetic is used, because the pointed object is not a part of the offset pointer object
+    T* get() const noexcept { return (_offset == NULL_OFFSET) ? nullptr : (T*)((uintptr_t)this + _offset); }
+
+    T* operator->() const noexcept { return get(); }
+    reference operator*() const noexcept { return *get(); }
+    reference operator[](difference_type index) const noexcept { return get()[index]; }
+
+    OffsetPtr& operator++() noexcept { set(get() + 1); return *this; }
+    OffsetPtr operator++(int) noexcept { OffsetPtr result(*this); set(get() + 1); return result; }
+    OffsetPtr& operator--() noexcept { set(get() - 1); return *this; }
+    OffsetPtr operator--(int) noexcept { OffsetPtr result(*this); set(get() - 1); return result; }
+    OffsetPtr& operator+=(difference_type offset) noexcept { set(get() + offset); return *this; }
+    OffsetPtr& operator-=(difference_type offset) noexcept { set(get() - offset); return *this; }
+
+    friend OffsetPtr operator+(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator+(difference_type offset, const OffsetPtr& ptr) noexcept { return OffsetPtr(ptr.get() + offset); }
+    friend OffsetPtr operator-(const OffsetPtr& ptr, difference_type offset) noexcept { return OffsetPtr(ptr.get() - offset); }
+    friend difference_type operator-(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() - ptr2.get(); }
+
+    friend bool operator==(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() == ptr2.get(); }
+    friend bool operator!=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() != ptr2.get(); }
+    friend bool operator<(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() < ptr2.get(); }
+    friend bool operator>(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() > ptr2.get(); }
+    friend bool operator<=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() <= ptr2.get(); }
+    friend bool operator>=(const OffsetPtr& ptr1, const OffsetPtr& ptr2) noexcept { return ptr1.get() >= ptr2.get(); }
+    friend bool operator==(const OffsetPtr& ptr, std::nullptr_t) noexcept { return !ptr; }
+    friend bool operator!=(const OffsetPtr& ptr, std::nullptr_t) noexcept { return (bool)ptr; }
+
+    //! Get the offset pointer to the given reference
+    template <typename U = T, typename = typename std::enable_if<!std::is_void<U>::value>::type>
+    static OffsetPtr pointer_to(U& x) noexcept { return OffsetPtr(std::addressof(x)); }
+
+    //! Swap two instances
+    void swap(OffsetPtr& ptr) noexcept { T* temp = get(); set(ptr.get()); ptr.set(temp); }
+    friend void swap(OffsetPtr& ptr1, OffsetPtr& ptr2) noexcept { ptr1.swap(ptr2); }
+
+private:
+    // Zero offset points to the offset pointer itself, so another value marks the null pointer
+    static const ptrdiff_t NULL_OFFSET = 1;
+
+    ptrdiff_t _offset;
+
+    void set(T* ptr) noexcept { _offset = (ptr == nullptr) ? NULL_OFFSET : (ptrdiff_t)((uintptr_t)ptr - (uintptr_t)this); }
+};
+
+//! Shared memory manager class
+/*!
+    Shared memory manager carves memory blocks out of the buffer it is placed
+    into, usually a SharedMemory block. All bookkeeping is done with offsets
+    from the manager address, so the same manager may be used by several
+    processes which map the buffer at different addresses. Free blocks are
+    kept in the address ordered list and merged with their neighbors.
+
+    The manager is created at the beginning of the buffer with Create() and
+    attached by other processes with Attach(). The root object pointer allows
+    other processes to find the first object (e.g. container) created in the
+    shared memory.
+
+    Thread-safe and process-safe (the manager is protected with a spin-lock
+    placed into the buffer). The spin-lock keeps the owner process Id and
+    waiters take over the lock if its owner process dies, so a crashed
+    process does not deadlock others. But the bookkeeping of the manager
+    might be left inconsistent if the process dies in the middle of the
+    allocation or deallocation, so the shared memory block should be
+    recreated if processes which use it could crash.
+*/
+class SharedMemoryManager
+{
+public:
+    SharedMemoryManager(const SharedMemoryManager&) = delete;
+    SharedMemoryManager(SharedMemoryManager&&) = delete;
+    ~SharedMemoryManager() = delete;
+
+    SharedMemoryManager& operator=(const SharedMemoryManager&) = delete;
+    SharedMemoryManager& operator=(SharedMemoryManager&&) = delete;
+
+    //! Create a new shared memory manager at the beginning of the given buffer
+    /*!
+        \param buffer - Buffer to manage (must be aligned to alignof(std::max_align_t))
+        \param capacity - Buffer capacity
+        \return Shared memory manager placed into the buffer
+    */
+    static SharedMemoryManager* Create(void* buffer, size_t capacity);
+    //! Attach to the shared memory manager created in the given buffer
+    /*!
+        \param buffer - Buffer with the created shared memory manager
+        \return Shared memory manager placed into the buffer or nullptr if the buffer does not contain it
+    */
+    static SharedMemoryManager* Attach(void* buffer);
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return (size_t)_allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return (size_t)_allocations; }
+
+    //! Managed buffer capacity
+    size_t capacity() const noexcept { return (size_t)_capacity; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return (size_t)_capacity; }
+
+    //! Get the root object pointer
+    void* root() const noexcept { return _root.get(); }
+    //! Set the root object pointer
+    /*!
+        \param ptr - Root object pointer (must be allocated by the memory manager)
+    */
+    void SetRoot(void* ptr) noexcept { _root = ptr; }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reset the memory manager
+    void reset();
+
+private:
+    // Shared memory manager signature
+    static const uint64_t SIGNATURE = 0x524D4853524D4853ull;
+    // Granularity of memory blocks
+    static const size_t GRANULARITY = 16;
+    // Count of lock spins between checks if the lock owner process is still alive
+    static const size_t RECOVERY_SPINS = 1024;
+
+    // Free block placed at the beginning of each free memory block
+    struct FreeBlock
+    {
+        uint64_t size;
+        uint64_t next;
+    };
+
+    // Allocation header placed right before each allocated memory block
+    struct AllocationHeader
+    {
+        uint64_t block;
+        uint64_t size;
+    };
+
+    std::atomic<uint64_t> _signature;
+    std::atomic<uint32_t> _lock;
+    uint64_t _capacity;
+    uint64_t _first;
+    uint64_t _head;
+    uint64_t _allocated;
+    uint64_t _allocations;
+    OffsetPtr<void> _root;
+
+    explicit SharedMemoryManager(size_t capacity);
+
+    uint8_t* base() noexcept { return (uint8_t*)this; }
+    FreeBlock* block(uint64_t offset) noexcept { return (FreeBlock*)(base() + offset); }
+
+    void Lock() noexcept;
+    void Unlock() noexcept;
+};
+
+//! Shared memory allocator class
+/*!
+    Shared memory allocator implements standard allocator interface with
+    offset pointers and allocates memory with the shared memory manager.
+    Containers which use the allocator pointer type (std::vector, HashMap,
+    FlatMap) may be placed into the shared memory block and used from all
+    processes attached to it. Stored elements must not contain raw pointers
+    (e.g. std::string) to keep them valid in other processes.
+
+    Thread-safe.
+*/
+template <typename T, bool nothrow = false>
+class SharedAllocator
+{
+    template <typename U, bool flag>
+    friend class SharedAllocator;
+
+public:
+    //! Element type
+    typedef T value_type;
+    //! Pointer to element
+    typedef OffsetPtr<T> pointer;
+    //! Pointer to constant element
+    typedef OffsetPtr<const T> const_pointer;
+    //! Void pointer
+    typedef OffsetPtr<void> void_pointer;
+    //! Constant void pointer
+    typedef OffsetPtr<const void> const_void_pointer;
+    //! Quantities of elements
+    typedef size_t size_type;
+    //! Difference between two pointers
+    typedef ptrdiff_t difference_type;
+
+    //! Initialize allocator with a given shared memory manager
+    /*!
+        \param manager - Shared memory manager
+    */
+    explicit SharedAllocator(SharedMemoryManager& manager) noexcept : _manager(&manager) {}
+    template <typename U>
+    SharedAllocator(const SharedAllocator<U, nothrow>& alloc) noexcept : _manager(alloc._manager) {}
+    SharedAllocator(const SharedAllocator& alloc) noexcept : _manager(alloc._manager) {}
+    ~SharedAllocator() noexcept = default;
+
+    template <typename U>
+    SharedAllocator& operator=(const SharedAllocator<U, nothrow>& alloc) noexcept
+    { _manager = alloc._manager; return *this; }
+    SharedAllocator& operator=(const SharedAllocator& alloc) noexcept
+    { _manager = alloc._manager; return *this; }
+
+    //! Get the shared memory manager
+    SharedMemoryManager& manager() const noexcept { return *_manager; }
+
+    //! Get the maximum number of elements, that could potentially be allocated by the allocator
+    size_type max_size() const noexcept { return _manager->max_size() / sizeof(T); }
+
+    //! Allocate a block of storage suitable to contain the given count of elements
+    /*!
+        \param num - Number of elements to be allocated
+        \return An offset pointer to the initial element in the block of storage
+    */
+    pointer allocate(size_type num);
+    //! Release a block of storage previously allocated
+    /*!
+        \param ptr - Offset pointer to a block of storage
+        \param num - Number of releasing elements
+    */
+    void deallocate(pointer ptr, size_type num);
+
+    //! Rebind allocator
+    template <typename TOther> struct rebind { using other = SharedAllocator<TOther, nothrow>; };
+
+    template <typename U>
+    friend bool operator==(const SharedAllocator& alloc1, const SharedAllocator<U, nothrow>& alloc2) noexcept { return alloc1._manager.get() == alloc2._manager.get(); }
+    template <typename U>
+    friend bool operator!=(const SharedAllocator& alloc1, const SharedAllocator<U, nothrow>& alloc2) noexcept { return alloc1._manager.get() != alloc2._manager.get(); }
+
+private:
+    OffsetPtr<SharedMemoryManager> _manager;
+};
+
+/*! \example memory_shared.cpp Shared memory allocator example */
+
+} // namespace CppCommon
+
+#include "allocator_shared.inl"
+
+#endif // CPPCOMMON_MEMORY_ALLOCATOR_SHARED_H
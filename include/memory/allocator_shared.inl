@@ -0,0 +1,214 @@
+/*!
+    \file allocator_shared.inl
+    \brief Shared memory allocator inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline SharedMemoryManager::SharedMemoryManager(size_t capacity)
+    : _signature(0), _lock(0), _capacity(capacity), _first(0), _head(0), _allocated(0), _allocations(0), _root(nullptr)
+{
+    // The first free block starts right after the manager
+    _first = ((sizeof(SharedMemoryManager) + GRANULARITY - 1) / GRANULARITY) * GRANULARITY;
+    reset();
+}
+
+inline SharedMemoryManager* SharedMemoryManager::Create(void* buffer, size_t capacity)
+{
+    assert((buffer != nullptr) && "Shared memory buffer must be valid!");
+    assert(Memory::IsAligned((uint8_t*)buffer, GRANULARITY) && "Shared memory buffer must be aligned!");
+    assert((capacity > (sizeof(SharedMemoryManager) + 2 * GRANULARITY)) && "Shared memory buffer capacity is too small!");
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory manager requires lock-free 64-bit atomics!");
+
+    SharedMemoryManager* manager = new(buffer) SharedMemoryManager(capacity);
+    manager->_signature.store(SIGNATURE, std::memory_order_release);
+    return manager;
+}
+
+inline SharedMemoryManager* SharedMemoryManager::Attach(void* buffer)
+{
+    assert((buffer != nullptr) && "Shared memory buffer must be valid!");
+
+    SharedMemoryManager* manager = (SharedMemoryManager*)buffer;
+    return (manager->_signature.load(std::memory_order_acquire) == SIGNATURE) ? manager : nullptr;
+}
+
+inline void SharedMemoryManager::Lock() noexcept
+{
+    // Lock word keeps the owner process Id, so the lock of a dead process could be taken over
+    uint32_t pid = (uint32_t)Process::CurrentProcessId();
+    for (size_t spin = 1;; ++spin)
+    {
+        uint32_t owner = 0;
+        if (_lock.compare_exchange_weak(owner, pid, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+
+        // Check the lock owner process periodically while waiting
+        if ((owner != 0) && (owner != pid) && ((spin % RECOVERY_SPINS) == 0) && !Process::IsProcessRunning(owner))
+            if (_lock.compare_exchange_strong(owner, pid, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+
+        std::this_thread::yield();
+    }
+}
+
+inline void SharedMemoryManager::Unlock() noexcept
+{
+    _lock.store(0, std::memory_order_release);
+}
+
+inline void* SharedMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((size > 0) && "Allocated block size must be greater than zero!");
+    assert(Memory::IsValidAlignment(alignment) && "Alignment must be valid!");
+
+    // Reserve the space for the allocation header and the extra alignment
+    uint64_t required = size + sizeof(AllocationHeader) + ((alignment > GRANULARITY) ? (alignment - GRANULARITY) : 0);
+    required = ((required + GRANULARITY - 1) / GRANULARITY) * GRANULARITY;
+
+    Lock();
+
+    // Find the first free block of the required size
+    uint64_t* link = &_head;
+    while (*link != 0)
+    {
+        FreeBlock* current = block(*link);
+        if (current->size >= required)
+        {
+            uint64_t offset = *link;
+            uint64_t available = current->size;
+
+            // Split the free block if the rest is enough for another block
+            if ((available - required) >= sizeof(FreeBlock) + GRANULARITY)
+            {
+                FreeBlock* rest = block(offset + required);
+                rest->size = available - required;
+                rest->next = current->next;
+                *link = offset + required;
+            }
+            else
+            {
+                required = available;
+                *link = current->next;
+            }
+
+            // Fill the allocation header right before the aligned memory block
+            uint8_t* result = base() + offset + sizeof(AllocationHeader);
+            result = Memory::Align(result, alignment);
+            AllocationHeader* header = (AllocationHeader*)(result - sizeof(AllocationHeader));
+            header->block = offset;
+            header->size = required;
+
+            // Update allocation statistics
+            _allocated += size;
+            ++_allocations;
+
+            Unlock();
+            return result;
+        }
+        link = &current->next;
+    }
+
+    Unlock();
+
+    // Not enough memory...
+    return nullptr;
+}
+
+inline void SharedMemoryManager::free(void* ptr, size_t size)
+{
+    assert((ptr != nullptr) && "Deallocated block must be valid!");
+    assert(((uint8_t*)ptr > base()) && ((uint8_t*)ptr < (base() + _capacity)) && "Deallocated block must be allocated by the shared memory manager!");
+
+    if (ptr == nullptr)
+        return;
+
+    AllocationHeader* header = (AllocationHeader*)((uint8_t*)ptr - sizeof(AllocationHeader));
+    uint64_t offset = header->block;
+    uint64_t length = header->size;
+
+    Lock();
+
+    // Find the position of the block in the address ordered free list
+    uint64_t previous = 0;
+    uint64_t next = _head;
+    while ((next != 0) && (next < offset))
+    {
+        previous = next;
+        next = block(next)->next;
+    }
+
+    FreeBlock* current = block(offset);
+    current->size = length;
+    current->next = next;
+
+    // Merge with the next free block
+    if ((next != 0) && ((offset + current->size) == next))
+    {
+        current->size += block(next)->size;
+        current->next = block(next)->next;
+    }
+
+    // Merge with the previous free block
+    if ((previous != 0) && ((previous + block(previous)->size) == offset))
+    {
+        block(previous)->size += current->size;
+        block(previous)->next = current->next;
+    }
+    else if (previous != 0)
+        block(previous)->next = offset;
+    else
+        _head = offset;
+
+    // Update allocation statistics
+    _allocated -= size;
+    --_allocations;
+
+    Unlock();
+}
+
+inline void SharedMemoryManager::reset()
+{
+    assert((_allocated == 0) && "Memory leak detected! Allocated memory size must be zero!");
+    assert((_allocations == 0) && "Memory leak detected! Count of active memory allocations must be zero!");
+
+    Lock();
+
+    // Make the whole buffer a single free block
+    _head = _first;
+    block(_first)->size = ((_capacity - _first) / GRANULARITY) * GRANULARITY;
+    block(_first)->next = 0;
+    _root = nullptr;
+
+    // Reset allocation statistics
+    _allocated = 0;
+    _allocations = 0;
+
+    Unlock();
+}
+
+template <typename T, bool nothrow>
+inline typename SharedAllocator<T, nothrow>::pointer SharedAllocator<T, nothrow>::allocate(size_type num)
+{
+    T* result = (T*)_manager->malloc(num * sizeof(T), alignof(T));
+    if (result != nullptr)
+        return pointer(result);
+
+    // Not enough memory...
+    if (nothrow)
+        return pointer(nullptr);
+    else
+        throw std::bad_alloc();
+}
+
+template <typename T, bool nothrow>
+inline void SharedAllocator<T, nothrow>::deallocate(pointer ptr, size_type num)
+{
+    _manager->free(ptr.get(), num * sizeof(T));
+}
+
+} // namespace CppCommon
@@ -11,6 +11,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace CppCommon {
 
@@ -18,6 +19,10 @@ namespace CppCommon {
 /*!
     Encoding utilities contains methods for UTF-8, UTF-16, UTF-32 encoding conversions.
 
+    UTF-8 validation, Base16 and Base64 codecs use SSSE3/AVX2 instructions
+    when they are supported by the current CPU and fall back to the scalar
+    code otherwise.
+
     Thread-safe.
 */
 class Encoding
@@ -35,58 +40,170 @@ public:
     /*!
         System wide-string could be UTF-16 (Windows) or UTF-32 (Unix).
 
+        If the wide-string is invalid the method will raise an argument exception!
+
         \param wstr - System wide-string to convert
         \return UTF-8 encoded string
     */
     static std::string ToUTF8(std::wstring_view wstr);
+    //! Convert system wide-string to UTF-8 encoded string and append the result to the given buffer
+    /*!
+        \param wstr - System wide-string to convert
+        \param result - Buffer to append UTF-8 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool ToUTF8(std::wstring_view wstr, std::string& result);
 
     //! Convert UTF-8 encoded string to system wide-string
     /*!
         System wide-string could be UTF-16 (Windows) or UTF-32 (Unix).
 
+        If the UTF-8 string is invalid the method will raise an argument exception!
+
         \param str - UTF-8 encoded string to convert
         \return System wide-string
     */
     static std::wstring FromUTF8(std::string_view str);
+    //! Convert UTF-8 encoded string to system wide-string and append the result to the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param result - Buffer to append system wide-string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool FromUTF8(std::string_view str, std::wstring& result);
 
     //! Convert UTF-8 encoded string to UTF-16 encoded string
     /*!
+        If the UTF-8 string is invalid the method will raise an argument exception!
+
         \param str - UTF-8 encoded string to convert
         \return UTF-16 encoded string
     */
     static std::u16string UTF8toUTF16(std::string_view str);
+    //! Convert UTF-8 encoded string to UTF-16 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param result - Buffer to append UTF-16 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF8toUTF16(std::string_view str, std::u16string& result);
     //! Convert UTF-8 encoded string to UTF-32 encoded string
     /*!
+        If the UTF-8 string is invalid the method will raise an argument exception!
+
         \param str - UTF-8 encoded string to convert
         \return UTF-32 encoded string
     */
     static std::u32string UTF8toUTF32(std::string_view str);
+    //! Convert UTF-8 encoded string to UTF-32 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-8 encoded string to convert
+        \param result - Buffer to append UTF-32 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF8toUTF32(std::string_view str, std::u32string& result);
 
     //! Convert UTF-16 encoded string to UTF-8 encoded string
     /*!
+        If the UTF-16 string is invalid the method will raise an argument exception!
+
         \param str - UTF-16 encoded string to convert
         \return UTF-8 encoded string
     */
     static std::string UTF16toUTF8(std::u16string_view str);
+    //! Convert UTF-16 encoded string to UTF-8 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-16 encoded string to convert
+        \param result - Buffer to append UTF-8 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF16toUTF8(std::u16string_view str, std::string& result);
     //! Convert UTF-16 encoded string to UTF-32 encoded string
     /*!
+        If the UTF-16 string is invalid the method will raise an argument exception!
+
         \param str - UTF-16 encoded string to convert
         \return UTF-32 encoded string
     */
     static std::u32string UTF16toUTF32(std::u16string_view str);
+    //! Convert UTF-16 encoded string to UTF-32 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-16 encoded string to convert
+        \param result - Buffer to append UTF-32 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF16toUTF32(std::u16string_view str, std::u32string& result);
 
     //! Convert UTF-32 encoded string to UTF-8 encoded string
     /*!
+        If the UTF-32 string is invalid the method will raise an argument exception!
+
         \param str - UTF-32 encoded string to convert
         \return UTF-8 encoded string
     */
     static std::string UTF32toUTF8(std::u32string_view str);
+    //! Convert UTF-32 encoded string to UTF-8 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-32 encoded string to convert
+        \param result - Buffer to append UTF-8 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF32toUTF8(std::u32string_view str, std::string& result);
     //! Convert UTF-32 encoded string to UTF-16 encoded string
     /*!
+        If the UTF-32 string is invalid the method will raise an argument exception!
+
         \param str - UTF-32 encoded string to convert
         \return UTF-16 encoded string
     */
     static std::u16string UTF32toUTF16(std::u32string_view str);
+    //! Convert UTF-32 encoded string to UTF-16 encoded string and append the result to the given buffer
+    /*!
+        \param str - UTF-32 encoded string to convert
+        \param result - Buffer to append UTF-16 encoded string
+        \return 'true' if the string was successfully converted, 'false' if the string is invalid
+    */
+    static bool UTF32toUTF16(std::u32string_view str, std::u16string& result);
+
+    //! Is the given string valid UTF-8 encoded string?
+    /*!
+        Overlong encodings, surrogates and code points above U+10FFFF are invalid.
+
+        \param str - String to check
+        \return 'true' if the string is valid UTF-8 encoded string, 'false' otherwise
+    */
+    static bool IsValidUTF8(std::string_view str) noexcept;
+    //! Is the given string valid UTF-16 encoded string?
+    /*!
+        \param str - String to check
+        \return 'true' if the string has no unpaired surrogates, 'false' otherwise
+    */
+    static bool IsValidUTF16(std::u16string_view str) noexcept;
+
+    //! Count Unicode code points in the valid UTF-8 encoded string
+    /*!
+        \param str - UTF-8 encoded string
+        \return Count of Unicode code points
+    */
+    static size_t CountUTF8(std::string_view str) noexcept;
+    //! Get the length of UTF-16 encoded string converted from the valid UTF-8 encoded string
+    /*!
+        \param str - UTF-8 encoded string
+        \return Count of UTF-16 code units
+    */
+    static size_t UTF16Length(std::string_view str) noexcept;
+    //! Get the length of UTF-8 encoded string converted from the valid UTF-16 encoded string
+    /*!
+        \param str - UTF-16 encoded string
+        \return Count of UTF-8 code units
+    */
+    static size_t UTF8Length(std::u16string_view str) noexcept;
+    //! Get the length of UTF-8 encoded string converted from the valid UTF-32 encoded string
+    /*!
+        \param str - UTF-32 encoded string
+        \return Count of UTF-8 code units
+    */
+    static size_t UTF8Length(std::u32string_view str) noexcept;
 
     //! Base16 encode string
     /*!
@@ -94,12 +211,27 @@ public:
         \return Base16 encoded string
     */
     static std::string Base16Encode(std::string_view str);
+    //! Base16 encode string and append the result to the given buffer
+    /*!
+        \param str - String to encode
+        \param result - Buffer to append Base16 encoded string
+    */
+    static void Base16Encode(std::string_view str, std::string& result);
     //! Base16 decode string
     /*!
         \param str - Base16 encoded string
         \return Decoded string
     */
     static std::string Base16Decode(std::string_view str);
+    //! Base16 decode string and append the result to the given buffer
+    /*!
+        The given buffer is left unchanged if the decoding fails.
+
+        \param str - Base16 encoded string
+        \param result - Buffer to append decoded string
+        \return 'true' if the string was successfully decoded, 'false' if the string is invalid
+    */
+    static bool Base16Decode(std::string_view str, std::string& result);
 
     //! Base32 encode string
     /*!
@@ -107,12 +239,27 @@ public:
         \return Base32 encoded string
     */
     static std::string Base32Encode(std::string_view str);
+    //! Base32 encode string and append the result to the given buffer
+    /*!
+        \param str - String to encode
+        \param result - Buffer to append Base32 encoded string
+    */
+    static void Base32Encode(std::string_view str, std::string& result);
     //! Base32 decode string
     /*!
         \param str - Base32 encoded string
         \return Decoded string
     */
     static std::string Base32Decode(std::string_view str);
+    //! Base32 decode string and append the result to the given buffer
+    /*!
+        The given buffer is left unchanged if the decoding fails.
+
+        \param str - Base32 encoded string
+        \param result - Buffer to append decoded string
+        \return 'true' if the string was successfully decoded, 'false' if the string is invalid
+    */
+    static bool Base32Decode(std::string_view str, std::string& result);
 
     //! Base64 encode string
     /*!
@@ -120,12 +267,28 @@ public:
         \return Base64 encoded string
     */
     static std::string Base64Encode(std::string_view str);
+    //! Base64 encode string and append the result to the given buffer
+    /*!
+        \param str - String to encode
+        \param result - Buffer to append Base64 encoded string
+    */
+    static void Base64Encode(std::string_view str, std::string& result);
     //! Base64 decode string
     /*!
         \param str - Base64 encoded string
         \return Decoded string
     */
     static std::string Base64Decode(std::string_view str);
+    //! Base64 decode string and append the result to the given buffer
+    /*!
+        The given buffer is left unchanged if the Base64 encoded string length
+        is not a multiple of 4.
+
+        \param str - Base64 encoded string
+        \param result - Buffer to append decoded string
+        \return 'true' if the string was successfully decoded, 'false' if the string is invalid
+    */
+    static bool Base64Decode(std::string_view str, std::string& result);
 
     //! URL encode string
     /*!
@@ -141,6 +304,91 @@ public:
     static std::string URLDecode(std::string_view str);
 };
 
+//! Base64 streaming encoder
+/*!
+    Base64 streaming encoder allows to encode data which comes in chunks
+    of arbitrary size. Encoded data is appended to the caller's buffer and
+    is the same as encoding of the whole data at once.
+
+    Not thread-safe.
+*/
+class Base64Encoder
+{
+public:
+    Base64Encoder() noexcept : _size(0) {}
+    Base64Encoder(const Base64Encoder&) = default;
+    Base64Encoder(Base64Encoder&&) = default;
+    ~Base64Encoder() = default;
+
+    Base64Encoder& operator=(const Base64Encoder&) = default;
+    Base64Encoder& operator=(Base64Encoder&&) = default;
+
+    //! Encode the next chunk of data
+    /*!
+        \param chunk - Data chunk to encode
+        \param result - Buffer to append Base64 encoded data
+    */
+    void Encode(std::string_view chunk, std::string& result);
+    //! Finish encoding and append the last padded block
+    /*!
+        \param result - Buffer to append Base64 encoded data
+    */
+    void Finish(std::string& result);
+
+    //! Reset the encoder and drop any pending data
+    void Reset() noexcept { _size = 0; }
+
+private:
+    char _buffer[3];
+    size_t _size;
+};
+
+//! Base64 streaming decoder
+/*!
+    Base64 streaming decoder allows to decode Base64 data which comes in
+    chunks of arbitrary size. Decoded data is appended to the caller's buffer.
+
+    Not thread-safe.
+*/
+class Base64Decoder
+{
+public:
+    Base64Decoder() noexcept : _size(0), _padded(false), _failed(false) {}
+    Base64Decoder(const Base64Decoder&) = default;
+    Base64Decoder(Base64Decoder&&) = default;
+    ~Base64Decoder() = default;
+
+    Base64Decoder& operator=(const Base64Decoder&) = default;
+    Base64Decoder& operator=(Base64Decoder&&) = default;
+
+    //! Decode the next chunk of Base64 data
+    /*!
+        After the first failure all following chunks are rejected
+        until the decoder is finished or reset.
+
+        \param chunk - Base64 data chunk to decode
+        \param result - Buffer to append decoded data
+        \return 'true' if the chunk was successfully decoded, 'false' if the Base64 data is invalid
+    */
+    bool Decode(std::string_view chunk, std::string& result);
+    //! Finish decoding
+    /*!
+        \return 'true' if all Base64 data was decoded, 'false' if the data is truncated or invalid
+    */
+    bool Finish();
+
+    //! Reset the decoder and drop any pending data
+    void Reset() noexcept { _size = 0; _padded = false; _failed = false; }
+
+private:
+    char _buffer[4];
+    size_t _size;
+    bool _padded;
+    bool _failed;
+
+    bool DecodeGroups(std::string_view groups, std::string& result);
+};
+
 /*! \example string_encoding.cpp Encoding utilities example */
 
 } // namespace CppCommon
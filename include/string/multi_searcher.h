@@ -0,0 +1,144 @@
+/*!
+    \file multi_searcher.h
+    \brief Multiple substrings searcher definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_MULTI_SEARCHER_H
+#define CPPCOMMON_STRING_MULTI_SEARCHER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Multiple substrings searcher
+/*!
+    Multiple substrings searcher finds many literal patterns at once in a
+    single pass over the string. Patterns are compiled into the Aho-Corasick
+    automaton with compressed alphabet, so the search time does not depend
+    on the count of patterns.
+
+    Matches are reported in order of their end positions. If several patterns
+    end at the same position the longest one is reported. Search continues
+    after the end of the previous match, so matches never overlap.
+
+    If all patterns start with up to 8 different characters the automaton
+    skips non-matching parts of the string with SSE2 instructions.
+
+    Not thread-safe for modifications, thread-safe for searching.
+*/
+class MultiSearcher
+{
+public:
+    //! Match of the pattern
+    struct Match
+    {
+        //! Index of the matched pattern
+        size_t pattern;
+        //! Position of the match in the string
+        size_t position;
+        //! Size of the match
+        size_t size;
+    };
+
+    //! Initialize an empty searcher
+    MultiSearcher() noexcept : _ignore_case(false), _alphabet(1), _classes() {}
+    //! Initialize searcher with the given patterns
+    /*!
+        If any pattern is empty the method will raise an argument exception!
+
+        \param patterns - Patterns to search
+        \param ignore_case - Ignore case of ASCII characters flag (default is false)
+    */
+    explicit MultiSearcher(const std::vector<std::string>& patterns, bool ignore_case = false);
+    MultiSearcher(const MultiSearcher&) = default;
+    MultiSearcher(MultiSearcher&&) noexcept = default;
+    ~MultiSearcher() = default;
+
+    MultiSearcher& operator=(const MultiSearcher&) = default;
+    MultiSearcher& operator=(MultiSearcher&&) noexcept = default;
+
+    //! Check if the searcher is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the searcher empty?
+    bool empty() const noexcept { return _patterns.empty(); }
+    //! Get the count of patterns
+    size_t size() const noexcept { return _patterns.size(); }
+
+    //! Get the pattern with the given index
+    const std::string& pattern(size_t index) const noexcept { return _patterns[index]; }
+    //! Is the searcher ignore case of ASCII characters?
+    bool ignore_case() const noexcept { return _ignore_case; }
+
+    //! Is the given string contains any pattern?
+    /*!
+        \param str - String to search in
+        \return 'true' if any pattern was found, 'false' if no patterns were found
+    */
+    bool Contains(std::string_view str) const noexcept;
+
+    //! Find the first match in the given string
+    /*!
+        \param str - String to search in
+        \param match - Found match
+        \param position - Position to start search from (default is 0)
+        \return 'true' if any pattern was found, 'false' if no patterns were found
+    */
+    bool Find(std::string_view str, Match& match, size_t position = 0) const noexcept;
+    //! Find all matches in the given string
+    /*!
+        \param str - String to search in
+        \return Vector of matches
+    */
+    std::vector<Match> FindAll(std::string_view str) const;
+
+    //! Count all matches in the given string
+    /*!
+        \param str - String to search in
+        \return Count of all matches
+    */
+    size_t CountAll(std::string_view str) const noexcept;
+
+    //! Replace all matches with the corresponding substrings
+    /*!
+        If the count of substrings is different from the count of patterns
+        the method will raise an argument exception!
+
+        \param str - Modifying string
+        \param with - Substrings to replace corresponding patterns
+        \return 'true' if any pattern was found and replaced, 'false' if no patterns were found
+    */
+    bool ReplaceAll(std::string& str, const std::vector<std::string>& with) const;
+
+    //! Swap two instances
+    void swap(MultiSearcher& searcher) noexcept;
+    friend void swap(MultiSearcher& searcher1, MultiSearcher& searcher2) noexcept;
+
+private:
+    std::vector<std::string> _patterns;
+    bool _ignore_case;
+    // Count of character classes
+    uint32_t _alphabet;
+    // Character classes of bytes
+    uint8_t _classes[256];
+    // Transitions table [state * alphabet + class] with the output flag in the high bit
+    std::vector<uint32_t> _transitions;
+    // Index of the longest pattern which ends in the state
+    std::vector<uint32_t> _outputs;
+    // Start characters of patterns for the vectorized skip
+    std::string _starts;
+};
+
+/*! \example string_multi_searcher.cpp Multiple substrings searcher example */
+
+} // namespace CppCommon
+
+#include "multi_searcher.inl"
+
+#endif // CPPCOMMON_STRING_MULTI_SEARCHER_H
@@ -0,0 +1,34 @@
+/*!
+    \file multi_searcher.inl
+    \brief Multiple substrings searcher inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline bool MultiSearcher::Contains(std::string_view str) const noexcept
+{
+    Match match;
+    return Find(str, match);
+}
+
+inline void MultiSearcher::swap(MultiSearcher& searcher) noexcept
+{
+    using std::swap;
+    swap(_patterns, searcher._patterns);
+    swap(_ignore_case, searcher._ignore_case);
+    swap(_alphabet, searcher._alphabet);
+    swap(_classes, searcher._classes);
+    swap(_transitions, searcher._transitions);
+    swap(_outputs, searcher._outputs);
+    swap(_starts, searcher._starts);
+}
+
+inline void swap(MultiSearcher& searcher1, MultiSearcher& searcher2) noexcept
+{
+    searcher1.swap(searcher2);
+}
+
+} // namespace CppCommon
@@ -0,0 +1,111 @@
+/*!
+    \file pattern_set.h
+    \brief Compiled pattern set definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_PATTERN_SET_H
+#define CPPCOMMON_STRING_PATTERN_SET_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppCommon {
+
+//! Compiled pattern set
+/*!
+    Pattern set contains one or more regular expressions (ECMAScript syntax)
+    which are compiled once and matched against the whole string many times.
+
+    Each pattern is compiled into the cheapest matcher which is able to handle it:
+    - Literals and literals separated with ".*" (e.g. ".*\.txt", "Demo.*")
+      use a glob matcher without any backtracking;
+    - Other regular expressions without back-references or look-around
+      assertions are compiled into a DFA and matched in linear time;
+    - Rest regular expressions fall back to std::regex.
+
+    Matching semantics are the same as in StringUtils::IsPatternMatch():
+    patterns are checked in order, the first matched pattern gives the result
+    ('false' if it has '!' prefix, 'true' otherwise). If no pattern matches,
+    the result is 'true' only if the last pattern has '!' prefix. Invalid
+    patterns never match.
+
+    Not thread-safe for modifications, thread-safe for matching.
+*/
+class PatternSet
+{
+public:
+    //! Initialize an empty pattern set
+    PatternSet() noexcept = default;
+    //! Initialize pattern set with the given patterns
+    /*!
+        Patterns string contains one or more regular expressions separated by ';'.
+        If the regular expression has '!' prefix it treats as 'not matching'.
+
+        \param patterns - Patterns string
+    */
+    explicit PatternSet(const std::string& patterns);
+    PatternSet(const PatternSet&) = default;
+    PatternSet(PatternSet&&) noexcept = default;
+    ~PatternSet() = default;
+
+    PatternSet& operator=(const PatternSet&) = default;
+    PatternSet& operator=(PatternSet&&) noexcept = default;
+
+    //! Check if the pattern set is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the pattern set empty?
+    bool empty() const noexcept { return _patterns.empty(); }
+    //! Get the pattern set size
+    size_t size() const noexcept { return _patterns.size(); }
+
+    //! Add the given regular expression to the pattern set
+    /*!
+        If the regular expression is invalid the method will raise an argument exception!
+
+        \param pattern - Regular expression
+        \param negative - Negative pattern flag (default is false)
+    */
+    void Add(const std::string& pattern, bool negative = false);
+    //! Clear the pattern set
+    void Clear() noexcept { _patterns.clear(); }
+
+    //! Is the given string match to the pattern set?
+    /*!
+        \param str - String to match
+        \return 'true' if given string matches, 'false' if given string does not match
+    */
+    bool Match(std::string_view str) const;
+
+    //! Create the pattern set from a single regular expression
+    /*!
+        Empty regular expression gives an empty pattern set.
+
+        If the regular expression is invalid the method will raise an argument exception!
+
+        \param pattern - Regular expression
+        \return Pattern set
+    */
+    static PatternSet FromRegex(const std::string& pattern);
+
+    //! Swap two instances
+    void swap(PatternSet& patterns) noexcept;
+    friend void swap(PatternSet& patterns1, PatternSet& patterns2) noexcept;
+
+private:
+    struct Pattern;
+    std::vector<std::shared_ptr<const Pattern>> _patterns;
+};
+
+/*! \example string_pattern_set.cpp Compiled pattern set example */
+
+} // namespace CppCommon
+
+#include "pattern_set.inl"
+
+#endif // CPPCOMMON_STRING_PATTERN_SET_H
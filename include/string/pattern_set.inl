@@ -0,0 +1,22 @@
+/*!
+    \file pattern_set.inl
+    \brief Compiled pattern set inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline void PatternSet::swap(PatternSet& patterns) noexcept
+{
+    using std::swap;
+    swap(_patterns, patterns._patterns);
+}
+
+inline void swap(PatternSet& patterns1, PatternSet& patterns2) noexcept
+{
+    patterns1.swap(patterns2);
+}
+
+} // namespace CppCommon
@@ -9,6 +9,10 @@
 #ifndef CPPCOMMON_STRING_STRING_UTILS_H
 #define CPPCOMMON_STRING_STRING_UTILS_H
 
+#include "common/writer.h"
+#include "string/pattern_set.h"
+#include "string/tokenizer.h"
+
 #include <algorithm>
 #include <cctype>
 #include <cstdint>
@@ -67,11 +71,23 @@ public:
             "!Demo.*;!Live.*" + "LiveAccount" -> false
             "!Demo.*;!Live.*" + "UnknownAccount" -> true
 
+        Patterns are compiled on each call, use PatternSet to compile them once.
+
         \param patterns - Patterns to match with
         \param str - String to match
         \return 'true' if given string matches, 'false' if given string does not match
     */
     static bool IsPatternMatch(const std::string& patterns, const std::string& str);
+    //! Is the given string match to the given compiled pattern set?
+    /*!
+        Compile the pattern set once to match many strings without
+        compiling regular expressions on each call.
+
+        \param patterns - Compiled pattern set to match with
+        \param str - String to match
+        \return 'true' if given string matches, 'false' if given string does not match
+    */
+    static bool IsPatternMatch(const PatternSet& patterns, std::string_view str);
 
     //! Convert the given character to lower case
     /*!
@@ -99,12 +115,18 @@ public:
 
     //! Convert the given string to lower case
     /*!
+        Only ASCII characters are converted. Conversion is vectorized
+        with SSE2/AVX2 instructions when they are available.
+
         \param str - String to convert
         \return The same converted string
     */
     static std::string& Lower(std::string& str);
     //! Convert the given string to UPPER case
     /*!
+        Only ASCII characters are converted. Conversion is vectorized
+        with SSE2/AVX2 instructions when they are available.
+
         \param str - String to convert
         \return The same converted string
     */
@@ -170,12 +192,25 @@ public:
     static bool Compare(std::string_view str1, std::string_view str2);
     //! Compare two strings case insensitive version
     /*!
+        Only ASCII characters are compared case insensitive.
+
         \param str1 - First string to compare
         \param str2 - Second string to compare
         \return 'true' if two strings are equal, 'false' if two strings are different
     */
     static bool CompareNoCase(std::string_view str1, std::string_view str2);
 
+    //! Find the first occurrence of substring
+    /*!
+        Substring is searched with SSE2/AVX2 instructions when they are available.
+
+        \param str - String to search in
+        \param substr - Substring to find
+        \param position - Position to start search from (default is 0)
+        \return Position of the first substring occurrence or std::string::npos if the substring was not found
+    */
+    static size_t Find(std::string_view str, std::string_view substr, size_t position = 0);
+
     //! Is the given string contains the given character?
     /*!
         \param str - String to search in
@@ -198,9 +233,11 @@ public:
     */
     static bool Contains(std::string_view str, std::string_view substr);
 
-    //! Count all occurrences of substring
+    //! Count all non-overlapping occurrences of substring
     /*!
-        \param str - Modifying string
+        Empty substring is never counted.
+
+        \param str - String to search in
         \param substr - Substring to find
         \return Count of all substring occurrences
     */
@@ -224,6 +261,8 @@ public:
     static bool ReplaceLast(std::string& str, std::string_view substr, std::string_view with);
     //! Replace all occurrences of substring with another substring
     /*!
+        Empty substring is never replaced.
+
         \param str - Modifying string
         \param substr - Substring to find
         \param with - Substring to replace
@@ -271,6 +310,37 @@ public:
     */
     static std::vector<std::string> SplitByAny(std::string_view str, std::string_view delimiters, bool skip_empty = false);
 
+    //! Lazily split the string into string view tokens by the given delimiter character
+    /*!
+        Tokens are not allocated and refer to the given string.
+
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return String tokenizer
+    */
+    static StringTokenizer Tokenize(std::string_view str, char delimiter, bool skip_empty = false) noexcept;
+    //! Lazily split the string into string view tokens by the given delimiter string
+    /*!
+        Tokens are not allocated and refer to the given string.
+
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return String tokenizer
+    */
+    static StringTokenizer Tokenize(std::string_view str, std::string_view delimiter, bool skip_empty = false) noexcept;
+    //! Lazily split the string into string view tokens by the any character in the given delimiter string
+    /*!
+        Tokens are not allocated and refer to the given string.
+
+        \param str - String to split
+        \param delimiters - Delimiters string
+        \param skip_empty - Skip empty substrings flag (default is false)
+        \return String tokenizer
+    */
+    static StringTokenizer TokenizeByAny(std::string_view str, std::string_view delimiters, bool skip_empty = false) noexcept;
+
     //! Join tokens into the string
     /*!
         \param tokens - Vector of string tokens
@@ -307,6 +377,50 @@ public:
     */
     static std::string Join(const std::vector<std::string>& tokens, std::string_view delimiter, bool skip_empty = false, bool skip_blank = false);
 
+    //! Join tokens with delimiter character and append the result to the given buffer
+    /*!
+        Tokens could be any range of strings or string views (vector, tokenizer).
+        Delimiter is placed only between joined tokens.
+
+        \param result - Buffer to append joined tokens
+        \param tokens - Range of tokens
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \param skip_blank - Skip blank tokens flag (default is false)
+        \return Result buffer
+    */
+    template <class TTokens>
+    static std::string& Join(std::string& result, TTokens&& tokens, char delimiter, bool skip_empty = false, bool skip_blank = false);
+    //! Join tokens with delimiter string and append the result to the given buffer
+    /*!
+        Tokens could be any range of strings or string views (vector, tokenizer).
+        Delimiter is placed only between joined tokens.
+
+        \param result - Buffer to append joined tokens
+        \param tokens - Range of tokens
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \param skip_blank - Skip blank tokens flag (default is false)
+        \return Result buffer
+    */
+    template <class TTokens>
+    static std::string& Join(std::string& result, TTokens&& tokens, std::string_view delimiter, bool skip_empty = false, bool skip_blank = false);
+    //! Join tokens with delimiter string and write the result into the given writer
+    /*!
+        Tokens and delimiters are written with gather writes without any
+        intermediate buffer, so tokens must refer to the stable storage
+        (strings in the container or string views).
+
+        \param writer - Writer to write joined tokens
+        \param tokens - Range of tokens
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \param skip_blank - Skip blank tokens flag (default is false)
+        \return Count of written bytes
+    */
+    template <class TTokens>
+    static size_t Join(Writer& writer, TTokens&& tokens, std::string_view delimiter, bool skip_empty = false, bool skip_blank = false);
+
     //! Converts arbitrary datatypes into string using std::ostringstream
     /*!
         \param value - Value to convert
@@ -18,9 +18,14 @@ inline bool StringUtils::IsBlank(char ch)
     return IsBlankInternal(ch);
 }
 
+inline bool StringUtils::IsPatternMatch(const PatternSet& patterns, std::string_view str)
+{
+    return patterns.Match(str);
+}
+
 inline char StringUtils::ToLowerInternal(char ch)
 {
-    return (char)std::tolower(ch);
+    return ((ch >= 'A') && (ch <= 'Z')) ? (char)(ch | 0x20) : ch;
 }
 
 inline char StringUtils::ToLower(char ch)
@@ -30,7 +35,7 @@ inline char StringUtils::ToLower(char ch)
 
 inline char StringUtils::ToUpperInternal(char ch)
 {
-    return (char)std::toupper(ch);
+    return ((ch >= 'a') && (ch <= 'z')) ? (char)(ch & ~0x20) : ch;
 }
 
 inline char StringUtils::ToUpper(char ch)
@@ -52,18 +57,6 @@ inline std::string StringUtils::ToUpper(std::string_view str)
     return result;
 }
 
-inline std::string& StringUtils::Lower(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToLowerInternal);
-    return str;
-}
-
-inline std::string& StringUtils::Upper(std::string& str)
-{
-    std::transform(str.begin(), str.end(), str.begin(), ToUpperInternal);
-    return str;
-}
-
 inline std::string& StringUtils::Trim(std::string& str)
 {
     return LTrim(RTrim(str));
@@ -89,12 +82,12 @@ inline bool StringUtils::Contains(std::string_view str, const char ch)
 
 inline bool StringUtils::Contains(std::string_view str, const char* substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return (Find(str, substr) != std::string::npos);
 }
 
 inline bool StringUtils::Contains(std::string_view str, std::string_view substr)
 {
-    return (str.find(substr) != std::string::npos);
+    return (Find(str, substr) != std::string::npos);
 }
 
 inline bool StringUtils::StartsWith(std::string_view str, std::string_view prefix)
@@ -107,6 +100,95 @@ inline bool StringUtils::EndsWith(std::string_view str, std::string_view suffix)
     return (str.size() >= suffix.size()) && (str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
 }
 
+inline StringTokenizer StringUtils::Tokenize(std::string_view str, char delimiter, bool skip_empty) noexcept
+{
+    return StringTokenizer(str, delimiter, skip_empty);
+}
+
+inline StringTokenizer StringUtils::Tokenize(std::string_view str, std::string_view delimiter, bool skip_empty) noexcept
+{
+    return StringTokenizer(str, delimiter, skip_empty);
+}
+
+inline StringTokenizer StringUtils::TokenizeByAny(std::string_view str, std::string_view delimiters, bool skip_empty) noexcept
+{
+    return StringTokenizer::ByAny(str, delimiters, skip_empty);
+}
+
+template <class TTokens>
+inline std::string& StringUtils::Join(std::string& result, TTokens&& tokens, char delimiter, bool skip_empty, bool skip_blank)
+{
+    return Join(result, std::forward<TTokens>(tokens), std::string_view(&delimiter, 1), skip_empty, skip_blank);
+}
+
+template <class TTokens>
+inline std::string& StringUtils::Join(std::string& result, TTokens&& tokens, std::string_view delimiter, bool skip_empty, bool skip_blank)
+{
+    bool first = true;
+    for (auto&& token : tokens)
+    {
+        std::string_view view(token);
+        if ((skip_empty && view.empty()) || (skip_blank && IsBlank(view)))
+            continue;
+
+        if (!first)
+            result.append(delimiter);
+        result.append(view);
+        first = false;
+    }
+    return result;
+}
+
+template <class TTokens>
+inline size_t StringUtils::Join(Writer& writer, TTokens&& tokens, std::string_view delimiter, bool skip_empty, bool skip_blank)
+{
+    typedef decltype(*std::begin(tokens)) token_t;
+    static_assert(std::is_lvalue_reference_v<token_t> || std::is_same_v<std::decay_t<token_t>, std::string_view>, "Tokens must refer to the stable storage!");
+
+    // Gather tokens and delimiters into batches of write buffers
+    ConstIOBuffer buffers[64];
+    size_t count = 0;
+    size_t requested = 0;
+    size_t written = 0;
+
+    bool first = true;
+    for (auto&& token : tokens)
+    {
+        std::string_view view(token);
+        if ((skip_empty && view.empty()) || (skip_blank && IsBlank(view)))
+            continue;
+
+        // Flush the full batch
+        if ((count + 2) > std::size(buffers))
+        {
+            size_t bytes = writer.WriteV(std::span<const ConstIOBuffer>(buffers, count));
+            written += bytes;
+            if (bytes < requested)
+                return written;
+            count = 0;
+            requested = 0;
+        }
+
+        if (!first && !delimiter.empty())
+        {
+            buffers[count++] = { delimiter.data(), delimiter.size() };
+            requested += delimiter.size();
+        }
+        if (!view.empty())
+        {
+            buffers[count++] = { view.data(), view.size() };
+            requested += view.size();
+        }
+        first = false;
+    }
+
+    // Flush the last batch
+    if (count > 0)
+        written += writer.WriteV(std::span<const ConstIOBuffer>(buffers, count));
+
+    return written;
+}
+
 template <typename T>
 inline std::string StringUtils::ToString(const T& value)
 {
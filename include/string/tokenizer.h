@@ -0,0 +1,158 @@
+/*!
+    \file tokenizer.h
+    \brief String tokenizer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_STRING_TOKENIZER_H
+#define CPPCOMMON_STRING_TOKENIZER_H
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+
+namespace CppCommon {
+
+//! String tokenizer
+/*!
+    String tokenizer lazily splits the string into tokens without any memory
+    allocation. Each token is a string view into the source string, so the
+    source string must outlive the tokenizer and all its tokens.
+
+    Tokens could be pulled one by one with Next() method or iterated with
+    the range-based for loop. Splitting semantics are the same as in
+    StringUtils::Split() and StringUtils::SplitByAny(): empty string gives
+    one empty token, delimiters at the start or at the end of the string
+    give empty tokens unless 'skip_empty' flag is set.
+
+    Single character delimiter is searched with memchr() which is vectorized
+    by the C runtime. Delimiter sets use SSE2 comparison of 16 characters
+    at once if the set contains up to 8 characters and a lookup table otherwise.
+
+    Not thread-safe.
+*/
+class StringTokenizer
+{
+public:
+    //! String tokenizer iterator
+    class Iterator
+    {
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef std::string_view value_type;
+        typedef ptrdiff_t difference_type;
+        typedef const std::string_view* pointer;
+        typedef const std::string_view& reference;
+
+        Iterator() noexcept : _tokenizer(nullptr), _end(true) {}
+        Iterator(const Iterator&) noexcept = default;
+        Iterator(Iterator&&) noexcept = default;
+        ~Iterator() noexcept = default;
+
+        Iterator& operator=(const Iterator&) noexcept = default;
+        Iterator& operator=(Iterator&&) noexcept = default;
+
+        friend bool operator==(const Iterator& it1, const Iterator& it2) noexcept
+        { return (it1._end && it2._end) || (!it1._end && !it2._end && (it1._token.data() == it2._token.data()) && (it1._token.size() == it2._token.size())); }
+        friend bool operator!=(const Iterator& it1, const Iterator& it2) noexcept
+        { return !(it1 == it2); }
+
+        Iterator& operator++() noexcept;
+        Iterator operator++(int) noexcept;
+
+        reference operator*() const noexcept { return _token; }
+        pointer operator->() const noexcept { return &_token; }
+
+    private:
+        StringTokenizer* _tokenizer;
+        std::string_view _token;
+        bool _end;
+
+        explicit Iterator(StringTokenizer* tokenizer) noexcept;
+
+        friend class StringTokenizer;
+    };
+
+    //! Initialize string tokenizer with the delimiter character
+    /*!
+        \param str - String to split
+        \param delimiter - Delimiter character
+        \param skip_empty - Skip empty tokens flag (default is false)
+    */
+    StringTokenizer(std::string_view str, char delimiter, bool skip_empty = false) noexcept;
+    //! Initialize string tokenizer with the delimiter string
+    /*!
+        Empty delimiter string gives the whole string as a single token.
+
+        \param str - String to split
+        \param delimiter - Delimiter string
+        \param skip_empty - Skip empty tokens flag (default is false)
+    */
+    StringTokenizer(std::string_view str, std::string_view delimiter, bool skip_empty = false) noexcept;
+    StringTokenizer(const StringTokenizer&) noexcept = default;
+    StringTokenizer(StringTokenizer&&) noexcept = default;
+    ~StringTokenizer() noexcept = default;
+
+    StringTokenizer& operator=(const StringTokenizer&) noexcept = default;
+    StringTokenizer& operator=(StringTokenizer&&) noexcept = default;
+
+    //! Create string tokenizer which splits by any character in the given delimiters string
+    /*!
+        \param str - String to split
+        \param delimiters - Delimiter characters
+        \param skip_empty - Skip empty tokens flag (default is false)
+        \return String tokenizer
+    */
+    static StringTokenizer ByAny(std::string_view str, std::string_view delimiters, bool skip_empty = false) noexcept;
+
+    //! Get the source string
+    std::string_view str() const noexcept { return _str; }
+    //! Get the rest of the source string which is not tokenized yet
+    std::string_view rest() const noexcept { return _finished ? std::string_view() : _str.substr(_position); }
+
+    //! Get the next token
+    /*!
+        \param token - Token view into the source string
+        \return 'true' if the token was extracted, 'false' if there are no more tokens
+    */
+    bool Next(std::string_view& token) noexcept;
+
+    //! Reset the tokenizer to the start of the source string
+    void Reset() noexcept { _position = 0; _finished = false; }
+
+    //! Get the iterator to the next token
+    /*!
+        Iteration consumes tokens of the tokenizer.
+    */
+    Iterator begin() noexcept { return Iterator(this); }
+    //! Get the end iterator
+    Iterator end() noexcept { return Iterator(); }
+
+private:
+    enum class Mode { CHARACTER, STRING, ANY };
+
+    std::string_view _str;
+    std::string_view _delimiter;
+    char _character;
+    Mode _mode;
+    bool _skip_empty;
+    bool _finished;
+    size_t _position;
+    uint64_t _table[4];
+
+    StringTokenizer() noexcept = default;
+
+    size_t Find(size_t position) const noexcept;
+    size_t FindAny(size_t position) const noexcept;
+};
+
+/*! \example string_tokenizer.cpp String tokenizer example */
+
+} // namespace CppCommon
+
+#include "tokenizer.inl"
+
+#endif // CPPCOMMON_STRING_TOKENIZER_H
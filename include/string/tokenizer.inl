@@ -0,0 +1,81 @@
+/*!
+    \file tokenizer.inl
+    \brief String tokenizer inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+inline StringTokenizer::Iterator::Iterator(StringTokenizer* tokenizer) noexcept
+    : _tokenizer(tokenizer), _end(false)
+{
+    ++(*this);
+}
+
+inline StringTokenizer::Iterator& StringTokenizer::Iterator::operator++() noexcept
+{
+    _end = !_tokenizer->Next(_token);
+    return *this;
+}
+
+inline StringTokenizer::Iterator StringTokenizer::Iterator::operator++(int) noexcept
+{
+    Iterator result(*this);
+    ++(*this);
+    return result;
+}
+
+inline StringTokenizer::StringTokenizer(std::string_view str, char delimiter, bool skip_empty) noexcept
+    : _str(str), _character(delimiter), _mode(Mode::CHARACTER), _skip_empty(skip_empty), _finished(false), _position(0), _table()
+{
+}
+
+inline StringTokenizer::StringTokenizer(std::string_view str, std::string_view delimiter, bool skip_empty) noexcept
+    : _str(str), _delimiter(delimiter), _character(0), _mode(Mode::STRING), _skip_empty(skip_empty), _finished(false), _position(0), _table()
+{
+}
+
+inline size_t StringTokenizer::Find(size_t position) const noexcept
+{
+    switch (_mode)
+    {
+        case Mode::CHARACTER:
+        {
+            if (position >= _str.size())
+                return std::string_view::npos;
+            const void* found = std::memchr(_str.data() + position, (uint8_t)_character, _str.size() - position);
+            return (found != nullptr) ? ((const char*)found - _str.data()) : std::string_view::npos;
+        }
+        case Mode::STRING:
+            return _delimiter.empty() ? std::string_view::npos : _str.find(_delimiter, position);
+        default:
+            return FindAny(position);
+    }
+}
+
+inline bool StringTokenizer::Next(std::string_view& token) noexcept
+{
+    while (!_finished)
+    {
+        size_t position = Find(_position);
+        if (position == std::string_view::npos)
+        {
+            token = _str.substr(_position);
+            _finished = true;
+        }
+        else
+        {
+            token = _str.substr(_position, position - _position);
+            _position = position + ((_mode == Mode::STRING) ? _delimiter.size() : 1);
+        }
+
+        if (!_skip_empty || !token.empty())
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace CppCommon
@@ -17,7 +17,7 @@ namespace CppCommon {
 //! CPU management static class
 /*!
     Provides CPU management functionality such as architecture, cores count,
-    clock speed, Hyper-Threading feature.
+    clock speed, Hyper-Threading feature and supported instruction sets.
 
     Thread-safe.
 */
@@ -46,6 +46,11 @@ public:
     static int64_t ClockSpeed();
     //! Is CPU Hyper-Threading enabled?
     static bool HyperThreading();
+
+    //! Is SSSE3 instruction set supported?
+    static bool HasSSSE3();
+    //! Is AVX2 instruction set supported (by CPU and OS)?
+    static bool HasAVX2();
 };
 
 /*! \example system_cpu.cpp CPU management example */
@@ -12,6 +12,7 @@
 #include "common/reader.h"
 #include "common/writer.h"
 #include "errors/exceptions.h"
+#include "time/timespan.h"
 
 #include <memory>
 
@@ -25,12 +26,23 @@ namespace CppCommon {
     other process reads the information from the pipe. This overview describes  how
     to create, manage, and use pipes.
 
+    Pipe is created in blocking mode with the default system capacity (64 KB on
+    Linux). In non-blocking mode read, write and splice methods return zero
+    instead of blocking and set the would-block flag, which tells them apart
+    from the end of the pipe. Such pipe should be polled with WaitRead()/WaitWrite() methods
+    or drained with PipeMultiplexer.
+
     Not thread-safe.
 */
 class Pipe : public Reader, public Writer
 {
 public:
     Pipe();
+    //! Create a new pipe with the given capacity
+    /*!
+        \param capacity - Pipe capacity in bytes (rounded up by the system)
+    */
+    explicit Pipe(size_t capacity);
     Pipe(const Pipe&) = delete;
     Pipe(Pipe&& pipe) = delete;
     virtual ~Pipe();
@@ -50,6 +62,51 @@ public:
     //! Is pipe opened for writing?
     bool IsPipeWriteOpened() const noexcept;
 
+    //! Get the pipe capacity in bytes
+    size_t capacity() const;
+    //! Is pipe in blocking mode?
+    bool IsBlocking() const;
+    //! Is the last read, write or splice operation stopped because the non-blocking pipe was not ready?
+    /*!
+        Zero result of read, write and splice methods means the closed other
+        side of the pipe (or the end of the splice source) unless this flag is set.
+    */
+    bool IsWouldBlock() const noexcept;
+
+    //! Set the pipe capacity
+    /*!
+        Pipe capacity is changed with F_SETPIPE_SZ on Linux and rounded up
+        to the page size power of two. Unprivileged processes are limited
+        with /proc/sys/fs/pipe-max-size. Other platforms keep the capacity
+        the pipe was created with.
+
+        \param capacity - Pipe capacity in bytes
+        \return Actual pipe capacity in bytes
+    */
+    size_t SetCapacity(size_t capacity);
+    //! Set blocking mode of both pipe endpoints
+    /*!
+        \param blocking - Blocking mode flag
+    */
+    void SetBlocking(bool blocking);
+
+    //! Wait until the pipe has data to read or its write endpoint is closed
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait
+        \return 'true' if the pipe is ready for reading, 'false' if the timeout was reached
+    */
+    bool WaitRead(const Timespan& timespan);
+    //! Wait until the pipe has free space to write
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait
+        \return 'true' if the pipe is ready for writing, 'false' if the timeout was reached
+    */
+    bool WaitWrite(const Timespan& timespan);
+
     //! Read a bytes buffer from the pipe
     /*!
         If the pipe is not opened for reading the method will raise
@@ -57,7 +114,7 @@ public:
 
         \param buffer - Buffer to read
         \param size - Buffer size
-        \return Count of read bytes
+        \return Count of read bytes (0 if the write endpoint is closed or no data is available in non-blocking mode, see IsWouldBlock())
     */
     size_t Read(void* buffer, size_t size) override;
 
@@ -72,12 +129,75 @@ public:
 
         \param buffer - Buffer to write
         \param size - Buffer size
-        \return Count of written bytes
+        \return Count of written bytes (0 if the pipe is full in non-blocking mode, see IsWouldBlock())
     */
     size_t Write(const void* buffer, size_t size) override;
 
     using Writer::Write;
 
+    //! Read into multiple buffers from the pipe with a single readv() call (scatter read)
+    /*!
+        If the pipe is not opened for reading the method will raise
+        a system exception!
+
+        \param buffers - Buffers to read
+        \return Total count of read bytes
+    */
+    size_t ReadV(std::span<const IOBuffer> buffers) override;
+    //! Write multiple buffers into the pipe with a single writev() call (gather write)
+    /*!
+        If the pipe is not opened for writing the method will raise
+        a system exception!
+
+        \param buffers - Buffers to write
+        \return Total count of written bytes
+    */
+    size_t WriteV(std::span<const ConstIOBuffer> buffers) override;
+
+    //! Move data from the given native handle into the pipe
+    /*!
+        Data is moved with splice() on Linux without copying into the user
+        space. Other platforms and descriptors which do not support splicing
+        fall back to the user space transfer. Native handle could be a file
+        descriptor (e.g. File::native() of the unbuffered file), a socket or
+        another pipe endpoint.
+
+        If the pipe is not opened for writing the method will raise
+        a system exception!
+
+        \param handle - Native source handle
+        \param size - Maximal size of data to move
+        \return Count of moved bytes (0 if the end of the source is met or the transfer would block in non-blocking mode, see IsWouldBlock())
+    */
+    size_t SpliceFrom(void* handle, size_t size);
+    //! Move data from the pipe into the given native handle
+    /*!
+        Data is moved with splice() on Linux without copying into the user
+        space. Other platforms and descriptors which do not support splicing
+        fall back to the user space transfer.
+
+        If the pipe is not opened for reading the method will raise
+        a system exception!
+
+        \param handle - Native destination handle
+        \param size - Maximal size of data to move
+        \return Count of moved bytes (0 if the pipe write endpoint is closed or the transfer would block in non-blocking mode, see IsWouldBlock())
+    */
+    size_t SpliceTo(void* handle, size_t size);
+    //! Map multiple user buffers into the pipe
+    /*!
+        Buffer pages are mapped into the pipe with vmsplice() on Linux without
+        copying, so buffers must not be modified until the pipe data is read
+        by the other side. Other platforms fall back to WriteV() method.
+
+        If the pipe is not opened for writing the method will raise
+        a system exception!
+
+        \param buffers - Buffers to map
+        \return Total count of mapped bytes (0 if the pipe is full in non-blocking mode, see IsWouldBlock())
+    */
+    size_t SpliceV(std::span<const ConstIOBuffer> buffers);
+
     //! Close the read pipe endpoint
     void CloseRead();
     //! Close the write pipe endpoint
@@ -96,7 +216,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 16;
+    static const size_t StorageSize = 24;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     static const size_t StorageAlign = 4;
 #else
@@ -0,0 +1,118 @@
+/*!
+    \file pipe_multiplexer.h
+    \brief Pipe multiplexer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_PIPE_MULTIPLEXER_H
+#define CPPCOMMON_SYSTEM_PIPE_MULTIPLEXER_H
+
+#include "system/pipe.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace CppCommon {
+
+//! Pipe multiplexer
+/*!
+    Pipe multiplexer drains many pipes (e.g. output pipes of child processes)
+    from a single thread. It waits for readiness of all registered pipes with
+    a single poll() call and reads only from ready pipes, so no thread is
+    blocked on a single pipe.
+
+    Each chunk of pipe data is passed to the pipe handler. When the write
+    endpoint of the pipe is closed and all its data is consumed, the handler
+    is called with the zero size and the pipe is removed from the multiplexer.
+
+    Handlers may add or remove pipes of the multiplexer. Added pipes are polled
+    starting from the next Poll() call, removed pipes are not handled anymore.
+
+    Not thread-safe.
+*/
+class PipeMultiplexer
+{
+public:
+    //! Pipe data handler
+    /*!
+        \param pipe - Ready pipe
+        \param buffer - Pipe data buffer
+        \param size - Pipe data size (0 if the pipe write endpoint is closed)
+    */
+    typedef std::function<void(Pipe& pipe, const void* buffer, size_t size)> Handler;
+
+    //! Initialize the pipe multiplexer with a given read buffer size
+    /*!
+        \param buffer - Read buffer size (default is 65536)
+    */
+    explicit PipeMultiplexer(size_t buffer = 65536);
+    PipeMultiplexer(const PipeMultiplexer&) = delete;
+    PipeMultiplexer(PipeMultiplexer&&) = default;
+    ~PipeMultiplexer() = default;
+
+    PipeMultiplexer& operator=(const PipeMultiplexer&) = delete;
+    PipeMultiplexer& operator=(PipeMultiplexer&&) = default;
+
+    //! Check if the pipe multiplexer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the pipe multiplexer empty?
+    bool empty() const noexcept { return _pipes.empty(); }
+    //! Get the count of registered pipes
+    size_t size() const noexcept { return _pipes.size(); }
+
+    //! Register the pipe with the given data handler
+    /*!
+        If the pipe is not opened for reading the method will raise
+        a system exception!
+
+        \param pipe - Pipe to drain
+        \param handler - Pipe data handler
+    */
+    void Add(Pipe& pipe, const Handler& handler);
+    //! Unregister the pipe
+    /*!
+        \param pipe - Pipe to unregister
+        \return 'true' if the pipe was unregistered, 'false' if the pipe was not found
+    */
+    bool Remove(Pipe& pipe);
+
+    //! Wait for ready pipes and drain them
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait (negative value means infinite wait)
+        \return Count of handled bytes
+    */
+    size_t Poll(const Timespan& timespan);
+    //! Drain all registered pipes until their write endpoints are closed
+    /*!
+        Will block.
+
+        \return Count of handled bytes
+    */
+    size_t Drain();
+
+private:
+    struct Entry
+    {
+        Pipe* pipe;
+        Handler handler;
+        bool removed;
+    };
+
+    std::vector<std::unique_ptr<Entry>> _pipes;
+    std::vector<uint8_t> _buffer;
+    // Pipes removed by handlers are destroyed after dispatching
+    std::vector<std::unique_ptr<Entry>> _removed;
+    bool _dispatching;
+};
+
+/*! \example system_pipe_multiplexer.cpp Pipe multiplexer example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_PIPE_MULTIPLEXER_H
@@ -0,0 +1,175 @@
+/*!
+    \file reactor.h
+    \brief Event loop reactor definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_SYSTEM_REACTOR_H
+#define CPPCOMMON_SYSTEM_REACTOR_H
+
+#include "system/pipe.h"
+#include "system/process.h"
+#include "time/timespan.h"
+
+#include <functional>
+#include <memory>
+
+namespace CppCommon {
+
+//! Event loop reactor
+/*!
+    Reactor waits for many event sources in a single thread and dispatches
+    their handlers in the thread which calls Poll() or Run() methods:
+    - pipes are drained when they become readable (edge-triggered);
+    - processes are reported when they exit (pidfd);
+    - timers are fired once or periodically (timerfd);
+    - events are fired when they are signaled from any thread (eventfd).
+
+    Each registered source gets a unique reactor token which could be
+    used to remove it. Handlers are allowed to add and remove sources,
+    including themselves.
+
+    Reactor events have the auto-reset semantic: many signals before
+    the handler is dispatched are coalesced into a single handler call.
+
+    Signal() and Stop() methods are thread-safe, all other methods must
+    be called from the reactor thread.
+
+    Reactor is implemented with epoll and available only on Linux.
+*/
+class Reactor
+{
+public:
+    //! Reactor token of the registered source
+    typedef uint64_t Token;
+
+    //! Pipe data handler
+    /*!
+        \param pipe - Ready pipe
+        \param buffer - Pipe data buffer
+        \param size - Pipe data size (0 if the pipe write endpoint is closed)
+    */
+    typedef std::function<void(Pipe& pipe, const void* buffer, size_t size)> PipeHandler;
+    //! Process exit handler
+    /*!
+        \param process - Exited process
+        \param result - Process exit code
+    */
+    typedef std::function<void(Process& process, int result)> ProcessHandler;
+    //! Timer or event handler
+    typedef std::function<void()> Handler;
+
+    //! Initialize the reactor with a given pipe read buffer size
+    /*!
+        If the reactor is not supported by the current platform the method
+        will raise a system exception!
+
+        \param buffer - Pipe read buffer size (default is 65536)
+    */
+    explicit Reactor(size_t buffer = 65536);
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    ~Reactor();
+
+    Reactor& operator=(const Reactor&) = delete;
+    Reactor& operator=(Reactor&&) = delete;
+
+    //! Check if the reactor is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the reactor empty?
+    bool empty() const noexcept { return size() == 0; }
+    //! Get the count of registered sources
+    size_t size() const noexcept;
+
+    //! Register the pipe with the given data handler
+    /*!
+        The pipe is switched into the non-blocking mode. When the write
+        endpoint of the pipe is closed and all its data is consumed, the
+        handler is called with the zero size and the pipe is removed from
+        the reactor.
+
+        If the pipe is not opened for reading the method will raise
+        a system exception!
+
+        \param pipe - Pipe to drain
+        \param handler - Pipe data handler
+        \return Reactor token
+    */
+    Token AddPipe(Pipe& pipe, const PipeHandler& handler);
+    //! Register the process with the given exit handler
+    /*!
+        The process is removed from the reactor after its exit handler
+        is called.
+
+        \param process - Process to watch
+        \param handler - Process exit handler
+        \return Reactor token
+    */
+    Token AddProcess(Process& process, const ProcessHandler& handler);
+    //! Register the timer with the given handler
+    /*!
+        One-shot timer is removed from the reactor after its handler
+        is called.
+
+        \param timeout - Timer timeout
+        \param handler - Timer handler
+        \param periodic - Periodic timer flag (default is false)
+        \return Reactor token
+    */
+    Token AddTimer(const Timespan& timeout, const Handler& handler, bool periodic = false);
+    //! Register the event with the given handler
+    /*!
+        \param handler - Event handler
+        \return Reactor token
+    */
+    Token AddEvent(const Handler& handler);
+
+    //! Unregister the source
+    /*!
+        \param token - Reactor token
+        \return 'true' if the source was unregistered, 'false' if the source was not found
+    */
+    bool Remove(Token token);
+
+    //! Signal the event
+    /*!
+        Thread-safe.
+
+        \param token - Reactor token of the event
+        \return 'true' if the event was signaled, 'false' if the event was not found
+    */
+    bool Signal(Token token);
+
+    //! Wait for ready sources and dispatch their handlers
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait (negative value means infinite wait)
+        \return Count of dispatched handlers
+    */
+    size_t Poll(const Timespan& timespan);
+    //! Dispatch handlers until the reactor is stopped
+    /*!
+        Will block.
+    */
+    void Run();
+    //! Stop the reactor
+    /*!
+        Wakes up the reactor thread and makes the current or the next
+        Run() method call to return. Thread-safe.
+    */
+    void Stop();
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> _pimpl;
+};
+
+/*! \example system_reactor.cpp Event loop reactor example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_SYSTEM_REACTOR_H
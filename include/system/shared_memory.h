@@ -9,6 +9,7 @@
 #ifndef CPPCOMMON_SYSTEM_SHARED_MEMORY_H
 #define CPPCOMMON_SYSTEM_SHARED_MEMORY_H
 
+#include "common/flags.h"
 #include "errors/exceptions.h"
 
 #include <memory>
@@ -16,11 +17,25 @@
 
 namespace CppCommon {
 
+//! Shared memory flags
+enum class SharedMemoryFlags
+{
+    NONE       = 0x0,   //!< None
+    HUGE_PAGES = 0x1,   //!< Back the shared memory with huge pages (hugetlbfs on Linux, large pages on Windows) or transparent huge pages if they are not available
+    POPULATE   = 0x2,   //!< Pre-fault all shared memory pages
+    LOCK       = 0x4    //!< Lock all shared memory pages in RAM
+};
+
 //! Shared memory manager
 /*!
     Shared memory manager allows to create named memory buffers shared between multiple processes.
     This is one of the common ways to organize different kinds of IPC (inter-process communication).
 
+    Large shared memory blocks may be backed with huge pages to reduce TLB pressure, pre-faulted,
+    locked in RAM and bound to the given NUMA node. All processes must open the shared memory
+    block with the same flags, because huge pages blocks are placed into a separate namespace
+    (hugetlbfs mount on Linux).
+
     Not thread-safe.
 
     https://en.wikipedia.org/wiki/Shared_memory_(interprocess_communication)
@@ -30,10 +45,16 @@ class SharedMemory
 public:
     //! Create a new or open existing block of shared memory with a given name and size
     /*!
+        If the shared memory block cannot be locked in RAM or bound to the NUMA node,
+        or the huge pages block of the owner cannot be mapped the method will raise
+        a system exception!
+
         \param name - Shared memory block name
         \param size - Shared memory block size
+        \param flags - Shared memory flags (default is SharedMemoryFlags::NONE)
+        \param node - NUMA node to bind the shared memory pages or -1 for the default placement (default is -1)
     */
-    explicit SharedMemory(const std::string& name, size_t size);
+    explicit SharedMemory(const std::string& name, size_t size, const Flags<SharedMemoryFlags>& flags = SharedMemoryFlags::NONE, int node = -1);
     SharedMemory(const SharedMemory&) = delete;
     SharedMemory(SharedMemory&& shmem) = delete;
     ~SharedMemory();
@@ -48,6 +69,10 @@ public:
     const std::string& name() const noexcept { return _name; }
     //! Get the shared memory block size
     size_t size() const noexcept { return _size; }
+    //! Get the shared memory block flags
+    const Flags<SharedMemoryFlags>& flags() const noexcept { return _flags; }
+    //! Get the shared memory block NUMA node (-1 for the default placement)
+    int node() const noexcept { return _node; }
 
     //! Get the shared memory block pointer
     void* ptr();
@@ -56,6 +81,8 @@ public:
 
     //! Get the shared memory owner flag (true if the new one was created, false if the existing one was opened)
     bool owner() const;
+    //! Is the shared memory block backed with huge pages (hugetlbfs on Linux, large pages on Windows)?
+    bool huge() const;
 
 private:
     class Impl;
@@ -69,10 +96,14 @@ private:
 
     std::string _name;
     size_t _size;
+    Flags<SharedMemoryFlags> _flags;
+    int _node;
 };
 
 /*! \example system_shared_memory.cpp Shared memory manager example */
 
 } // namespace CppCommon
 
+ENUM_FLAGS(CppCommon::SharedMemoryFlags)
+
 #endif // CPPCOMMON_SYSTEM_SHARED_MEMORY_H
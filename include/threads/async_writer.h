@@ -0,0 +1,152 @@
+/*!
+    \file async_writer.h
+    \brief Asynchronous buffered writer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_ASYNC_WRITER_H
+#define CPPCOMMON_THREADS_ASYNC_WRITER_H
+
+#include "common/writer.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/spsc_ring_buffer.h"
+
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace CppCommon {
+
+//! Asynchronous writer backpressure policy
+enum class AsyncWriterPolicy
+{
+    BLOCK,  //!< Block the writing thread until the ring buffer has enough free space
+    DROP,   //!< Drop the whole written buffer if the ring buffer has not enough free space
+    EXPAND  //!< Store the written buffer into the unbounded overflow list
+};
+
+//! Asynchronous buffered writer
+/*!
+    Asynchronous writer decorates any other writer and moves all writes into
+    the background thread. Written buffers are copied into the ring buffer and
+    the background thread drains it with large coalesced writes into the
+    underlying writer. So writing threads never wait for a slow disk or pipe
+    and never make system calls unless the ring buffer is full and the block
+    policy is used.
+
+    Write order of all threads is preserved: concurrent writers are serialized
+    with a short critical section around copying into the ring buffer, and
+    each written buffer is never interleaved with other buffers.
+
+    Flush() is a barrier: it returns only when all buffers written before the
+    call are written into the underlying writer and the underlying writer is
+    flushed.
+
+    If the underlying writer fails the error is stored, all further written
+    buffers are dropped and the error is raised from the next Flush() or
+    Close() call.
+
+    Thread-safe.
+*/
+class AsyncWriter : public Writer
+{
+public:
+    //! Default ring buffer capacity
+    static const size_t DEFAULT_CAPACITY = 1048576;
+
+    //! Start the asynchronous writer over the given writer
+    /*!
+        \param writer - Underlying writer (must outlive the asynchronous writer)
+        \param capacity - Ring buffer capacity which is rounded up to the power of two (default is DEFAULT_CAPACITY)
+        \param policy - Backpressure policy (default is AsyncWriterPolicy::BLOCK)
+    */
+    explicit AsyncWriter(Writer& writer, size_t capacity = DEFAULT_CAPACITY, AsyncWriterPolicy policy = AsyncWriterPolicy::BLOCK);
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter(AsyncWriter&&) = delete;
+    virtual ~AsyncWriter();
+
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(AsyncWriter&&) = delete;
+
+    //! Get the ring buffer capacity
+    size_t capacity() const noexcept { return _buffer.capacity(); }
+    //! Get the backpressure policy
+    AsyncWriterPolicy policy() const noexcept { return _policy; }
+
+    //! Get the count of bytes written into the underlying writer
+    uint64_t written() const;
+    //! Get the count of dropped bytes
+    uint64_t dropped() const;
+    //! Get the count of writes performed into the underlying writer
+    uint64_t writes() const;
+
+    //! Write a byte buffer
+    /*!
+        The buffer is copied and will be written into the underlying writer
+        in the background thread. Will block only if the ring buffer is full
+        and the block policy is used.
+
+        \param buffer - Buffer to write
+        \param size - Buffer size
+        \return Count of accepted bytes (0 if the buffer was dropped)
+    */
+    size_t Write(const void* buffer, size_t size) override;
+
+    using Writer::Write;
+
+    //! Flush the writer
+    /*!
+        Will block until all buffers written before the call are written
+        into the underlying writer and the underlying writer is flushed.
+    */
+    void Flush() override;
+
+    //! Close the writer
+    /*!
+        Will block until all written buffers are written into the underlying
+        writer and stop the background thread. Further writes are dropped.
+    */
+    void Close();
+
+private:
+    Writer& _writer;
+    AsyncWriterPolicy _policy;
+    SPSCRingBuffer _buffer;
+    std::vector<uint8_t> _batch;
+    mutable CriticalSection _cs;
+    ConditionVariable _producers;
+    ConditionVariable _consumer;
+    std::vector<std::vector<uint8_t>> _overflow;
+    std::exception_ptr _error;
+    std::thread _thread;
+    bool _stop;
+    bool _sleeping;
+    bool _blocking;
+    size_t _waiting;
+    uint64_t _accepted;
+    uint64_t _processed;
+    uint64_t _flush_target;
+    uint64_t _flush_requested;
+    uint64_t _flush_completed;
+    uint64_t _written;
+    uint64_t _dropped;
+    uint64_t _writes;
+
+    //! Background thread loop
+    void Consume();
+    //! Write the batch into the underlying writer and return the reached flush request
+    uint64_t Process(const uint8_t* buffer, size_t size);
+    //! Flush the underlying writer and complete the given flush request
+    void Complete(uint64_t request);
+    //! Stop the background thread
+    void Stop();
+};
+
+/*! \example threads_async_writer.cpp Asynchronous buffered writer example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_ASYNC_WRITER_H
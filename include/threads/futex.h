@@ -0,0 +1,71 @@
+/*!
+    \file futex.h
+    \brief Process-shared futex wait/wake primitive definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_FUTEX_H
+#define CPPCOMMON_THREADS_FUTEX_H
+
+#include "time/timespan.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace CppCommon {
+
+//! Process-shared futex wait/wake primitive
+/*!
+    Futex allows to block on a 32-bit atomic word until another thread or
+    process changes it and wakes waiters. The word may be placed into the
+    shared memory, so waiting and waking work across processes.
+
+    Wait methods may return spuriously, so callers must re-check their
+    condition in a loop. Linux uses FUTEX_WAIT/FUTEX_WAKE system calls,
+    other platforms fall back to a short sleep polling.
+
+    Thread-safe.
+
+    https://man7.org/linux/man-pages/man2/futex.2.html
+*/
+class Futex
+{
+public:
+    Futex() = delete;
+    Futex(const Futex&) = delete;
+    Futex(Futex&&) = delete;
+    ~Futex() = delete;
+
+    Futex& operator=(const Futex&) = delete;
+    Futex& operator=(Futex&&) = delete;
+
+    //! Wait while the futex word is equal to the expected value
+    /*!
+        Will block.
+
+        \param word - Futex word
+        \param expected - Expected value
+    */
+    static void Wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept;
+    //! Try to wait while the futex word is equal to the expected value for the given timespan
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param word - Futex word
+        \param expected - Expected value
+        \param timespan - Timespan to wait
+        \return 'false' if the timeout was reached, 'true' otherwise
+    */
+    static bool TryWaitFor(std::atomic<uint32_t>& word, uint32_t expected, const Timespan& timespan) noexcept;
+
+    //! Wake one waiter of the futex word
+    static void WakeOne(std::atomic<uint32_t>& word) noexcept;
+    //! Wake all waiters of the futex word
+    static void WakeAll(std::atomic<uint32_t>& word) noexcept;
+};
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_FUTEX_H
@@ -21,6 +21,10 @@ namespace CppCommon {
     Named auto-reset event behaves as a simple auto-reset event but could be shared
     between processes on the same machine.
 
+    Unix implementation keeps the event state in the shared memory block and
+    uses atomic operations with process-shared futex, so signaling an event
+    without waiters never enters the kernel.
+
     Thread-safe.
 
     \see EventAutoReset
@@ -91,7 +95,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 136;
+    static const size_t StorageSize = 144;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -22,6 +22,15 @@ namespace CppCommon {
     Named mutex behaves as a simple mutex but could be shared between processes
     on the same machine.
 
+    Unix implementation keeps the mutex state in the shared memory block and
+    uses atomic operations with process-shared futex, so uncontended lock and
+    unlock never enter the kernel. The owner process Id is stored in the
+    same atomic word as the lock. If the owner process dies while holding
+    the mutex, one of the waiting processes takes it over and IsOwnerDead()
+    reports it (the same way as EOWNERDEAD of robust mutexes), so the new
+    owner could repair the protected state. Windows reports abandoned mutex
+    in the same way.
+
     Thread-safe.
 
     \see Mutex
@@ -76,6 +85,16 @@ public:
     */
     void Lock();
 
+    //! Is the mutex taken over from the dead owner process?
+    /*!
+        Should be checked by the mutex owner after the successful lock.
+        The data protected by the mutex might be inconsistent if the
+        previous owner process died while holding it.
+
+        \return 'true' if the last successful lock took the mutex over from the dead owner process, 'false' otherwise
+    */
+    bool IsOwnerDead() const noexcept;
+
     //! Release mutex
     /*!
         Will not block.
@@ -88,7 +107,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 136;
+    static const size_t StorageSize = 152;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
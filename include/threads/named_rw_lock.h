@@ -25,6 +25,13 @@ namespace CppCommon {
     The fast lock is around 7% faster than the critical section when there is no contention, when
     used solely for mutual exclusion. It is also much smaller than the critical section.
 
+    Linux implementation wakes sleeping waiters with process-shared futex counters placed into
+    the shared memory block. If the exclusive owner process dies while holding the lock, it is
+    released by one of the sleeping waiters. The lock word has no room for the owner process Id,
+    so the owner is published right after the exclusive lock is acquired. The lock of a process
+    which dies between these two steps is not recovered, as well as shared locks of dead processes.
+    MacOS implementation wakes sleeping waiters with POSIX named semaphores.
+
     Thread-safe.
 
     \see RWLock
@@ -159,7 +166,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 184;
+    static const size_t StorageSize = 304;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -22,6 +22,12 @@ namespace CppCommon {
     Named semaphore behaves as a simple semaphore but could be shared between processes
     on the same machine.
 
+    Linux implementation keeps the count of taken resources in the shared
+    memory block and uses atomic operations with process-shared futex, so
+    uncontended lock and unlock never enter the kernel. MacOS implementation
+    uses POSIX named semaphore. Semaphore resources have no owner, so
+    resources taken by a dead process are not recovered.
+
     Thread-safe.
 
     \see Semaphore
@@ -91,7 +97,7 @@ private:
     Impl& impl() noexcept { return reinterpret_cast<Impl&>(_storage); }
     const Impl& impl() const noexcept { return reinterpret_cast<Impl const&>(_storage); }
 
-    static const size_t StorageSize = 56;
+    static const size_t StorageSize = 152;
     static const size_t StorageAlign = 8;
     alignas(StorageAlign) std::byte _storage[StorageSize];
 };
@@ -0,0 +1,192 @@
+/*!
+    \file shared_mpsc_ring_queue.h
+    \brief Process-shared multiple producers / single consumer wait-free ring queue definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
+#define CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
+
+#include "system/process.h"
+#include "threads/futex.h"
+#include "threads/shared_spsc_ring_buffer.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace CppCommon {
+
+//! Process-shared multiple producers / single consumer wait-free ring queue
+/*!
+    Process-shared ring queue is a version of MPSCRingQueue which is laid out
+    inside the named shared memory block. Like MPSCRingQueue it consists of
+    several single producer / single consumer ring queues (lanes), but each
+    producer attaches to its own lane instead of choosing a random one. So
+    enqueue is wait-free and does not require any lock. Consumer may block
+    until items are available using a process-shared futex.
+
+    Each attached producer and consumer stores its process Id in the queue.
+    Lanes and the consumer role of dead processes are taken over by the next
+    attached processes. Cursors are published with a single atomic store, so
+    a crashed producer never leaves a partially written item.
+
+    Items are copied with 'memcpy()' function, so the item type must be
+    trivially copyable and must not contain pointers.
+
+    FIFO order is guaranteed only for items of the same producer!
+
+    Thread-safe for one thread per attached producer or consumer.
+*/
+template<typename T>
+class SharedMPSCRingQueue
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Process-shared ring queue item must be trivially copyable!");
+    static_assert((alignof(T) <= 64), "Process-shared ring queue item alignment must not be greater than cache line!");
+
+public:
+    //! Create a new or open existing shared ring queue and attach to it with the given role
+    /*!
+        \param name - Shared ring queue name
+        \param capacity - Ring queue capacity of each producer lane (must be a power of two)
+        \param producers - Maximal count of attached producers
+        \param role - Ring queue role
+    */
+    explicit SharedMPSCRingQueue(const std::string& name, size_t capacity, size_t producers, SharedRingRole role);
+    SharedMPSCRingQueue(const SharedMPSCRingQueue&) = delete;
+    SharedMPSCRingQueue(SharedMPSCRingQueue&&) = delete;
+    ~SharedMPSCRingQueue();
+
+    SharedMPSCRingQueue& operator=(const SharedMPSCRingQueue&) = delete;
+    SharedMPSCRingQueue& operator=(SharedMPSCRingQueue&&) = delete;
+
+    //! Check if the queue is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the shared ring queue name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared ring queue role
+    SharedRingRole role() const noexcept { return _role; }
+
+    //! Is ring queue empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring queue capacity of each producer lane
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get maximal count of attached producers
+    size_t producers() const noexcept { return _producers; }
+    //! Get ring queue size
+    size_t size() const noexcept;
+
+    //! Enqueue an item into the ring queue (producer method)
+    /*!
+        The item will be copied into the producer lane of the ring queue.
+
+        Will not block.
+
+        \param item - Item to enqueue
+        \return 'true' if the item was successfully enqueue, 'false' if the producer lane is full
+    */
+    bool Enqueue(const T& item);
+
+    //! Dequeue an item from the ring queue (consumer method)
+    /*!
+        The item will be copied from the ring queue.
+
+        Will not block.
+
+        \param item - Item to dequeue
+        \return 'true' if the item was successfully dequeue, 'false' if the ring queue is empty
+    */
+    bool Dequeue(T& item);
+
+    //! Dequeue all items from the ring queue (consumer method)
+    /*!
+        All items in the ring queue will be processed by the given handler.
+
+        Will not block.
+
+        \param handler - Batch handler
+        \return 'true' if all items were successfully handled, 'false' if the ring queue is empty
+    */
+    bool Dequeue(const std::function<void(const T&)>& handler);
+
+    //! Wait until the ring queue is not empty (consumer method)
+    /*!
+        Will block.
+    */
+    void Wait();
+    //! Try to wait until the ring queue is not empty for the given timespan (consumer method)
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait
+        \return 'true' if the ring queue is not empty, 'false' if the timeout was reached
+    */
+    bool TryWaitFor(const Timespan& timespan);
+
+private:
+    // Shared ring queue layout placed at the beginning of the shared memory block
+    struct Header
+    {
+        static const uint32_t SIGNATURE = 0x4D505343;
+
+        alignas(64) std::atomic<uint32_t> signature;
+        uint64_t capacity;
+        uint64_t producers;
+        uint64_t item;
+        // Attached consumer process Id
+        alignas(64) std::atomic<uint64_t> consumer;
+        // Consumer wake up futex and waiting flag
+        alignas(64) std::atomic<uint32_t> signal;
+        std::atomic<uint32_t> waiting;
+
+        Header(size_t size, size_t lanes) : signature(0), capacity(size), producers(lanes), item(sizeof(T)), consumer(0), signal(0), waiting(0) {}
+    };
+
+    // Producer lane layout followed by the lane items
+    struct Lane
+    {
+        // Attached producer process Id
+        alignas(64) std::atomic<uint64_t> producer;
+        // Producer cursor
+        alignas(64) std::atomic<uint64_t> head;
+        // Consumer cursor
+        alignas(64) std::atomic<uint64_t> tail;
+
+        Lane() : producer(0), head(0), tail(0) {}
+    };
+
+    SharedMemory _shared;
+    SharedRingRole _role;
+    size_t _capacity;
+    size_t _mask;
+    size_t _producers;
+    size_t _stride;
+    uint64_t _pid;
+    Header* _header;
+    Lane* _lane;
+    size_t _consumer;
+
+    static size_t LaneStride(size_t capacity) noexcept { return sizeof(Lane) + ((capacity * sizeof(T) + 63) & ~(size_t)63); }
+
+    Lane* lane(size_t index) noexcept { return (Lane*)((uint8_t*)_header + sizeof(Header) + index * _stride); }
+    const Lane* lane(size_t index) const noexcept { return (const Lane*)((const uint8_t*)_header + sizeof(Header) + index * _stride); }
+    static uint8_t* items(Lane* lane) noexcept { return (uint8_t*)lane + sizeof(Lane); }
+
+    //! Dequeue an item from the given lane
+    bool Dequeue(Lane* lane, T& item);
+};
+
+/*! \example threads_shared_ring_buffer.cpp Process-shared ring buffer and queue example */
+
+} // namespace CppCommon
+
+#include "shared_mpsc_ring_queue.inl"
+
+#endif // CPPCOMMON_THREADS_SHARED_MPSC_RING_QUEUE_H
@@ -0,0 +1,221 @@
+/*!
+    \file shared_mpsc_ring_queue.inl
+    \brief Process-shared multiple producers / single consumer wait-free ring queue inline implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+namespace CppCommon {
+
+template<typename T>
+inline SharedMPSCRingQueue<T>::SharedMPSCRingQueue(const std::string& name, size_t capacity, size_t producers, SharedRingRole role)
+    : _shared(name, sizeof(Header) + producers * LaneStride(capacity)), _role(role),
+      _capacity(capacity), _mask(capacity - 1), _producers(producers), _stride(LaneStride(capacity)),
+      _pid(Process::CurrentProcessId()), _header(nullptr), _lane(nullptr), _consumer(0)
+{
+    assert((capacity > 1) && "Ring queue capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring queue capacity must be a power of two!");
+    assert((producers > 0) && "Ring queue producers count must be greater than zero!");
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Process-shared ring queue requires lock-free 64-bit atomics!");
+
+    _header = (Header*)_shared.ptr();
+
+    if (_shared.owner())
+    {
+        // Initialize the layout and publish it to other processes
+        new(_header) Header(capacity, producers);
+        for (size_t i = 0; i < producers; ++i)
+            new(lane(i)) Lane();
+        _header->signature.store(Header::SIGNATURE, std::memory_order_release);
+    }
+    else
+    {
+        // Wait for the owner to initialize the layout
+        uint64_t deadline = Timestamp::nano() + Timespan::seconds(1).total();
+        while (_header->signature.load(std::memory_order_acquire) != Header::SIGNATURE)
+        {
+            if (Timestamp::nano() > deadline)
+                throwex SystemException("Shared ring queue is not initialized!");
+            Thread::Yield();
+        }
+        if ((_header->capacity != capacity) || (_header->producers != producers) || (_header->item != sizeof(T)))
+            throwex SystemException("Invalid shared ring queue layout!");
+    }
+
+    if (_role == SharedRingRole::PRODUCER)
+    {
+        // Attach to a free producer lane or take over a lane of a dead producer
+        for (size_t i = 0; (i < producers) && (_lane == nullptr); ++i)
+        {
+            uint64_t current = lane(i)->producer.load(std::memory_order_acquire);
+            while ((current == 0) || !Process::IsProcessRunning(current))
+            {
+                if (lane(i)->producer.compare_exchange_weak(current, _pid, std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    _lane = lane(i);
+                    break;
+                }
+            }
+        }
+        if (_lane == nullptr)
+            throwex SystemException("All shared ring queue producers are already attached!");
+    }
+    else
+    {
+        // Attach as a consumer and take over the role of a dead consumer
+        uint64_t current = _header->consumer.load(std::memory_order_acquire);
+        do
+        {
+            if ((current != 0) && Process::IsProcessRunning(current))
+                throwex SystemException("Shared ring queue consumer is already attached!");
+        } while (!_header->consumer.compare_exchange_weak(current, _pid, std::memory_order_acq_rel, std::memory_order_acquire));
+
+        // Dead consumer might leave its waiting flag
+        _header->waiting.store(0, std::memory_order_release);
+    }
+}
+
+template<typename T>
+inline SharedMPSCRingQueue<T>::~SharedMPSCRingQueue()
+{
+    // Detach from the ring queue
+    std::atomic<uint64_t>& owner = (_role == SharedRingRole::PRODUCER) ? _lane->producer : _header->consumer;
+    uint64_t current = _pid;
+    owner.compare_exchange_strong(current, 0, std::memory_order_acq_rel);
+}
+
+template<typename T>
+inline size_t SharedMPSCRingQueue<T>::size() const noexcept
+{
+    size_t size = 0;
+    for (size_t i = 0; i < _producers; ++i)
+    {
+        const uint64_t head = lane(i)->head.load(std::memory_order_acquire);
+        const uint64_t tail = lane(i)->tail.load(std::memory_order_acquire);
+        size += (size_t)(head - tail);
+    }
+    return size;
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Enqueue(const T& item)
+{
+    assert((_role == SharedRingRole::PRODUCER) && "Only producer can enqueue into the shared ring queue!");
+
+    const uint64_t head = _lane->head.load(std::memory_order_relaxed);
+    const uint64_t tail = _lane->tail.load(std::memory_order_acquire);
+
+    // Check if there is free space in the producer lane
+    if ((head - tail) >= _capacity)
+        return false;
+
+    // Copy the item into the producer lane and publish it
+    std::memcpy(items(_lane) + ((size_t)head & _mask) * sizeof(T), &item, sizeof(T));
+    _lane->head.store(head + 1, std::memory_order_release);
+
+    // Wake up the waiting consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_header->waiting.load(std::memory_order_relaxed) != 0)
+    {
+        _header->signal.fetch_add(1, std::memory_order_release);
+        Futex::WakeOne(_header->signal);
+    }
+
+    return true;
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Dequeue(Lane* lane, T& item)
+{
+    const uint64_t tail = lane->tail.load(std::memory_order_relaxed);
+    const uint64_t head = lane->head.load(std::memory_order_acquire);
+
+    // Check if the producer lane is empty
+    if (head == tail)
+        return false;
+
+    // Copy the item from the producer lane and release its slot
+    std::memcpy(&item, items(lane) + ((size_t)tail & _mask) * sizeof(T), sizeof(T));
+    lane->tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Dequeue(T& item)
+{
+    assert((_role == SharedRingRole::CONSUMER) && "Only consumer can dequeue from the shared ring queue!");
+
+    // Try to dequeue one item from the one of producer lanes
+    for (size_t i = 0; i < _producers; ++i)
+    {
+        if (Dequeue(lane(_consumer++ % _producers), item))
+            return true;
+    }
+
+    return false;
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::Dequeue(const std::function<void(const T&)>& handler)
+{
+    assert((_role == SharedRingRole::CONSUMER) && "Only consumer can dequeue from the shared ring queue!");
+    assert((handler) && "Batch handler must be valid!");
+
+    bool result = false;
+
+    // Consume all available items from producer lanes
+    for (size_t i = 0; i < _producers; ++i)
+    {
+        T item;
+        while (Dequeue(lane(i), item))
+        {
+            handler(item);
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+template<typename T>
+inline void SharedMPSCRingQueue<T>::Wait()
+{
+    while (!TryWaitFor(Timespan::seconds(1)));
+}
+
+template<typename T>
+inline bool SharedMPSCRingQueue<T>::TryWaitFor(const Timespan& timespan)
+{
+    assert((_role == SharedRingRole::CONSUMER) && "Only consumer can wait for the shared ring queue!");
+
+    if (!empty())
+        return true;
+
+    uint64_t deadline = Timestamp::nano() + timespan.total();
+    for (;;)
+    {
+        // Register the waiting consumer and check the ring queue again to avoid lost wake ups
+        uint32_t signal = _header->signal.load(std::memory_order_acquire);
+        _header->waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!empty())
+        {
+            _header->waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        uint64_t current = Timestamp::nano();
+        bool result = (current < deadline) && Futex::TryWaitFor(_header->signal, signal, Timespan(deadline - current));
+        _header->waiting.store(0, std::memory_order_relaxed);
+
+        if (!empty())
+            return true;
+        if (!result)
+            return false;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,134 @@
+/*!
+    \file shared_spsc_ring_buffer.h
+    \brief Process-shared single producer / single consumer wait-free ring buffer definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+#define CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
+
+#include "system/shared_memory.h"
+#include "time/timespan.h"
+
+#include <string>
+
+namespace CppCommon {
+
+//! Process-shared ring role
+enum class SharedRingRole
+{
+    PRODUCER,   //!< Attach to the shared ring as a producer
+    CONSUMER    //!< Attach to the shared ring as a consumer
+};
+
+//! Process-shared single producer / single consumer wait-free ring buffer
+/*!
+    Process-shared ring buffer is a version of SPSCRingBuffer which is laid
+    out inside the named shared memory block. The layout contains only
+    offsets and atomic cursors, so the ring buffer may be mapped at different
+    addresses in different processes. Consumer may block until the data is
+    available using a process-shared futex. Producer makes a wake up system
+    call only if the consumer is waiting.
+
+    Each process attaches to the ring buffer as a producer or a consumer.
+    The attached process Id is stored in the ring buffer, so only one live
+    producer and one live consumer are allowed at the same time. If the
+    attached process dies its role is taken over by the next attached
+    process. Cursors are published with a single atomic store, so a crashed
+    producer never leaves a partially written data and a crashed consumer
+    leaves all not consumed data to its successor.
+
+    FIFO order is guaranteed!
+
+    Thread-safe for one producer and one consumer.
+*/
+class SharedSPSCRingBuffer
+{
+public:
+    //! Create a new or open existing shared ring buffer and attach to it with the given role
+    /*!
+        \param name - Shared ring buffer name
+        \param capacity - Ring buffer capacity in bytes (must be a power of two)
+        \param role - Ring buffer role
+    */
+    explicit SharedSPSCRingBuffer(const std::string& name, size_t capacity, SharedRingRole role);
+    SharedSPSCRingBuffer(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer(SharedSPSCRingBuffer&&) = delete;
+    ~SharedSPSCRingBuffer();
+
+    SharedSPSCRingBuffer& operator=(const SharedSPSCRingBuffer&) = delete;
+    SharedSPSCRingBuffer& operator=(SharedSPSCRingBuffer&&) = delete;
+
+    //! Check if the buffer is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Get the shared ring buffer name
+    const std::string& name() const noexcept { return _shared.name(); }
+    //! Get the shared ring buffer role
+    SharedRingRole role() const noexcept { return _role; }
+
+    //! Is ring buffer empty?
+    bool empty() const noexcept { return (size() == 0); }
+    //! Get ring buffer capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Get ring buffer size in bytes
+    size_t size() const noexcept;
+
+    //! Enqueue a data into the ring buffer (producer method)
+    /*!
+        The data will be copied into the ring buffer using 'memcpy()' function.
+        Data size should not be greater than ring buffer capacity!
+
+        Will not block.
+
+        \param data - Data buffer to enqueue
+        \param size - Data buffer size
+        \return 'true' if the data was successfully enqueue, 'false' if the ring buffer is full
+    */
+    bool Enqueue(const void* data, size_t size);
+
+    //! Dequeue a data from the ring buffer (consumer method)
+    /*!
+        The data will be copied from the ring buffer using 'memcpy()' function.
+
+        Will not block.
+
+        \param data - Data buffer to dequeue
+        \param size - Data buffer size
+        \return 'true' if the data was successfully dequeue, 'false' if the ring buffer is empty
+    */
+    bool Dequeue(void* data, size_t& size);
+
+    //! Wait until the ring buffer is not empty (consumer method)
+    /*!
+        Will block.
+    */
+    void Wait();
+    //! Try to wait until the ring buffer is not empty for the given timespan (consumer method)
+    /*!
+        Will block for the given timespan in the worst case.
+
+        \param timespan - Timespan to wait
+        \return 'true' if the ring buffer is not empty, 'false' if the timeout was reached
+    */
+    bool TryWaitFor(const Timespan& timespan);
+
+private:
+    struct Header;
+
+    SharedMemory _shared;
+    SharedRingRole _role;
+    Header* _header;
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _mask;
+    uint64_t _pid;
+};
+
+/*! \example threads_shared_ring_buffer.cpp Process-shared ring buffer and queue example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_THREADS_SHARED_SPSC_RING_BUFFER_H
@@ -0,0 +1,122 @@
+/*!
+    \file clock.h
+    \brief Clock policies definition
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPCOMMON_TIME_CLOCK_H
+#define CPPCOMMON_TIME_CLOCK_H
+
+#include "time/timespan.h"
+#include "time/timestamp.h"
+
+namespace CppCommon {
+
+//! UTC clock
+/*!
+    Clock policy which provides the precise UTC timestamp.
+    Clock policy is a type with the static now() method which
+    returns the current UTC timestamp.
+
+    Thread-safe.
+*/
+struct UtcClock
+{
+    //! Get the current UTC timestamp
+    static Timestamp now() { return UtcTimestamp(); }
+};
+
+//! Coarse clock
+/*!
+    Clock policy which provides UTC and high resolution timestamps with
+    the resolution of the system tick (usually 1-4 milliseconds). Values
+    are read from the memory shared with the kernel without any clock
+    source access, so they are several times cheaper than the precise
+    UtcTimestamp and NanoTimestamp.
+
+    Uses CLOCK_REALTIME_COARSE and CLOCK_MONOTONIC_COARSE on Linux and
+    the system tick time on Windows. Other platforms use precise clocks.
+
+    Thread-safe.
+*/
+class CoarseClock
+{
+public:
+    CoarseClock() = delete;
+    CoarseClock(const CoarseClock&) = delete;
+    CoarseClock(CoarseClock&&) = delete;
+    ~CoarseClock() = delete;
+
+    CoarseClock& operator=(const CoarseClock&) = delete;
+    CoarseClock& operator=(CoarseClock&&) = delete;
+
+    //! Get the current coarse UTC timestamp
+    static Timestamp now() { return UtcTimestamp(utc()); }
+
+    //! Get the coarse UTC timestamp
+    /*!
+        \return Coarse UTC timestamp in nanoseconds
+    */
+    static uint64_t utc();
+    //! Get the coarse high resolution timestamp
+    /*!
+        \return Coarse high resolution timestamp in nanoseconds
+    */
+    static uint64_t nano();
+
+    //! Get the coarse clock resolution
+    static Timespan resolution();
+};
+
+//! Cached clock
+/*!
+    Clock policy which provides the UTC timestamp cached by the background
+    thread. The background thread updates the cached timestamp with the
+    given interval, so reading the clock is a single atomic load.
+
+    If the background thread is not started the coarse clock is used.
+
+    Thread-safe.
+*/
+class CachedClock
+{
+public:
+    CachedClock() = delete;
+    CachedClock(const CachedClock&) = delete;
+    CachedClock(CachedClock&&) = delete;
+    ~CachedClock() = delete;
+
+    CachedClock& operator=(const CachedClock&) = delete;
+    CachedClock& operator=(CachedClock&&) = delete;
+
+    //! Get the current cached UTC timestamp
+    static Timestamp now() { return UtcTimestamp(utc()); }
+
+    //! Get the cached UTC timestamp
+    /*!
+        \return Cached UTC timestamp in nanoseconds
+    */
+    static uint64_t utc();
+
+    //! Is the background thread running?
+    static bool IsRunning() noexcept;
+
+    //! Start the background thread
+    /*!
+        If the background thread is already running its update interval
+        will be changed.
+
+        \param interval - Update interval (default is 1 millisecond)
+    */
+    static void Start(const Timespan& interval = Timespan::milliseconds(1));
+    //! Stop the background thread
+    static void Stop();
+};
+
+/*! \example time_clock.cpp Clock policies example */
+
+} // namespace CppCommon
+
+#endif // CPPCOMMON_TIME_CLOCK_H
@@ -11,6 +11,9 @@
 
 #include "time/timestamp.h"
 
+#include <string>
+#include <string_view>
+
 namespace CppCommon {
 
 //! Weekday
@@ -158,6 +161,18 @@ public:
     //! Get local timestamp from the current date & time value
     LocalTimestamp localstamp() const;
 
+    //! Get ISO-8601 string from the current date & time value in format "YYYY-MM-DDThh:mm:ss.nnnnnnnnn"
+    std::string string() const;
+    //! Write ISO-8601 string from the current date & time value into the given buffer
+    /*!
+        Digits are emitted from a two-digit lookup table without any
+        formatting library calls. The buffer is not null-terminated.
+
+        \param buffer - Buffer to write (must hold at least Time::ISO8601_SIZE characters)
+        \return Count of written characters
+    */
+    size_t string(char* buffer) const noexcept;
+
     //! Get the epoch date & time
     /*!
         Thread-safe.
@@ -167,6 +182,9 @@ public:
     static Time epoch()
     { return Time(1970, 1, 1); }
 
+    //! Size of the ISO-8601 string without the time zone designator
+    static const size_t ISO8601_SIZE = 29;
+
     //! Swap two instances
     void swap(Time& time) noexcept;
     friend void swap(Time& time1, Time& time2) noexcept;
@@ -205,6 +223,10 @@ class UtcTime;
 class LocalTime;
 
 //! UTC time
+/*!
+    Conversion from a timestamp uses integer calendar math and caches the
+    calendar date of the last converted day per thread.
+*/
 class UtcTime : public Time
 {
 public:
@@ -228,9 +250,47 @@ public:
     UtcTime(const Time& time) : Time(time) {}
     //! Initialize UTC time with another local time value
     UtcTime(const LocalTime& time);
+
+    //! Get RFC-3339 string from the current UTC date & time value in format "YYYY-MM-DDThh:mm:ss.nnnnnnnnnZ"
+    std::string string() const;
+    //! Write RFC-3339 string from the current UTC date & time value into the given buffer
+    /*!
+        \param buffer - Buffer to write (must hold at least Time::ISO8601_SIZE + 1 characters)
+        \return Count of written characters
+    */
+    size_t string(char* buffer) const noexcept;
+
+    //! Parse UTC time from the given ISO-8601 or RFC-3339 string
+    /*!
+        Accepts "YYYY-MM-DD(T|t| )hh:mm:ss[(.|,)fraction][Z|z|(+|-)hh[[:]mm]]".
+        Up to nine fraction digits are kept, others are truncated. Time zone
+        offset is applied to get the UTC time. String without the time zone
+        designator is treated as UTC time.
+
+        Thread-safe.
+
+        \param str - String to parse
+        \return UTC time
+    */
+    static UtcTime Parse(std::string_view str);
+    //! Try to parse UTC time from the given ISO-8601 or RFC-3339 string
+    /*!
+        Thread-safe.
+
+        \param str - String to parse
+        \param time - Parsed UTC time
+        \return 'true' if the string was successfully parsed, 'false' otherwise
+    */
+    static bool TryParse(std::string_view str, UtcTime& time) noexcept;
 };
 
 //! Local time
+/*!
+    Conversion from a timestamp caches the calendar date & time of the last
+    converted minute per thread, so only the first conversion in each minute
+    calls the system time zone conversion. Time zone changes made in the
+    middle of the minute become visible starting from the next minute.
+*/
 class LocalTime : public Time
 {
 public:
@@ -222,6 +222,25 @@ public:
     */
     static uint64_t rdts();
 
+    //! Get the fast high resolution timestamp
+    /*!
+        Converts the invariant time stamp counter into nanoseconds of the
+        high resolution clock, so it is comparable with Timestamp::nano()
+        values, but avoids the system call. The clock is calibrated once
+        at the first call and its drift is corrected every second without
+        going backward.
+
+        Falls back to Timestamp::nano() if the time stamp counter is not
+        invariant or not synchronized between CPUs.
+
+        Thread-safe.
+
+        \return Fast high resolution timestamp
+    */
+    static uint64_t fast();
+    //! Is the calibrated time stamp counter clock used by Timestamp::fast()?
+    static bool IsTscAvailable();
+
     //! Swap two instances
     void swap(Timestamp& timestamp) noexcept;
     friend void swap(Timestamp& timestamp1, Timestamp& timestamp2) noexcept;
@@ -279,6 +298,18 @@ public:
     NanoTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
 };
 
+//! Fast high resolution timestamp
+class FastTimestamp : public Timestamp
+{
+public:
+    using Timestamp::Timestamp;
+
+    //! Initialize fast high resolution timestamp with a current fast high resolution time
+    FastTimestamp() : Timestamp(Timestamp::fast()) {}
+    //! Initialize fast high resolution timestamp with another timestamp value
+    FastTimestamp(const Timestamp& timestamp) : Timestamp(timestamp) {}
+};
+
 //! RDTS timestamp
 class RdtsTimestamp : public Timestamp
 {
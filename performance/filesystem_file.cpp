@@ -4,14 +4,19 @@
 
 #include "benchmark/cppbenchmark.h"
 
+#include "filesystem/async_io.h"
 #include "filesystem/file.h"
 
 #include <array>
+#include <memory>
 
 using namespace CppCommon;
 
 const uint64_t operations = 100000;
 const int page = 8192;
+const int depth_from = 1;
+const int depth_to = 128;
+const auto settings = CppBenchmark::Settings().Operations(operations / depth_to).ParamRange(depth_from, depth_to, [](int from, int to, int& result) { int r = result; result *= 2; return r; });
 
 class FileWriteFixture : public virtual CppBenchmark::Fixture
 {
@@ -59,6 +64,51 @@ private:
     }
 };
 
+template <AsyncIOBackend backend>
+class AsyncIOReadFixture : public FileReadFixture
+{
+protected:
+    std::unique_ptr<AsyncIO> engine;
+    std::vector<uint8_t> buffers;
+    uint64_t offset;
+
+    AsyncIOReadFixture() : buffers(depth_to * page), offset(0) {}
+
+    void Initialize(CppBenchmark::Context& context) override
+    {
+        FileReadFixture::Initialize(context);
+
+        // Create asynchronous I/O engine with the required queue depth
+        engine = std::make_unique<AsyncIO>(context.x(), backend);
+        engine->RegisterBuffers({ { buffers.data(), buffers.size() } });
+        engine->RegisterFiles({ &file });
+        offset = 0;
+    }
+
+    void Cleanup(CppBenchmark::Context& context) override
+    {
+        engine.reset();
+
+        FileReadFixture::Cleanup(context);
+    }
+
+    void ReadBatch(CppBenchmark::Context& context)
+    {
+        const int depth = context.x();
+
+        // Submit a batch of positional reads and wait for all of them
+        for (int i = 0; i < depth; ++i)
+        {
+            engine->Read(file, buffers.data() + i * page, page, offset, nullptr);
+            offset = (offset + page) % (operations * page);
+        }
+        engine->Drain();
+
+        context.metrics().AddOperations(depth - 1);
+        context.metrics().AddBytes(depth * page);
+    }
+};
+
 BENCHMARK_FIXTURE(FileWriteFixture, "File::Write()", operations)
 {
     file.Write(buffer.data(), buffer.size());
@@ -71,4 +121,16 @@ BENCHMARK_FIXTURE(FileReadFixture, "File::Read()", operations)
     context.metrics().AddBytes(buffer.size());
 }
 
+BENCHMARK_FIXTURE(AsyncIOReadFixture<AsyncIOBackend::THREADS>, "AsyncIO::Read(threads)", settings)
+{
+    ReadBatch(context);
+}
+
+#if defined(__linux__)
+BENCHMARK_FIXTURE(AsyncIOReadFixture<AsyncIOBackend::URING>, "AsyncIO::Read(io_uring)", settings)
+{
+    ReadBatch(context);
+}
+#endif
+
 BENCHMARK_MAIN()
@@ -0,0 +1,151 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/encoding.h"
+
+#include <functional>
+#include <string>
+
+using namespace CppCommon;
+
+const uint64_t bytes_to_process = 268435456;
+const int size_from = 16;
+const int size_to = 67108864;
+const auto settings = CppBenchmark::Settings().ParamRange(size_from, size_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+std::string generate(size_t size)
+{
+    std::string data(size, 0);
+    for (size_t i = 0; i < size; ++i)
+        data[i] = (char)((i * 131 + 7) % 256);
+    return data;
+}
+
+void process(CppBenchmark::Context& context, const std::function<std::string(const std::string&)>& prepare, const std::function<void(const std::string&, std::string&)>& codec)
+{
+    const uint64_t size = context.x();
+    const uint64_t operations = (bytes_to_process / size) > 0 ? (bytes_to_process / size) : 1;
+    const std::string input = prepare(generate(size));
+    std::string output;
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        // Reuse the output buffer to measure codec speed only
+        output.clear();
+        codec(input, output);
+        crc += output.size();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddBytes(operations * size);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+std::string identity(const std::string& data) { return data; }
+
+std::string text(size_t size)
+{
+    // Mixed ASCII, Cyrillic, CJK and emoji text
+    const std::string sample = "Sample text \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 ";
+    std::string data;
+    while (data.size() < size)
+        data += sample;
+    // Keep the text valid
+    while (data.size() > size)
+        data.pop_back();
+    while (!data.empty() && !Encoding::IsValidUTF8(data))
+        data.pop_back();
+    return data;
+}
+
+template <class TOutput, typename TCodec>
+void transcode(CppBenchmark::Context& context, const std::string& input, TCodec codec)
+{
+    const uint64_t size = context.x();
+    const uint64_t operations = (bytes_to_process / size) > 0 ? (bytes_to_process / size) : 1;
+    TOutput output;
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+    {
+        output.clear();
+        codec(input, output);
+        crc += output.size();
+    }
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddBytes(operations * size);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("IsValidUTF8", settings)
+{
+    transcode<std::string>(context, text(context.x()), [](const std::string& input, std::string& output) { output.resize(Encoding::IsValidUTF8(input) ? 1 : 0); });
+}
+
+BENCHMARK("UTF8toUTF16", settings)
+{
+    transcode<std::u16string>(context, text(context.x()), [](const std::string& input, std::u16string& output) { Encoding::UTF8toUTF16(input, output); });
+}
+
+BENCHMARK("UTF8toUTF32", settings)
+{
+    transcode<std::u32string>(context, text(context.x()), [](const std::string& input, std::u32string& output) { Encoding::UTF8toUTF32(input, output); });
+}
+
+BENCHMARK("UTF16toUTF8", settings)
+{
+    std::u16string input = Encoding::UTF8toUTF16(text(context.x()));
+    transcode<std::string>(context, std::string(), [&input](const std::string&, std::string& output) { Encoding::UTF16toUTF8(input, output); });
+}
+
+BENCHMARK("Base16Encode", settings)
+{
+    process(context, identity, [](const std::string& input, std::string& output) { Encoding::Base16Encode(input, output); });
+}
+
+BENCHMARK("Base16Decode", settings)
+{
+    process(context, [](const std::string& data) { return Encoding::Base16Encode(data); }, [](const std::string& input, std::string& output) { Encoding::Base16Decode(input, output); });
+}
+
+BENCHMARK("Base32Encode", settings)
+{
+    process(context, identity, [](const std::string& input, std::string& output) { Encoding::Base32Encode(input, output); });
+}
+
+BENCHMARK("Base32Decode", settings)
+{
+    process(context, [](const std::string& data) { return Encoding::Base32Encode(data); }, [](const std::string& input, std::string& output) { Encoding::Base32Decode(input, output); });
+}
+
+BENCHMARK("Base64Encode", settings)
+{
+    process(context, identity, [](const std::string& input, std::string& output) { Encoding::Base64Encode(input, output); });
+}
+
+BENCHMARK("Base64Decode", settings)
+{
+    process(context, [](const std::string& data) { return Encoding::Base64Encode(data); }, [](const std::string& input, std::string& output) { Encoding::Base64Decode(input, output); });
+}
+
+BENCHMARK("Base64Encoder", settings)
+{
+    process(context, identity, [](const std::string& input, std::string& output)
+    {
+        // Encode the input in 4096 bytes chunks
+        Base64Encoder encoder;
+        std::string_view data(input);
+        for (size_t i = 0; i < data.size(); i += 4096)
+            encoder.Encode(data.substr(i, 4096), output);
+        encoder.Finish(output);
+    });
+}
+
+BENCHMARK_MAIN()
@@ -0,0 +1,71 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/pattern_set.h"
+#include "string/string_utils.h"
+
+#include <regex>
+
+using namespace CppCommon;
+
+const uint64_t operations = 1000000;
+
+const std::string glob = ".*\\.txt;.*\\.log";
+const std::string regex = "[a-z_]+_\\d{4}\\.(log|txt)";
+const std::string name = "some_long_file_name_2016.log";
+
+BENCHMARK("StringUtils::IsPatternMatch()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += StringUtils::IsPatternMatch(glob, name) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("PatternSet::Match(glob)")
+{
+    uint64_t crc = 0;
+
+    PatternSet patterns(glob);
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += patterns.Match(name) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("PatternSet::Match(regex)")
+{
+    uint64_t crc = 0;
+
+    PatternSet patterns(regex);
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += patterns.Match(name) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("std::regex_match()")
+{
+    uint64_t crc = 0;
+
+    std::regex expression(regex);
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += std::regex_match(name, expression) ? 1 : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK_MAIN()
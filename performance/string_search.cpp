@@ -0,0 +1,109 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/multi_searcher.h"
+#include "string/string_utils.h"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t bytes_to_process = 268435456;
+const int size_from = 64;
+const int size_to = 16777216;
+const auto settings = CppBenchmark::Settings().ParamRange(size_from, size_to, [](int from, int to, int& result) { int r = result; result *= 4; return r; });
+
+// HTTP-like headers text
+std::string headers(size_t size)
+{
+    std::string data;
+    for (size_t i = 0; data.size() < size; ++i)
+        data += "X-Header-" + std::to_string(i * 7919 % 1000) + ": Some header value\r\n";
+    data.resize(size);
+    return data;
+}
+
+template <typename TFunction>
+void process(CppBenchmark::Context& context, const std::string& input, TFunction function)
+{
+    const uint64_t size = context.x();
+    const uint64_t operations = (bytes_to_process / size) > 0 ? (bytes_to_process / size) : 1;
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += function(input);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().AddBytes(operations * size);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("std::string_view::find", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { return std::string_view(input).find("Content-Length"); });
+}
+
+BENCHMARK("StringUtils::Find", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { return StringUtils::Find(input, "Content-Length"); });
+}
+
+BENCHMARK("StringUtils::CountAll", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { return StringUtils::CountAll(input, "\r\n"); });
+}
+
+BENCHMARK("StringUtils::ReplaceAll", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { std::string str(input); StringUtils::ReplaceAll(str, "\r\n", "\n"); return str.size(); });
+}
+
+BENCHMARK("std::tolower", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { std::string str(input); std::transform(str.begin(), str.end(), str.begin(), [](char ch) { return (char)std::tolower(ch); }); return str.size(); });
+}
+
+BENCHMARK("StringUtils::Lower", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input) { std::string str(input); StringUtils::Lower(str); return str.size(); });
+}
+
+BENCHMARK("StringUtils::CompareNoCase", settings)
+{
+    std::string upper = StringUtils::ToUpper(headers(context.x()));
+    process(context, headers(context.x()), [&upper](const std::string& input) { return (size_t)StringUtils::CompareNoCase(input, upper); });
+}
+
+const std::vector<std::string> patterns = { "Content-Length", "Transfer-Encoding", "Connection", "Upgrade", "Host" };
+
+BENCHMARK("StringUtils::Contains (many patterns)", settings)
+{
+    process(context, headers(context.x()), [](const std::string& input)
+    {
+        size_t count = 0;
+        for (const auto& pattern : patterns)
+            count += StringUtils::Contains(input, pattern) ? 1 : 0;
+        return count;
+    });
+}
+
+BENCHMARK("MultiSearcher::Contains", settings)
+{
+    MultiSearcher searcher(patterns);
+    process(context, headers(context.x()), [&searcher](const std::string& input) { return (size_t)searcher.Contains(input); });
+}
+
+BENCHMARK("MultiSearcher::Contains (ignore case)", settings)
+{
+    MultiSearcher searcher(patterns, true);
+    process(context, headers(context.x()), [&searcher](const std::string& input) { return (size_t)searcher.Contains(input); });
+}
+
+BENCHMARK_MAIN()
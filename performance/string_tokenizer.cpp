@@ -0,0 +1,83 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "benchmark/cppbenchmark.h"
+
+#include "string/string_utils.h"
+#include "string/tokenizer.h"
+
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+
+const uint64_t iterations = 100000;
+
+// CSV-like line with 32 fields
+std::string line()
+{
+    std::string result;
+    for (size_t i = 0; i < 32; ++i)
+    {
+        if (i > 0)
+            result += ',';
+        result += "field" + std::to_string(i * 7919);
+    }
+    return result;
+}
+
+const std::string csv = line();
+
+BENCHMARK("StringUtils::Split", iterations)
+{
+    auto tokens = StringUtils::Split(csv, ',');
+    context.metrics().AddBytes(csv.size());
+    context.metrics().AddItems(tokens.size());
+}
+
+BENCHMARK("StringTokenizer", iterations)
+{
+    size_t count = 0;
+    for (auto token : StringTokenizer(csv, ','))
+        count += token.empty() ? 0 : 1;
+    context.metrics().AddBytes(csv.size());
+    context.metrics().AddItems(count);
+}
+
+BENCHMARK("StringUtils::SplitByAny", iterations)
+{
+    auto tokens = StringUtils::SplitByAny(csv, ",;\t");
+    context.metrics().AddBytes(csv.size());
+    context.metrics().AddItems(tokens.size());
+}
+
+BENCHMARK("StringTokenizer::ByAny", iterations)
+{
+    size_t count = 0;
+    for (auto token : StringTokenizer::ByAny(csv, ",;\t"))
+        count += token.empty() ? 0 : 1;
+    context.metrics().AddBytes(csv.size());
+    context.metrics().AddItems(count);
+}
+
+const std::vector<std::string> tokens = StringUtils::Split(csv, ',');
+
+BENCHMARK("StringUtils::Join", iterations)
+{
+    auto result = StringUtils::Join(tokens, ',');
+    context.metrics().AddBytes(result.size());
+    context.metrics().AddItems(tokens.size());
+}
+
+BENCHMARK("StringUtils::Join into buffer", iterations)
+{
+    // Reuse the result buffer between iterations
+    static std::string result;
+    result.clear();
+    StringUtils::Join(result, tokens, ',');
+    context.metrics().AddBytes(result.size());
+    context.metrics().AddItems(tokens.size());
+}
+
+BENCHMARK_MAIN()
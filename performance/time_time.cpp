@@ -60,4 +60,60 @@ BENCHMARK("Time::localstamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK("UtcTime::string()")
+{
+    uint64_t crc = 0;
+
+    char buffer[Time::ISO8601_SIZE + 1];
+    UtcTime time = UtcTime();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += time.string(buffer);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("UtcTime(timestamp).string()")
+{
+    uint64_t crc = 0;
+
+    char buffer[Time::ISO8601_SIZE + 1];
+    uint64_t timestamp = UtcTimestamp().total();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += UtcTime(Timestamp(timestamp + i * 1000)).string(buffer);
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("UtcTime::Parse()")
+{
+    uint64_t crc = 0;
+
+    std::string str = UtcTime().string();
+    UtcTime time = UtcTime();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += UtcTime::TryParse(str, time) ? time.nanosecond() : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("UtcTime::Parse(RFC-3339)")
+{
+    uint64_t crc = 0;
+
+    std::string str = "2016-07-13T14:22:33.123456789+03:00";
+    UtcTime time = UtcTime();
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += UtcTime::TryParse(str, time) ? time.hour() : 0;
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK_MAIN()
@@ -4,7 +4,7 @@
 
 #include "benchmark/cppbenchmark.h"
 
-#include "time/timestamp.h"
+#include "time/clock.h"
 
 using namespace CppCommon;
 
@@ -58,6 +58,58 @@ BENCHMARK("NanoTimestamp()")
     context.metrics().SetCustom("CRC", crc);
 }
 
+BENCHMARK("FastTimestamp()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += FastTimestamp().total();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseClock::utc()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseClock::utc();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CoarseClock::nano()")
+{
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CoarseClock::nano();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
+BENCHMARK("CachedClock::utc()")
+{
+    CachedClock::Start();
+
+    uint64_t crc = 0;
+
+    for (uint64_t i = 0; i < operations; ++i)
+        crc += CachedClock::utc();
+
+    CachedClock::Stop();
+
+    // Update benchmark metrics
+    context.metrics().AddOperations(operations - 1);
+    context.metrics().SetCustom("CRC", crc);
+}
+
 BENCHMARK("RdtsTimestamp()")
 {
     uint64_t crc = 0;
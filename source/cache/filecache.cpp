@@ -20,7 +20,7 @@ bool FileCache::emplace(std::string&& key, std::string&& value, const Timespan&
     // Update the cache entry
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
+        Timestamp current = _clock();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
         _entries_by_key.insert(std::make_pair(key, MemCacheEntry(std::move(value), _timestamp, timeout)));
         _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
@@ -41,7 +41,7 @@ bool FileCache::insert(const std::string& key, const std::string& value, const T
     // Update the cache entry
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
+        Timestamp current = _clock();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
         _entries_by_key.insert(std::make_pair(key, MemCacheEntry(value, _timestamp, timeout)));
         _entries_by_timestamp.insert(std::make_pair(_timestamp, key));
@@ -115,7 +115,7 @@ bool FileCache::insert_path(const CppCommon::Path& path, const std::string& pref
     // Update the cache path
     if (timeout.total() > 0)
     {
-        Timestamp current = UtcTimestamp();
+        Timestamp current = _clock();
         _timestamp = (current <= _timestamp) ? _timestamp + 1 : current;
         _paths_by_key.insert(std::make_pair(path, FileCacheEntry(prefix, handler, _timestamp, timeout)));
         _paths_by_timestamp.insert(std::make_pair(_timestamp, path));
@@ -223,7 +223,7 @@ void FileCache::clear()
     _paths_by_timestamp.clear();
 }
 
-void FileCache::watchdog(const UtcTimestamp& utc)
+void FileCache::watchdog(const Timestamp& utc)
 {
     std::unique_lock<std::shared_mutex> locker(_lock);
 
@@ -276,6 +276,7 @@ void FileCache::swap(FileCache& cache) noexcept
     std::unique_lock<std::shared_mutex> locker2(cache._lock);
 
     using std::swap;
+    swap(_clock, cache._clock);
     swap(_timestamp, cache._timestamp);
     swap(_entries_by_key, cache._entries_by_key);
     swap(_entries_by_timestamp, cache._entries_by_timestamp);
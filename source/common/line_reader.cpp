@@ -0,0 +1,76 @@
+/*!
+    \file line_reader.cpp
+    \brief Streaming line reader implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "common/line_reader.h"
+
+#include <cstring>
+
+namespace CppCommon {
+
+const size_t LineReader::DEFAULT_BUFFER = 65536;
+
+LineReader::LineReader(Reader& reader, size_t buffer, char delimiter)
+    : _reader(reader), _delimiter(delimiter), _buffer((buffer > 0) ? buffer : 1), _begin(0), _end(0), _scan(0), _eof(false), _lines(0)
+{
+}
+
+bool LineReader::ReadLine(std::string_view& line)
+{
+    for (;;)
+    {
+        // Search the delimiter in the not yet scanned part of the buffer
+        const char* data = _buffer.data();
+        const char* found = (const char*)std::memchr(data + _scan, _delimiter, _end - _scan);
+        if (found != nullptr)
+        {
+            size_t size = found - (data + _begin);
+            if ((_delimiter == '\n') && (size > 0) && (data[_begin + size - 1] == '\r'))
+                --size;
+            line = std::string_view(data + _begin, size);
+            _begin = _scan = (found - data) + 1;
+            ++_lines;
+            return true;
+        }
+        _scan = _end;
+
+        // Return the last line without the trailing delimiter
+        if (_eof)
+        {
+            if (_begin == _end)
+                return false;
+            size_t size = _end - _begin;
+            if ((_delimiter == '\n') && (data[_begin + size - 1] == '\r'))
+                --size;
+            line = std::string_view(data + _begin, size);
+            _begin = _scan = _end;
+            ++_lines;
+            return true;
+        }
+
+        // Move the incomplete line to the beginning of the buffer
+        if (_begin > 0)
+        {
+            std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+            _end -= _begin;
+            _scan -= _begin;
+            _begin = 0;
+        }
+
+        // Grow the buffer if the incomplete line occupies it completely
+        if (_end == _buffer.size())
+            _buffer.resize(_buffer.size() * 2);
+
+        // Fill the buffer from the source reader
+        size_t result = _reader.Read(_buffer.data() + _end, _buffer.size() - _end);
+        if (result == 0)
+            _eof = true;
+        _end += result;
+    }
+}
+
+} // namespace CppCommon
@@ -8,10 +8,24 @@
 
 #include "common/reader.h"
 
+#include "common/line_reader.h"
 #include "utility/countof.h"
 
 namespace CppCommon {
 
+size_t Reader::ReadV(std::span<const IOBuffer> buffers)
+{
+    size_t result = 0;
+    for (const auto& buffer : buffers)
+    {
+        size_t size = Read(buffer.data, buffer.size);
+        result += size;
+        if (size != buffer.size)
+            break;
+    }
+    return result;
+}
+
 std::vector<uint8_t> Reader::ReadAllBytes()
 {
     const size_t PAGE = 8192;
@@ -31,28 +45,42 @@ std::vector<uint8_t> Reader::ReadAllBytes()
 
 std::string Reader::ReadAllText()
 {
-    std::vector<uint8_t> bytes = ReadAllBytes();
-    return std::string(bytes.begin(), bytes.end());
+    const size_t PAGE = 8192;
+
+    // Read directly into the result string to avoid the intermediate bytes buffer
+    char buffer[PAGE];
+    std::string result;
+    size_t size = 0;
+
+    do
+    {
+        size = Read(buffer, countof(buffer));
+        result.append(buffer, size);
+    } while (size == countof(buffer));
+
+    return result;
 }
 
 std::vector<std::string> Reader::ReadAllLines()
 {
-    std::string temp;
     std::vector<std::string> result;
-    std::vector<uint8_t> bytes = ReadAllBytes();
 
-    for (auto ch : bytes)
+    // Stream lines through the line reader buffer
+    LineReader reader(*this);
+    std::string_view line;
+    while (reader.ReadLine(line))
     {
-        if ((ch == '\r') || (ch == '\n'))
+        // Carriage return is also treated as a line separator and empty lines are skipped
+        size_t start = 0;
+        while (start < line.size())
         {
-            if (!temp.empty())
-            {
-                result.push_back(temp);
-                temp.clear();
-            }
+            size_t end = line.find('\r', start);
+            if (end == std::string_view::npos)
+                end = line.size();
+            if (end > start)
+                result.emplace_back(line.substr(start, end - start));
+            start = end + 1;
         }
-        else
-            temp += ch;
     }
 
     return result;
@@ -0,0 +1,101 @@
+/*!
+    \file record_reader.cpp
+    \brief Streaming record reader implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "common/record_reader.h"
+
+#include "errors/exceptions.h"
+#include "string/format.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace CppCommon {
+
+const size_t RecordReader::DEFAULT_BUFFER = 65536;
+const size_t RecordReader::DEFAULT_MAX_RECORD = 16777216;
+
+RecordReader::RecordReader(Reader& reader, size_t buffer, size_t max_record)
+    : _reader(reader), _buffer((buffer > 0) ? buffer : 1), _max_record(max_record), _begin(0), _end(0), _eof(false), _records(0)
+{
+}
+
+bool RecordReader::Fill(size_t size)
+{
+    while ((_end - _begin) < size)
+    {
+        if (_eof)
+        {
+            if (_begin == _end)
+                return false;
+            throwex RuntimeException("Stream ends in the middle of the record!");
+        }
+
+        // Move the incomplete record to the beginning of the buffer
+        if (_begin > 0)
+        {
+            std::memmove(_buffer.data(), _buffer.data() + _begin, _end - _begin);
+            _end -= _begin;
+            _begin = 0;
+        }
+
+        // Grow the buffer if the record does not fit into it
+        if (_buffer.size() < size)
+            _buffer.resize(std::max(size, _buffer.size() * 2));
+
+        // Fill the buffer from the source reader
+        size_t result = _reader.Read(_buffer.data() + _end, _buffer.size() - _end);
+        if (result == 0)
+            _eof = true;
+        _end += result;
+    }
+    return true;
+}
+
+bool RecordReader::ReadRecord(size_t size, std::span<const uint8_t>& record)
+{
+    if (size > _max_record)
+        throwex ArgumentException("Record size is greater than the maximal record size!");
+
+    if (!Fill(size))
+        return false;
+
+    record = std::span<const uint8_t>(_buffer.data() + _begin, size);
+    _begin += size;
+    ++_records;
+    return true;
+}
+
+bool RecordReader::ReadPrefixedRecord(std::span<const uint8_t>& record, size_t prefix)
+{
+    assert(((prefix == 1) || (prefix == 2) || (prefix == 4) || (prefix == 8)) && "Invalid record length prefix size!");
+    if ((prefix != 1) && (prefix != 2) && (prefix != 4) && (prefix != 8))
+        throwex ArgumentException("Invalid record length prefix size!");
+
+    if (!Fill(prefix))
+        return false;
+
+    // Decode the little-endian record length
+    uint64_t length = 0;
+    for (size_t i = 0; i < prefix; ++i)
+        length |= ((uint64_t)_buffer[_begin + i]) << (8 * i);
+
+    if ((length > _max_record) || ((prefix + (size_t)length) > _max_record))
+        throwex RuntimeException(format("Record length {} is greater than the maximal record size {}!", length, _max_record));
+
+    size_t size = prefix + (size_t)length;
+    if (!Fill(size))
+        return false;
+
+    record = std::span<const uint8_t>(_buffer.data() + _begin + prefix, (size_t)length);
+    _begin += size;
+    ++_records;
+    return true;
+}
+
+} // namespace CppCommon
@@ -12,6 +12,19 @@
 
 namespace CppCommon {
 
+size_t Writer::WriteV(std::span<const ConstIOBuffer> buffers)
+{
+    size_t result = 0;
+    for (const auto& buffer : buffers)
+    {
+        size_t size = Write(buffer.data, buffer.size);
+        result += size;
+        if (size != buffer.size)
+            break;
+    }
+    return result;
+}
+
 size_t Writer::Write(const std::string& text)
 {
     return Write(text.data(), text.size());
@@ -0,0 +1,687 @@
+/*!
+    \file async_io.cpp
+    \brief Asynchronous file I/O engine implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/async_io.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "string/format.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/thread.h"
+#include "threads/wait_queue.h"
+
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter) && defined(__NR_io_uring_register)
+#define CPPCOMMON_ASYNC_IO_URING
+#endif
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class AsyncIO::Impl
+{
+public:
+    enum class OperationType { READ, WRITE, SYNC };
+
+    Impl(size_t depth, AsyncIOBackend backend, size_t threads) : _depth(depth), _backend(backend), _operations(depth), _pending(0), _queue(depth)
+    {
+        assert((depth > 0) && "Asynchronous I/O queue depth must be greater than zero!");
+        if (depth == 0)
+            throwex SystemException("Asynchronous I/O queue depth must be greater than zero!");
+
+        _free.reserve(depth);
+        for (size_t i = depth; i > 0; --i)
+            _free.push_back(i - 1);
+
+        if (_backend == AsyncIOBackend::AUTO)
+            _backend = IsUringAvailable() ? AsyncIOBackend::URING : AsyncIOBackend::THREADS;
+
+        if (_backend == AsyncIOBackend::URING)
+            SetupUring();
+        else
+        {
+            if (threads == 0)
+                threads = 1;
+            _prepared.reserve(depth);
+            for (size_t i = 0; i < threads; ++i)
+                _threads.emplace_back(Thread::Start([this]() { Worker(); }));
+        }
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            // Wait for all in-flight operations because they refer user buffers
+            Drain();
+        }
+        catch (const SystemException& ex)
+        {
+            fatality(SystemException(ex.string()));
+        }
+
+        if (_backend == AsyncIOBackend::URING)
+            CleanupUring();
+        else
+        {
+            _queue.Close();
+            for (auto& thread : _threads)
+                thread.join();
+        }
+    }
+
+    AsyncIOBackend backend() const noexcept { return _backend; }
+    size_t depth() const noexcept { return _depth; }
+    size_t pending() const noexcept { return _pending; }
+
+    static bool IsUringAvailable()
+    {
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        static bool available = []()
+        {
+            struct io_uring_params params;
+            std::memset(&params, 0, sizeof(params));
+            int ring = (int)syscall(__NR_io_uring_setup, 1, &params);
+            if (ring < 0)
+                return false;
+            close(ring);
+            return true;
+        }();
+        return available;
+#else
+        return false;
+#endif
+    }
+
+    void RegisterBuffers(const std::vector<std::pair<void*, size_t>>& buffers)
+    {
+        if (_backend != AsyncIOBackend::URING)
+            return;
+
+        UnregisterBuffers();
+        if (buffers.empty())
+            return;
+
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        std::vector<struct iovec> iovecs(buffers.size());
+        for (size_t i = 0; i < buffers.size(); ++i)
+        {
+            iovecs[i].iov_base = buffers[i].first;
+            iovecs[i].iov_len = buffers[i].second;
+        }
+
+        int result = (int)syscall(__NR_io_uring_register, _ring, IORING_REGISTER_BUFFERS, iovecs.data(), (unsigned)iovecs.size());
+        if (result < 0)
+            throwex SystemException("Failed to register io_uring buffers!");
+
+        for (const auto& buffer : buffers)
+            _buffers.emplace_back((uint8_t*)buffer.first, buffer.second);
+#endif
+    }
+
+    void UnregisterBuffers()
+    {
+        if ((_backend != AsyncIOBackend::URING) || _buffers.empty())
+            return;
+
+        // Registered buffers could not be changed while operations are in-flight
+        Drain();
+
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        int result = (int)syscall(__NR_io_uring_register, _ring, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+        if (result < 0)
+            throwex SystemException("Failed to unregister io_uring buffers!");
+#endif
+        _buffers.clear();
+    }
+
+    void RegisterFiles(const std::vector<const File*>& files)
+    {
+        if (_backend != AsyncIOBackend::URING)
+            return;
+
+        UnregisterFiles();
+        if (files.empty())
+            return;
+
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        std::vector<int> descriptors(files.size());
+        for (size_t i = 0; i < files.size(); ++i)
+            descriptors[i] = (int)(size_t)files[i]->native();
+
+        int result = (int)syscall(__NR_io_uring_register, _ring, IORING_REGISTER_FILES, descriptors.data(), (unsigned)descriptors.size());
+        if (result < 0)
+            throwex SystemException("Failed to register io_uring files!");
+
+        _files = std::move(descriptors);
+#endif
+    }
+
+    void UnregisterFiles()
+    {
+        if ((_backend != AsyncIOBackend::URING) || _files.empty())
+            return;
+
+        // Registered files could not be changed while operations are in-flight
+        Drain();
+
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        int result = (int)syscall(__NR_io_uring_register, _ring, IORING_UNREGISTER_FILES, nullptr, 0);
+        if (result < 0)
+            throwex SystemException("Failed to unregister io_uring files!");
+#endif
+        _files.clear();
+    }
+
+    void Prepare(OperationType type, const File& file, void* buffer, size_t size, uint64_t offset, const Handler& handler)
+    {
+        assert(file.IsFileOpened() && "File is not opened!");
+        if (!file.IsFileOpened())
+            throwex SystemException("File is not opened!");
+
+        // Operations are issued on the native handle, so direct I/O requires aligned buffers, sizes and offsets
+        if ((type != OperationType::SYNC) && file.IsFileDirect())
+        {
+            const size_t alignment = File::DIRECT_ALIGNMENT;
+            if ((((size_t)buffer % alignment) != 0) || ((size % alignment) != 0) || ((offset % alignment) != 0))
+                throwex FileSystemException(format("Asynchronous I/O operation on the direct file must be aligned to {} bytes!", alignment)).Attach(file);
+        }
+
+        size_t index = Acquire();
+        Operation& operation = _operations[index];
+        operation.type = type;
+        operation.file = file.native();
+        operation.buffer = buffer;
+        operation.size = size;
+        operation.offset = offset;
+        operation.result = 0;
+        operation.handler = handler;
+        ++_pending;
+
+        if (_backend == AsyncIOBackend::URING)
+            PrepareUring(index);
+        else
+            _prepared.push_back(index);
+    }
+
+    size_t Submit()
+    {
+        if (_backend == AsyncIOBackend::URING)
+            return SubmitUring(0);
+
+        size_t submitted = _prepared.size();
+        for (size_t index : _prepared)
+            _queue.Enqueue(index);
+        _prepared.clear();
+        return submitted;
+    }
+
+    size_t Poll()
+    {
+        if (_backend == AsyncIOBackend::URING)
+            return ReapUring();
+        return ReapThreads(false);
+    }
+
+    size_t Wait(size_t count)
+    {
+        Submit();
+
+        size_t processed = 0;
+        while ((processed < count) && (_pending > 0))
+        {
+            if (_backend == AsyncIOBackend::URING)
+            {
+                size_t reaped = ReapUring();
+                if (reaped == 0)
+                    SubmitUring(1);
+                processed += reaped;
+            }
+            else
+            {
+                // Handlers may prepare new operations
+                Submit();
+                processed += ReapThreads(true);
+            }
+        }
+        return processed;
+    }
+
+    void Drain()
+    {
+        while (_pending > 0)
+            Wait(_pending);
+    }
+
+private:
+    struct Operation
+    {
+        OperationType type;
+        void* file;
+        void* buffer;
+        size_t size;
+        uint64_t offset;
+        int64_t result;
+        Handler handler;
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+        struct iovec iov;
+#endif
+    };
+
+    size_t _depth;
+    AsyncIOBackend _backend;
+    std::vector<Operation> _operations;
+    std::vector<size_t> _free;
+    size_t _pending;
+
+    // Thread pool backend
+    std::vector<size_t> _prepared;
+    std::vector<std::thread> _threads;
+    WaitQueue<size_t> _queue;
+    CriticalSection _cs;
+    ConditionVariable _cv;
+    std::vector<size_t> _completed;
+    std::vector<size_t> _completions;
+
+    // io_uring backend
+    std::vector<std::pair<uint8_t*, size_t>> _buffers;
+    std::vector<int> _files;
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+    int _ring{-1};
+    void* _sq_ptr{nullptr};
+    size_t _sq_size{0};
+    void* _cq_ptr{nullptr};
+    size_t _cq_size{0};
+    struct io_uring_sqe* _sqes{nullptr};
+    size_t _sqes_size{0};
+    unsigned* _sq_head{nullptr};
+    unsigned* _sq_tail{nullptr};
+    unsigned* _sq_mask{nullptr};
+    unsigned* _sq_entries{nullptr};
+    unsigned* _sq_array{nullptr};
+    unsigned* _cq_head{nullptr};
+    unsigned* _cq_tail{nullptr};
+    unsigned* _cq_mask{nullptr};
+    struct io_uring_cqe* _cqes{nullptr};
+    unsigned _sq_local_tail{0};
+    unsigned _sq_submitted_tail{0};
+#endif
+
+    size_t Acquire()
+    {
+        // Wait for a free operation slot
+        while (_free.empty())
+            Wait(1);
+
+        size_t index = _free.back();
+        _free.pop_back();
+        return index;
+    }
+
+    void Complete(size_t index)
+    {
+        Operation& operation = _operations[index];
+        Handler handler = std::move(operation.handler);
+        operation.handler = nullptr;
+        int64_t result = operation.result;
+
+        // Release the operation slot before the handler call to allow handler to prepare new operations
+        _free.push_back(index);
+        --_pending;
+
+        if (handler)
+            handler(result);
+    }
+
+    void Worker()
+    {
+        size_t index;
+        while (_queue.Dequeue(index))
+        {
+            Operation& operation = _operations[index];
+            operation.result = Execute(operation);
+
+            Locker<CriticalSection> locker(_cs);
+            _completed.push_back(index);
+            _cv.NotifyOne();
+        }
+    }
+
+    static int64_t Execute(const Operation& operation)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int file = (int)(size_t)operation.file;
+        ssize_t result = 0;
+        switch (operation.type)
+        {
+            case OperationType::READ:
+                result = pread(file, operation.buffer, operation.size, (off_t)operation.offset);
+                break;
+            case OperationType::WRITE:
+                result = pwrite(file, operation.buffer, operation.size, (off_t)operation.offset);
+                break;
+            case OperationType::SYNC:
+                result = fsync(file);
+                break;
+        }
+        return (result < 0) ? -(int64_t)errno : (int64_t)result;
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE file = (HANDLE)operation.file;
+        if (operation.type == OperationType::SYNC)
+            return FlushFileBuffers(file) ? 0 : -(int64_t)GetLastError();
+
+        OVERLAPPED overlapped;
+        std::memset(&overlapped, 0, sizeof(overlapped));
+        overlapped.Offset = (DWORD)(operation.offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(operation.offset >> 32);
+
+        DWORD result = 0;
+        BOOL success = (operation.type == OperationType::READ) ?
+            ReadFile(file, operation.buffer, (DWORD)operation.size, &result, &overlapped) :
+            WriteFile(file, operation.buffer, (DWORD)operation.size, &result, &overlapped);
+        if (!success)
+        {
+            DWORD error = GetLastError();
+            return (error == ERROR_HANDLE_EOF) ? 0 : -(int64_t)error;
+        }
+        return (int64_t)result;
+#endif
+    }
+
+    size_t ReapThreads(bool wait)
+    {
+        {
+            Locker<CriticalSection> locker(_cs);
+            if (wait)
+                _cv.Wait(_cs, [this]() { return !_completed.empty(); });
+            _completions.swap(_completed);
+        }
+
+        size_t processed = _completions.size();
+        for (size_t index : _completions)
+            Complete(index);
+        _completions.clear();
+        return processed;
+    }
+
+#if defined(CPPCOMMON_ASYNC_IO_URING)
+    void SetupUring()
+    {
+        struct io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        _ring = (int)syscall(__NR_io_uring_setup, (unsigned)_depth, &params);
+        if (_ring < 0)
+            throwex SystemException("Failed to setup io_uring instance!");
+
+        _sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single)
+            _sq_size = _cq_size = (_sq_size > _cq_size) ? _sq_size : _cq_size;
+
+        _sq_ptr = mmap(nullptr, _sq_size, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), _ring, IORING_OFF_SQ_RING);
+        if (_sq_ptr == MAP_FAILED)
+        {
+            _sq_ptr = nullptr;
+            CleanupUring();
+            throwex SystemException("Failed to map io_uring submission queue!");
+        }
+
+        if (single)
+            _cq_ptr = _sq_ptr;
+        else
+        {
+            _cq_ptr = mmap(nullptr, _cq_size, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), _ring, IORING_OFF_CQ_RING);
+            if (_cq_ptr == MAP_FAILED)
+            {
+                _cq_ptr = nullptr;
+                CleanupUring();
+                throwex SystemException("Failed to map io_uring completion queue!");
+            }
+        }
+
+        _sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+        void* sqes = mmap(nullptr, _sqes_size, (PROT_READ | PROT_WRITE), (MAP_SHARED | MAP_POPULATE), _ring, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            CleanupUring();
+            throwex SystemException("Failed to map io_uring submission entries!");
+        }
+        _sqes = (struct io_uring_sqe*)sqes;
+
+        uint8_t* sq = (uint8_t*)_sq_ptr;
+        _sq_head = (unsigned*)(sq + params.sq_off.head);
+        _sq_tail = (unsigned*)(sq + params.sq_off.tail);
+        _sq_mask = (unsigned*)(sq + params.sq_off.ring_mask);
+        _sq_entries = (unsigned*)(sq + params.sq_off.ring_entries);
+        _sq_array = (unsigned*)(sq + params.sq_off.array);
+
+        uint8_t* cq = (uint8_t*)_cq_ptr;
+        _cq_head = (unsigned*)(cq + params.cq_off.head);
+        _cq_tail = (unsigned*)(cq + params.cq_off.tail);
+        _cq_mask = (unsigned*)(cq + params.cq_off.ring_mask);
+        _cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+
+        _sq_local_tail = _sq_submitted_tail = *_sq_tail;
+    }
+
+    void CleanupUring()
+    {
+        if (_sqes != nullptr)
+            munmap(_sqes, _sqes_size);
+        if ((_cq_ptr != nullptr) && (_cq_ptr != _sq_ptr))
+            munmap(_cq_ptr, _cq_size);
+        if (_sq_ptr != nullptr)
+            munmap(_sq_ptr, _sq_size);
+        if (_ring >= 0)
+            close(_ring);
+        _sqes = nullptr;
+        _cq_ptr = nullptr;
+        _sq_ptr = nullptr;
+        _ring = -1;
+    }
+
+    void PrepareUring(size_t index)
+    {
+        // Submit prepared entries if the submission queue is full
+        if ((_sq_local_tail - __atomic_load_n(_sq_head, __ATOMIC_ACQUIRE)) >= *_sq_entries)
+            SubmitUring(0);
+
+        Operation& operation = _operations[index];
+        unsigned slot = _sq_local_tail & *_sq_mask;
+        struct io_uring_sqe* sqe = &_sqes[slot];
+        std::memset(sqe, 0, sizeof(*sqe));
+
+        // Use the registered file if possible
+        int file = (int)(size_t)operation.file;
+        for (size_t i = 0; i < _files.size(); ++i)
+        {
+            if (_files[i] == file)
+            {
+                file = (int)i;
+                sqe->flags |= IOSQE_FIXED_FILE;
+                break;
+            }
+        }
+        sqe->fd = file;
+        sqe->user_data = (uint64_t)index;
+
+        if (operation.type == OperationType::SYNC)
+            sqe->opcode = IORING_OP_FSYNC;
+        else
+        {
+            bool read = (operation.type == OperationType::READ);
+            sqe->off = operation.offset;
+
+            // Use the registered buffer if possible
+            uint8_t* buffer = (uint8_t*)operation.buffer;
+            for (size_t i = 0; i < _buffers.size(); ++i)
+            {
+                if ((buffer >= _buffers[i].first) && ((buffer + operation.size) <= (_buffers[i].first + _buffers[i].second)))
+                {
+                    sqe->opcode = read ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+                    sqe->addr = (uint64_t)(uintptr_t)buffer;
+                    sqe->len = (uint32_t)operation.size;
+                    sqe->buf_index = (uint16_t)i;
+                    break;
+                }
+            }
+
+            if (sqe->opcode == 0)
+            {
+                operation.iov.iov_base = buffer;
+                operation.iov.iov_len = operation.size;
+                sqe->opcode = read ? IORING_OP_READV : IORING_OP_WRITEV;
+                sqe->addr = (uint64_t)(uintptr_t)&operation.iov;
+                sqe->len = 1;
+            }
+        }
+
+        _sq_array[slot] = slot;
+        ++_sq_local_tail;
+    }
+
+    size_t SubmitUring(unsigned wait)
+    {
+        unsigned count = _sq_local_tail - _sq_submitted_tail;
+        if ((count == 0) && (wait == 0))
+            return 0;
+
+        // Publish prepared entries to the kernel
+        __atomic_store_n(_sq_tail, _sq_local_tail, __ATOMIC_RELEASE);
+
+        unsigned submitted = 0;
+        do
+        {
+            int result = (int)syscall(__NR_io_uring_enter, _ring, count - submitted, wait, ((wait > 0) ? IORING_ENTER_GETEVENTS : 0), nullptr, 0);
+            if (result < 0)
+            {
+                if ((errno == EINTR) || (errno == EAGAIN) || (errno == EBUSY))
+                {
+                    // Reap completions to free the kernel resources and retry
+                    if (errno != EINTR)
+                        ReapUring();
+                    continue;
+                }
+                throwex SystemException("Failed to submit io_uring operations!");
+            }
+            submitted += (unsigned)result;
+            wait = 0;
+        } while (submitted < count);
+
+        _sq_submitted_tail = _sq_local_tail;
+        return count;
+    }
+
+    size_t ReapUring()
+    {
+        size_t processed = 0;
+        unsigned head = *_cq_head;
+        unsigned tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            struct io_uring_cqe* cqe = &_cqes[head & *_cq_mask];
+            size_t index = (size_t)cqe->user_data;
+            _operations[index].result = (int64_t)cqe->res;
+            ++head;
+
+            // Release the completion entry before the handler call
+            __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+
+            Complete(index);
+            ++processed;
+
+            tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+        }
+        return processed;
+    }
+#else
+    void SetupUring() { throwex SystemException("io_uring backend is not available!"); }
+    void CleanupUring() {}
+    void PrepareUring(size_t) {}
+    size_t SubmitUring(unsigned) { return 0; }
+    size_t ReapUring() { return 0; }
+#endif
+};
+
+//! @endcond
+
+const size_t AsyncIO::DEFAULT_DEPTH = 128;
+const size_t AsyncIO::DEFAULT_THREADS = 4;
+
+AsyncIO::AsyncIO(size_t depth, AsyncIOBackend backend, size_t threads) : _pimpl(std::make_unique<Impl>(depth, backend, threads))
+{
+}
+
+AsyncIO::~AsyncIO() = default;
+
+AsyncIOBackend AsyncIO::backend() const noexcept { return _pimpl->backend(); }
+size_t AsyncIO::depth() const noexcept { return _pimpl->depth(); }
+size_t AsyncIO::pending() const noexcept { return _pimpl->pending(); }
+
+bool AsyncIO::IsUringAvailable() { return Impl::IsUringAvailable(); }
+
+void AsyncIO::RegisterBuffers(const std::vector<std::pair<void*, size_t>>& buffers) { _pimpl->RegisterBuffers(buffers); }
+void AsyncIO::UnregisterBuffers() { _pimpl->UnregisterBuffers(); }
+void AsyncIO::RegisterFiles(const std::vector<const File*>& files) { _pimpl->RegisterFiles(files); }
+void AsyncIO::UnregisterFiles() { _pimpl->UnregisterFiles(); }
+
+void AsyncIO::Read(const File& file, void* buffer, size_t size, uint64_t offset, const Handler& handler)
+{
+    _pimpl->Prepare(Impl::OperationType::READ, file, buffer, size, offset, handler);
+}
+
+std::future<int64_t> AsyncIO::Read(const File& file, void* buffer, size_t size, uint64_t offset)
+{
+    auto promise = std::make_shared<std::promise<int64_t>>();
+    auto future = promise->get_future();
+    _pimpl->Prepare(Impl::OperationType::READ, file, buffer, size, offset, [promise](int64_t result) { promise->set_value(result); });
+    return future;
+}
+
+void AsyncIO::Write(const File& file, const void* buffer, size_t size, uint64_t offset, const Handler& handler)
+{
+    _pimpl->Prepare(Impl::OperationType::WRITE, file, (void*)buffer, size, offset, handler);
+}
+
+std::future<int64_t> AsyncIO::Write(const File& file, const void* buffer, size_t size, uint64_t offset)
+{
+    auto promise = std::make_shared<std::promise<int64_t>>();
+    auto future = promise->get_future();
+    _pimpl->Prepare(Impl::OperationType::WRITE, file, (void*)buffer, size, offset, [promise](int64_t result) { promise->set_value(result); });
+    return future;
+}
+
+void AsyncIO::Sync(const File& file, const Handler& handler)
+{
+    _pimpl->Prepare(Impl::OperationType::SYNC, file, nullptr, 0, 0, handler);
+}
+
+size_t AsyncIO::Submit() { return _pimpl->Submit(); }
+size_t AsyncIO::Poll() { return _pimpl->Poll(); }
+size_t AsyncIO::Wait(size_t count) { return _pimpl->Wait(count); }
+void AsyncIO::Drain() { _pimpl->Drain(); }
+
+} // namespace CppCommon
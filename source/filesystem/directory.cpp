@@ -12,7 +12,6 @@
 #include "utility/resource.h"
 
 #include <cstring>
-#include <regex>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/stat.h>
@@ -135,29 +134,41 @@ DirectoryIterator Directory::rend() const
 }
 
 std::vector<Path> Directory::GetEntries(const std::string& pattern)
+{
+    return GetEntries(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Path> Directory::GetEntries(const PatternSet& patterns)
 {
     std::vector<Path> result;
-    std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+        if (patterns.empty() || patterns.Match(it->filename().string()))
             result.push_back(*it);
     return result;
 }
 
 std::vector<Path> Directory::GetEntriesRecursive(const std::string& pattern)
+{
+    return GetEntriesRecursive(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Path> Directory::GetEntriesRecursive(const PatternSet& patterns)
 {
     std::vector<Path> result;
-    std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+        if (patterns.empty() || patterns.Match(it->filename().string()))
             result.push_back(Directory(*it));
     return result;
 }
 
 std::vector<Directory> Directory::GetDirectories(const std::string& pattern)
+{
+    return GetDirectories(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Directory> Directory::GetDirectories(const PatternSet& patterns)
 {
     std::vector<Directory> result;
-    std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
     {
         // Special check for symbolic link
@@ -167,16 +178,20 @@ std::vector<Directory> Directory::GetDirectories(const std::string& pattern)
 
         // Special check for directory
         if (target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
 }
 
 std::vector<Directory> Directory::GetDirectoriesRecursive(const std::string& pattern)
+{
+    return GetDirectoriesRecursive(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Directory> Directory::GetDirectoriesRecursive(const PatternSet& patterns)
 {
     std::vector<Directory> result;
-    std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
     {
         // Special check for symbolic link
@@ -186,16 +201,20 @@ std::vector<Directory> Directory::GetDirectoriesRecursive(const std::string& pat
 
         // Special check for directory
         if (target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
 }
 
 std::vector<File> Directory::GetFiles(const std::string& pattern)
+{
+    return GetFiles(PatternSet::FromRegex(pattern));
+}
+
+std::vector<File> Directory::GetFiles(const PatternSet& patterns)
 {
     std::vector<File> result;
-    std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
     {
         // Special check for symbolic link
@@ -205,16 +224,20 @@ std::vector<File> Directory::GetFiles(const std::string& pattern)
 
         // Special check for directory
         if (!target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
 }
 
 std::vector<File> Directory::GetFilesRecursive(const std::string& pattern)
+{
+    return GetFilesRecursive(PatternSet::FromRegex(pattern));
+}
+
+std::vector<File> Directory::GetFilesRecursive(const PatternSet& patterns)
 {
     std::vector<File> result;
-    std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
     {
         // Special check for symbolic link
@@ -224,35 +247,43 @@ std::vector<File> Directory::GetFilesRecursive(const std::string& pattern)
 
         // Special check for directory
         if (!target.IsDirectory())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
 }
 
 std::vector<Symlink> Directory::GetSymlinks(const std::string& pattern)
+{
+    return GetSymlinks(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Symlink> Directory::GetSymlinks(const PatternSet& patterns)
 {
     std::vector<Symlink> result;
-    std::regex matcher(pattern);
     for (auto it = begin(); it != end(); ++it)
     {
         // Special check for symbolic link
         if (it->IsSymlink())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
 }
 
 std::vector<Symlink> Directory::GetSymlinksRecursive(const std::string& pattern)
+{
+    return GetSymlinksRecursive(PatternSet::FromRegex(pattern));
+}
+
+std::vector<Symlink> Directory::GetSymlinksRecursive(const PatternSet& patterns)
 {
     std::vector<Symlink> result;
-    std::regex matcher(pattern);
     for (auto it = rbegin(); it != rend(); ++it)
     {
         // Special check for symbolic link
         if (it->IsSymlink())
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (patterns.empty() || patterns.Match(it->filename().string()))
                 result.emplace_back(*it);
     }
     return result;
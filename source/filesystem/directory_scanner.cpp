@@ -0,0 +1,370 @@
+/*!
+    \file directory_scanner.cpp
+    \brief Filesystem directory scanner implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/directory_scanner.h"
+
+#include "filesystem/exceptions.h"
+#include "threads/condition_variable.h"
+#include "threads/critical_section.h"
+#include "threads/thread.h"
+#include "utility/resource.h"
+
+#include <cstring>
+#include <exception>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if defined(__linux__)
+
+// Directory entry layout returned by the getdents64 system call
+struct LinuxDirent64
+{
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[1];
+};
+
+// Size of the directory entries batch buffer
+const size_t SCAN_BUFFER = 32768;
+
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+FileType ConvertType(unsigned char type)
+{
+    switch (type)
+    {
+        case DT_REG:
+            return FileType::REGULAR;
+        case DT_DIR:
+            return FileType::DIRECTORY;
+        case DT_LNK:
+            return FileType::SYMLINK;
+        case DT_BLK:
+            return FileType::BLOCK;
+        case DT_CHR:
+            return FileType::CHARACTER;
+        case DT_FIFO:
+            return FileType::FIFO;
+        case DT_SOCK:
+            return FileType::SOCKET;
+        default:
+            return FileType::UNKNOWN;
+    }
+}
+
+FileType ConvertMode(mode_t mode)
+{
+    if (S_ISREG(mode))
+        return FileType::REGULAR;
+    else if (S_ISDIR(mode))
+        return FileType::DIRECTORY;
+    else if (S_ISLNK(mode))
+        return FileType::SYMLINK;
+    else if (S_ISBLK(mode))
+        return FileType::BLOCK;
+    else if (S_ISCHR(mode))
+        return FileType::CHARACTER;
+    else if (S_ISFIFO(mode))
+        return FileType::FIFO;
+    else if (S_ISSOCK(mode))
+        return FileType::SOCKET;
+    else
+        return FileType::UNKNOWN;
+}
+
+bool IsDots(const char* name)
+{
+    return ((name[0] == '.') && ((name[1] == 0) || ((name[1] == '.') && (name[2] == 0))));
+}
+
+// Get the status of the directory entry relative to the opened directory descriptor.
+// Returns false if the entry was removed after it was read from the directory.
+bool StatEntry(const Path& directory, int descriptor, const char* name, bool status, DirectoryEntry& entry)
+{
+#if defined(__linux__) && defined(STATX_TYPE)
+    struct statx stx;
+    unsigned int mask = STATX_TYPE | (status ? (STATX_SIZE | STATX_MTIME) : 0);
+    int result = statx(descriptor, name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT, mask, &stx);
+    if (result != 0)
+    {
+        if (errno == ENOENT)
+            return false;
+        throwex FileSystemException("Cannot get the status of the directory entry!").Attach(directory);
+    }
+    entry.type = ConvertMode(stx.stx_mode);
+    if (status)
+    {
+        entry.size = stx.stx_size;
+        entry.modified = ((uint64_t)stx.stx_mtime.tv_sec * 1000000000) + stx.stx_mtime.tv_nsec;
+    }
+#else
+    struct stat st;
+    int result = fstatat(descriptor, name, &st, AT_SYMLINK_NOFOLLOW);
+    if (result != 0)
+    {
+        if (errno == ENOENT)
+            return false;
+        throwex FileSystemException("Cannot get the status of the directory entry!").Attach(directory);
+    }
+    entry.type = ConvertMode(st.st_mode);
+    if (status)
+    {
+        entry.size = (uint64_t)st.st_size;
+#if defined(__APPLE__)
+        entry.modified = ((uint64_t)st.st_mtimespec.tv_sec * 1000000000) + st.st_mtimespec.tv_nsec;
+#else
+        entry.modified = ((uint64_t)st.st_mtim.tv_sec * 1000000000) + st.st_mtim.tv_nsec;
+#endif
+    }
+#endif
+    return true;
+}
+
+#endif
+
+// Scan a single directory, call the handler for each entry and report all subdirectories
+template <typename TSubdirectory>
+void ScanDirectory(const Path& directory, const DirectoryScanner::Handler& handler, bool recursive, bool status, TSubdirectory&& subdirectory)
+{
+    DirectoryEntry entry;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    // Prepare the entry path prefix
+    std::string prefix = directory.string();
+    if (!prefix.empty() && (prefix.back() != Path::separator()))
+        prefix += Path::separator();
+
+    auto process = [&](int descriptor, const char* name, uint64_t inode, unsigned char type)
+    {
+        if (IsDots(name))
+            return;
+
+        entry.path = Path(prefix + name);
+        entry.inode = inode;
+        entry.type = ConvertType(type);
+        if ((entry.type == FileType::UNKNOWN) || status)
+            if (!StatEntry(directory, descriptor, name, status, entry))
+                return;
+
+        handler(entry);
+
+        if (recursive && (entry.type == FileType::DIRECTORY))
+            subdirectory(entry.path);
+    };
+#endif
+
+#if defined(__linux__)
+    int descriptor = open(directory.string().c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (descriptor < 0)
+        throwex FileSystemException("Cannot open a directory!").Attach(directory);
+
+    // Smart resource cleaner pattern
+    auto cleaner = resource([descriptor](void*) { close(descriptor); });
+
+    // Read directory entries in large batches
+    alignas(LinuxDirent64) char buffer[SCAN_BUFFER];
+    for (;;)
+    {
+        long count = syscall(SYS_getdents64, descriptor, buffer, sizeof(buffer));
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throwex FileSystemException("Cannot read directory entries!").Attach(directory);
+        }
+        if (count == 0)
+            break;
+
+        for (long offset = 0; offset < count;)
+        {
+            const LinuxDirent64* dirent = (const LinuxDirent64*)(buffer + offset);
+            offset += dirent->d_reclen;
+            process(descriptor, dirent->d_name, dirent->d_ino, dirent->d_type);
+        }
+    }
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    DIR* dir = opendir(directory.string().c_str());
+    if (dir == nullptr)
+        throwex FileSystemException("Cannot open a directory!").Attach(directory);
+
+    // Smart resource cleaner pattern
+    auto cleaner = resource(dir, [](DIR* handle) { closedir(handle); });
+
+    int descriptor = dirfd(dir);
+    struct dirent* pentry;
+    while ((pentry = readdir(dir)) != nullptr)
+        process(descriptor, pentry->d_name, (uint64_t)pentry->d_ino, pentry->d_type);
+#elif defined(_WIN32) || defined(_WIN64)
+    WIN32_FIND_DATAW data;
+    HANDLE hFind = FindFirstFileExW((directory / "*").wstring().c_str(), FindExInfoBasic, &data, FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if (hFind == INVALID_HANDLE_VALUE)
+        throwex FileSystemException("Cannot open a directory!").Attach(directory);
+
+    // Smart resource cleaner pattern
+    auto cleaner = resource(hFind, [](HANDLE hObject) { FindClose(hObject); });
+
+    do
+    {
+        if ((std::wcscmp(data.cFileName, L".") == 0) || (std::wcscmp(data.cFileName, L"..") == 0))
+            continue;
+
+        entry.path = directory / data.cFileName;
+        entry.inode = 0;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            entry.type = FileType::SYMLINK;
+        else if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            entry.type = FileType::DIRECTORY;
+        else
+            entry.type = FileType::REGULAR;
+        if (status)
+        {
+            ULARGE_INTEGER size;
+            size.HighPart = data.nFileSizeHigh;
+            size.LowPart = data.nFileSizeLow;
+            entry.size = size.QuadPart;
+
+            // Convert the Windows file time (100 ns since 01.01.1601) into the Unix time in nanoseconds
+            ULARGE_INTEGER modified;
+            modified.HighPart = data.ftLastWriteTime.dwHighDateTime;
+            modified.LowPart = data.ftLastWriteTime.dwLowDateTime;
+            entry.modified = (modified.QuadPart - 116444736000000000ull) * 100;
+        }
+
+        handler(entry);
+
+        if (recursive && (entry.type == FileType::DIRECTORY))
+            subdirectory(entry.path);
+    } while (FindNextFileW(hFind, &data) != 0);
+
+    if (GetLastError() != ERROR_NO_MORE_FILES)
+        throwex FileSystemException("Cannot read directory entries!").Attach(directory);
+#endif
+}
+
+} // namespace Internals
+//! @endcond
+
+void DirectoryScanner::Scan(const Path& directory, const Handler& handler, bool recursive, bool status, size_t threads)
+{
+    // Sequential depth-first scan
+    if (!recursive || (threads <= 1))
+    {
+        std::vector<Path> pending;
+        pending.push_back(directory);
+        while (!pending.empty())
+        {
+            Path current = std::move(pending.back());
+            pending.pop_back();
+            Internals::ScanDirectory(current, handler, recursive, status, [&pending](const Path& subdirectory) { pending.push_back(subdirectory); });
+        }
+        return;
+    }
+
+    // Parallel scan: each worker takes a directory from the shared pending
+    // list, scans it and publishes all found subdirectories with one lock
+    CriticalSection cs;
+    ConditionVariable cv;
+    std::vector<Path> pending;
+    size_t active = 0;
+    std::exception_ptr error;
+
+    pending.push_back(directory);
+
+    auto worker = [&]()
+    {
+        std::vector<Path> found;
+        for (;;)
+        {
+            Path current;
+            {
+                Locker<CriticalSection> locker(cs);
+
+                // Wait for a pending directory or the end of the scan
+                cv.Wait(cs, [&]() { return (!pending.empty() || (active == 0) || error); });
+                if (pending.empty() || error)
+                    return;
+
+                current = std::move(pending.back());
+                pending.pop_back();
+                ++active;
+            }
+
+            try
+            {
+                Internals::ScanDirectory(current, handler, true, status, [&found](const Path& subdirectory) { found.push_back(subdirectory); });
+            }
+            catch (...)
+            {
+                Locker<CriticalSection> locker(cs);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            {
+                Locker<CriticalSection> locker(cs);
+                for (auto& subdirectory : found)
+                    pending.push_back(std::move(subdirectory));
+                --active;
+                if (!found.empty() || (active == 0) || error)
+                    cv.NotifyAll();
+            }
+            found.clear();
+        }
+    };
+
+    // Start additional workers and join them to the scan
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < threads; ++i)
+        workers.emplace_back(Thread::Start(worker));
+    worker();
+    for (auto& thread : workers)
+        thread.join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+std::vector<DirectoryEntry> DirectoryScanner::ScanAll(const Path& directory, bool recursive, bool status, size_t threads)
+{
+    std::vector<DirectoryEntry> result;
+
+    if (!recursive || (threads <= 1))
+    {
+        Scan(directory, [&result](const DirectoryEntry& entry) { result.push_back(entry); }, recursive, status, threads);
+        return result;
+    }
+
+    CriticalSection cs;
+    Scan(directory, [&cs, &result](const DirectoryEntry& entry)
+    {
+        Locker<CriticalSection> locker(cs);
+        result.push_back(entry);
+    }, recursive, status, threads);
+    return result;
+}
+
+} // namespace CppCommon
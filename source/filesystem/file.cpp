@@ -12,12 +12,21 @@
 #include "utility/validate_aligned_storage.h"
 
 #include <cassert>
+#include <climits>
 #include <cstring>
+#include <new>
+#include <type_traits>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <fcntl.h>
 #include <unistd.h>
+#if defined(__linux__)
+#include <linux/fs.h>
+#include <sys/sendfile.h>
+#endif
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
 #endif
@@ -26,15 +35,98 @@ namespace CppCommon {
 
 //! @cond INTERNALS
 
+namespace Internals {
+
+// Thread-cached pool of file buffers. Files which are opened and closed in
+// a loop reuse the same buffers without touching the heap allocator.
+class FileBufferPool
+{
+public:
+    static uint8_t* Acquire(size_t size, size_t alignment)
+    {
+        // Take the suitable buffer from the cache of the current thread
+        Cache& cache = instance();
+        for (size_t i = cache.count; i-- > 0;)
+        {
+            if ((cache.slots[i].size == size) && (cache.slots[i].alignment == alignment))
+            {
+                uint8_t* buffer = cache.slots[i].buffer;
+                cache.slots[i] = cache.slots[--cache.count];
+                return buffer;
+            }
+        }
+        return (uint8_t*)::operator new(size, std::align_val_t(alignment), std::nothrow);
+    }
+
+    static void Release(uint8_t* buffer, size_t size, size_t alignment)
+    {
+        // Return the buffer into the cache of the current thread
+        Cache& cache = instance();
+        if (!cache.destroyed && (cache.count < CACHE_SIZE))
+        {
+            cache.slots[cache.count++] = { buffer, size, alignment };
+            return;
+        }
+        ::operator delete(buffer, std::align_val_t(alignment));
+    }
+
+private:
+    // Count of cached buffers per thread
+    static const size_t CACHE_SIZE = 8;
+
+    struct Slot
+    {
+        uint8_t* buffer;
+        size_t size;
+        size_t alignment;
+    };
+
+    // Cache is trivially destructible, so its storage remains valid until
+    // the thread exits and files closed by other thread-local destructors
+    // could still safely release their buffers into it
+    struct Cache
+    {
+        Slot slots[CACHE_SIZE];
+        size_t count;
+        bool destroyed;
+    };
+
+    // Cleaner frees cached buffers on the thread exit. Buffers released
+    // after that are returned directly into the heap allocator.
+    struct Cleaner
+    {
+        Cache& cache;
+
+        ~Cleaner()
+        {
+            for (size_t i = 0; i < cache.count; ++i)
+                ::operator delete(cache.slots[i].buffer, std::align_val_t(cache.slots[i].alignment));
+            cache.count = 0;
+            cache.destroyed = true;
+        }
+    };
+
+    static Cache& instance()
+    {
+        static_assert(std::is_trivially_destructible_v<Cache>, "Thread cache of file buffers must be trivially destructible!");
+        thread_local Cache cache;
+        thread_local Cleaner cleaner{ cache };
+        return cleaner.cache;
+    }
+};
+
+} // namespace Internals
+
 class File::Impl
 {
     friend class File;
 
 public:
-    explicit Impl(const Path* path) : _path(path), _read(false), _read_index(0), _read_size(0), _read_buffer(), _write(false), _write_index(0), _write_size(0), _write_buffer()
+    explicit Impl(const Path* path) : _path(path), _direct(false), _read(false), _read_owned(false), _read_index(0), _read_size(0), _read_capacity(0), _read_buffer(nullptr), _write(false), _write_owned(false), _write_index(0), _write_size(0), _write_capacity(0), _write_buffer(nullptr)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         _file = -1;
+        _cached = -1;
 #elif defined(_WIN32) || defined(_WIN64)
         _file = INVALID_HANDLE_VALUE;
 #endif
@@ -55,6 +147,25 @@ public:
 
     const Path& path() const { return *_path; }
 
+    void* native() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (void*)(size_t)_file;
+#elif defined(_WIN32) || defined(_WIN64)
+        return _file;
+#endif
+    }
+
+    std::span<const uint8_t> read_buffer() const noexcept
+    {
+        return { _read_buffer, (_read_buffer != nullptr) ? _read_capacity : 0 };
+    }
+
+    std::span<const uint8_t> write_buffer() const noexcept
+    {
+        return { _write_buffer, (_write_buffer != nullptr) ? _write_capacity : 0 };
+    }
+
     uint64_t offset() const
     {
         assert(IsFileOpened() && "File is not opened!");
@@ -135,6 +246,11 @@ public:
         return _write;
     }
 
+    bool IsFileDirect() const
+    {
+        return _direct;
+    }
+
     void Create(bool read, bool write, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
     {
         // Close previously opened file
@@ -168,9 +284,11 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), O_CREAT | O_EXCL | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))), mode);
+        int access = ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0)));
+        _file = open(path().string().c_str(), O_CREAT | O_EXCL | access, mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
+        _direct = (attributes & FileAttributes::DIRECT) && EnableDirect(access);
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -194,19 +312,8 @@ public:
         if (_file == INVALID_HANDLE_VALUE)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        InitBuffers(read, write, buffer);
     }
 
     void Open(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
@@ -242,9 +349,11 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
+        int access = ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0)));
+        _file = open(path().string().c_str(), access | (truncate ? O_TRUNC : 0), mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
+        _direct = (attributes & FileAttributes::DIRECT) && EnableDirect(access);
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -268,19 +377,8 @@ public:
         if (_file == INVALID_HANDLE_VALUE)
             throwex FileSystemException("Cannot open existing file!").Attach(path());
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        InitBuffers(read, write, buffer);
     }
 
     void OpenOrCreate(bool read, bool write, bool truncate = false, const Flags<FileAttributes>& attributes = File::DEFAULT_ATTRIBUTES, const Flags<FilePermissions>& permissions = File::DEFAULT_PERMISSIONS, size_t buffer = File::DEFAULT_BUFFER)
@@ -316,9 +414,11 @@ public:
         if (permissions & FilePermissions::ISVTX)
             mode |= S_ISVTX;
 
-        _file = open(path().string().c_str(), O_CREAT | ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0))) | (truncate ? O_TRUNC : 0), mode);
+        int access = ((read && write) ? O_RDWR : (read ? O_RDONLY : (write ? O_WRONLY : 0)));
+        _file = open(path().string().c_str(), O_CREAT | access | (truncate ? O_TRUNC : 0), mode);
         if (_file < 0)
             throwex FileSystemException("Cannot create a new file!").Attach(path());
+        _direct = (attributes & FileAttributes::DIRECT) && EnableDirect(access);
 #elif defined(_WIN32) || defined(_WIN64)
         DWORD dwFlagsAndAttributes = 0;
         if (attributes & FileAttributes::NORMAL)
@@ -342,19 +442,8 @@ public:
         if (_file == INVALID_HANDLE_VALUE)
             throwex FileSystemException("Cannot open existing file!").Attach(path());
 #endif
-        // Initialize file read buffer
-        _read = read;
-        _read_index = 0;
-        _read_size = 0;
-        if (read)
-            _read_buffer.resize(buffer);
-
-        // Initialize file write buffer
-        _write = write;
-        _write_index = 0;
-        _write_size = 0;
-        if (write)
-            _write_buffer.resize(buffer);
+        // Initialize file buffers
+        InitBuffers(read, write, buffer);
     }
 
     size_t Read(void* buffer, size_t size)
@@ -367,10 +456,10 @@ public:
             throwex FileSystemException("File is not opened for reading!").Attach(path());
 
         // Read file with zero buffer
-        if (_read_buffer.empty())
+        if (_read_capacity == 0)
         {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-            ssize_t result = read(_file, buffer, size);
+            ssize_t result = SequentialRead(buffer, size);
             if (result < 0)
                 throwex FileSystemException("Cannot read from the file!").Attach(path());
             return (size_t)result;
@@ -382,6 +471,9 @@ public:
 #endif
         }
 
+        // Lazy allocate the local read buffer
+        AcquireReadBuffer();
+
         uint8_t* bytes = (uint8_t*)buffer;
         size_t counter = 0;
 
@@ -392,13 +484,13 @@ public:
             {
                 _read_index = 0;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                ssize_t result = read(_file, _read_buffer.data(), _read_buffer.size());
+                ssize_t result = SequentialRead(_read_buffer, _read_capacity);
                 if (result < 0)
                     throwex FileSystemException("Cannot read from the file!").Attach(path());
                 _read_size = (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
                 DWORD result;
-                if (!ReadFile(_file, _read_buffer.data(), (DWORD)_read_buffer.size(), &result, nullptr))
+                if (!ReadFile(_file, _read_buffer, (DWORD)_read_capacity, &result, nullptr))
                     throwex FileSystemException("Cannot read from the file!").Attach(path());
                 _read_size = (size_t)result;
 #endif
@@ -410,7 +502,7 @@ public:
             // Read remaining data form the local read buffer
             size_t remain = _read_size - _read_index;
             size_t num = (size < remain) ? size : remain;
-            std::memcpy(bytes, _read_buffer.data() + _read_index, num);
+            std::memcpy(bytes, _read_buffer + _read_index, num);
             counter += num;
             _read_index += num;
             bytes += num;
@@ -430,10 +522,10 @@ public:
             throwex FileSystemException("File is not opened for writing!").Attach(path());
 
         // Write file with zero buffer
-        if (_write_buffer.empty())
+        if (_write_capacity == 0)
         {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-            ssize_t result = write(_file, buffer, size);
+            ssize_t result = SequentialWrite(buffer, size);
             if (result < 0)
                 throwex FileSystemException("Cannot write into the file!").Attach(path());
             return (size_t)result;
@@ -445,22 +537,25 @@ public:
 #endif
         }
 
+        // Lazy allocate the local write buffer
+        AcquireWriteBuffer();
+
         const uint8_t* bytes = (const uint8_t*)buffer;
         size_t counter = 0;
 
         while (size > 0)
         {
             // Update the local read buffer from the file
-            if (_write_size == _write_buffer.size())
+            if (_write_size == _write_capacity)
             {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                ssize_t result = write(_file, _write_buffer.data() + _write_index, (_write_size - _write_index));
+                ssize_t result = SequentialWrite(_write_buffer + _write_index, (_write_size - _write_index));
                 if (result < 0)
                     throwex FileSystemException("Cannot write into the file!").Attach(path());
                 _write_index += (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
                 DWORD result;
-                if (!WriteFile(_file, _write_buffer.data() + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
+                if (!WriteFile(_file, _write_buffer + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
                     throwex FileSystemException("Cannot write into the file!").Attach(path());
                 _write_index += (size_t)result;
 #endif
@@ -474,9 +569,9 @@ public:
             }
 
             // Write remaining data into the local write buffer
-            size_t remain = _write_buffer.size() - _write_size;
+            size_t remain = _write_capacity - _write_size;
             size_t num = (size < remain) ? size : remain;
-            std::memcpy(_write_buffer.data() + _write_size, bytes, num);
+            std::memcpy(_write_buffer + _write_size, bytes, num);
             counter += num;
             _write_size += num;
             bytes += num;
@@ -486,6 +581,371 @@ public:
         return counter;
     }
 
+    size_t ReadV(std::span<const IOBuffer> buffers)
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        size_t total = 0;
+        for (const auto& buffer : buffers)
+            total += buffer.size;
+        if (total == 0)
+            return 0;
+
+        // Small requests are served through the local read buffer
+        if ((_read_capacity > 0) && (total < _read_capacity))
+        {
+            size_t counter = 0;
+            for (const auto& buffer : buffers)
+            {
+                size_t result = Read(buffer.data, buffer.size);
+                counter += result;
+                if (result != buffer.size)
+                    break;
+            }
+            return counter;
+        }
+
+        // Consume remaining data from the local read buffer
+        size_t counter = 0;
+        size_t index = 0;
+        size_t skip = 0;
+        while ((_read_index < _read_size) && (index < buffers.size()))
+        {
+            size_t remain = _read_size - _read_index;
+            size_t required = buffers[index].size - skip;
+            size_t num = (required < remain) ? required : remain;
+            std::memcpy((uint8_t*)buffers[index].data + skip, _read_buffer + _read_index, num);
+            _read_index += num;
+            counter += num;
+            skip += num;
+            if (skip == buffers[index].size)
+            {
+                ++index;
+                skip = 0;
+            }
+        }
+
+        // Read other data directly into user buffers
+        while (index < buffers.size())
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            size_t expected = 0;
+            size_t next = index;
+            for (; (next < buffers.size()) && (count < IOV_CHUNK); ++next)
+            {
+                size_t offset = (next == index) ? skip : 0;
+                if (buffers[next].size == offset)
+                    continue;
+                iov[count].iov_base = (uint8_t*)buffers[next].data + offset;
+                iov[count].iov_len = buffers[next].size - offset;
+                expected += iov[count].iov_len;
+                ++count;
+            }
+            if (count == 0)
+                break;
+            ssize_t result = SequentialReadV(iov, count);
+            if (result < 0)
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            counter += (size_t)result;
+            // Stop if the end of file was met
+            if ((size_t)result < expected)
+                break;
+            index = next;
+            skip = 0;
+#elif defined(_WIN32) || defined(_WIN64)
+            DWORD result;
+            DWORD required = (DWORD)(buffers[index].size - skip);
+            if (!ReadFile(_file, (uint8_t*)buffers[index].data + skip, required, &result, nullptr))
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            counter += (size_t)result;
+            // Stop if the end of file was met
+            if (result < required)
+                break;
+            ++index;
+            skip = 0;
+#endif
+        }
+
+        return counter;
+    }
+
+    size_t WriteV(std::span<const ConstIOBuffer> buffers)
+    {
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        size_t total = 0;
+        for (const auto& buffer : buffers)
+            total += buffer.size;
+        if (total == 0)
+            return 0;
+
+        // Small requests are collected in the local write buffer
+        if ((_write_capacity > 0) && (total <= (_write_capacity - _write_size)))
+        {
+            AcquireWriteBuffer();
+            for (const auto& buffer : buffers)
+            {
+                std::memcpy(_write_buffer + _write_size, buffer.data, buffer.size);
+                _write_size += buffer.size;
+            }
+            return total;
+        }
+
+        // Large requests bypass the local write buffer
+        if (_write_buffer != nullptr)
+            FlushBuffer();
+
+        size_t counter = 0;
+        size_t index = 0;
+        size_t skip = 0;
+        while (index < buffers.size())
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            for (size_t next = index; (next < buffers.size()) && (count < IOV_CHUNK); ++next)
+            {
+                size_t offset = (next == index) ? skip : 0;
+                if (buffers[next].size == offset)
+                    continue;
+                iov[count].iov_base = (uint8_t*)buffers[next].data + offset;
+                iov[count].iov_len = buffers[next].size - offset;
+                ++count;
+            }
+            if (count == 0)
+                break;
+            ssize_t result = SequentialWriteV(iov, count);
+            if (result < 0)
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            size_t written = (size_t)result;
+#elif defined(_WIN32) || defined(_WIN64)
+            DWORD result;
+            if (!WriteFile(_file, (const uint8_t*)buffers[index].data + skip, (DWORD)(buffers[index].size - skip), &result, nullptr))
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+            size_t written = (size_t)result;
+#endif
+            if (written == 0)
+                break;
+            counter += written;
+
+            // Advance buffers cursor with the written bytes count (partial write is continued)
+            while ((index < buffers.size()) && (written >= (buffers[index].size - skip)))
+            {
+                written -= (buffers[index].size - skip);
+                ++index;
+                skip = 0;
+            }
+            skip += written;
+        }
+
+        return counter;
+    }
+
+    size_t ReadAt(void* buffer, size_t size, uint64_t offset) const
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        ssize_t result = pread(Handle(IsDirectAligned(buffer, size, offset)), buffer, size, (off_t)offset);
+        if (result < 0)
+            throwex FileSystemException("Cannot read from the file!").Attach(path());
+        return (size_t)result;
+#elif defined(_WIN32) || defined(_WIN64)
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+        overlapped.OffsetHigh = (DWORD)(offset >> 32);
+        DWORD result;
+        if (!ReadFile(_file, buffer, (DWORD)size, &result, &overlapped))
+        {
+            if (GetLastError() == ERROR_HANDLE_EOF)
+                return 0;
+            throwex FileSystemException("Cannot read from the file!").Attach(path());
+        }
+        return (size_t)result;
+#endif
+    }
+
+    size_t ReadAt(std::span<const IOBuffer> buffers, uint64_t offset) const
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        size_t counter = 0;
+#if defined(__linux__) || defined(__FreeBSD__)
+        for (size_t index = 0; index < buffers.size();)
+        {
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            size_t expected = 0;
+            for (; (index < buffers.size()) && (count < IOV_CHUNK); ++index)
+            {
+                iov[count].iov_base = buffers[index].data;
+                iov[count].iov_len = buffers[index].size;
+                expected += buffers[index].size;
+                ++count;
+            }
+            ssize_t result = preadv(Handle(IsDirectAligned(iov, count, offset + counter)), iov, count, (off_t)(offset + counter));
+            if (result < 0)
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            counter += (size_t)result;
+            // Stop if the end of file was met
+            if ((size_t)result < expected)
+                break;
+        }
+#else
+        for (const auto& buffer : buffers)
+        {
+            size_t result = ReadAt(buffer.data, buffer.size, offset + counter);
+            counter += result;
+            // Stop if the end of file was met
+            if (result < buffer.size)
+                break;
+        }
+#endif
+        return counter;
+    }
+
+    size_t WriteAt(const void* buffer, size_t size, uint64_t offset)
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsFileWriteOpened() && "File is not opened for writing!");
+        if (!IsFileWriteOpened())
+            throwex FileSystemException("File is not opened for writing!").Attach(path());
+
+        const uint8_t* bytes = (const uint8_t*)buffer;
+        size_t counter = 0;
+        while (counter < size)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            ssize_t result = pwrite(Handle(IsDirectAligned(bytes + counter, size - counter, offset + counter)), bytes + counter, size - counter, (off_t)(offset + counter));
+            if (result < 0)
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+            OVERLAPPED overlapped = {};
+            overlapped.Offset = (DWORD)((offset + counter) & 0xFFFFFFFF);
+            overlapped.OffsetHigh = (DWORD)((offset + counter) >> 32);
+            DWORD result;
+            if (!WriteFile(_file, bytes + counter, (DWORD)(size - counter), &result, &overlapped))
+                throwex FileSystemException("Cannot write into the file!").Attach(path());
+#endif
+            if (result == 0)
+                break;
+            counter += (size_t)result;
+        }
+        return counter;
+    }
+
+    size_t WriteAt(std::span<const ConstIOBuffer> buffers, uint64_t offset)
+    {
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t result = WriteAt(buffer.data, buffer.size, offset + counter);
+            counter += result;
+            if (result < buffer.size)
+                break;
+        }
+        return counter;
+    }
+
+    uint64_t CopyTo(Impl& destination, uint64_t size)
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+        assert(destination.IsFileWriteOpened() && "Destination file is not opened for writing!");
+        if (!destination.IsFileWriteOpened())
+            throwex FileSystemException("Destination file is not opened for writing!").Attach(destination.path());
+
+        // Flush the destination write buffer to keep the data order
+        destination.FlushBuffer();
+
+        // Kernel transfer works with the page cache, so direct files are copied through their cached descriptors
+        TransferHandle source(*this);
+        TransferHandle target(destination);
+
+        // Copy remaining data from the local read buffer
+        uint64_t counter = ConsumeBuffer(target.handle(), size);
+        if ((size > 0) && (counter == size))
+            return counter;
+
+#if defined(FICLONE)
+        // Clone the whole file into the empty destination file (reflink)
+        if ((counter == 0) && (lseek(source.handle(), 0, SEEK_CUR) == 0) && (destination.size() == 0) && (lseek(target.handle(), 0, SEEK_CUR) == 0))
+        {
+            uint64_t total = this->size();
+            if (((size == 0) || (size >= total)) && (ioctl(target.handle(), FICLONE, source.handle()) == 0))
+            {
+                if ((lseek(source.handle(), (off_t)total, SEEK_SET) == (off_t)-1) || (lseek(target.handle(), (off_t)total, SEEK_SET) == (off_t)-1))
+                    throwex FileSystemException("Cannot seek the file!").Attach(path());
+                return total;
+            }
+        }
+#endif
+
+        // Copy other data with the kernel transfer
+        return counter + TransferData(source.handle(), target.handle(), (size > 0) ? (size - counter) : 0, true);
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    uint64_t Transfer(int handle, uint64_t size)
+#elif defined(_WIN32) || defined(_WIN64)
+    uint64_t Transfer(HANDLE handle, uint64_t size)
+#endif
+    {
+        assert(IsFileReadOpened() && "File is not opened for reading!");
+        if (!IsFileReadOpened())
+            throwex FileSystemException("File is not opened for reading!").Attach(path());
+
+        // Kernel transfer works with the page cache, so the direct file is transferred through its cached descriptor
+        TransferHandle source(*this);
+
+        // Transfer remaining data from the local read buffer
+        uint64_t counter = ConsumeBuffer(handle, size);
+        if ((size > 0) && (counter == size))
+            return counter;
+
+        // Transfer other data with the kernel transfer
+        return counter + TransferData(source.handle(), handle, (size > 0) ? (size - counter) : 0, false);
+    }
+
+    void SetBuffers(std::span<uint8_t> read, std::span<uint8_t> write)
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(path());
+        assert((_read_buffer == nullptr) && (_write_buffer == nullptr) && "File buffers are already in use!");
+        if ((_read_buffer != nullptr) || (_write_buffer != nullptr))
+            throwex FileSystemException("File buffers are already in use!").Attach(path());
+
+        if (IsFileReadOpened())
+        {
+            _read_owned = false;
+            _read_capacity = read.size();
+            _read_buffer = read.empty() ? nullptr : read.data();
+        }
+
+        if (IsFileWriteOpened())
+        {
+            _write_owned = false;
+            _write_capacity = write.size();
+            _write_buffer = write.empty() ? nullptr : write.data();
+        }
+    }
+
     void Seek(uint64_t offset)
     {
         assert(IsFileOpened() && "File is not opened!");
@@ -553,7 +1013,7 @@ public:
         size_t remain = _write_size - _write_index;
         if (remain > 0)
         {
-            ssize_t result = write(_file, _write_buffer.data() + _write_index, (_write_size - _write_index));
+            ssize_t result = SequentialWrite(_write_buffer + _write_index, remain);
             if (result < 0)
                 throwex FileSystemException("Cannot write into the file during the flush operation!").Attach(path());
             _write_index += (size_t)result;
@@ -570,7 +1030,7 @@ public:
         if (remain > 0)
         {
             DWORD result;
-            if (!WriteFile(_file, _write_buffer.data() + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
+            if (!WriteFile(_file, _write_buffer + _write_index, (DWORD)(_write_size - _write_index), &result, nullptr))
                 throwex FileSystemException("Cannot write into the file during the flush operation!").Attach(path());
             _write_index += (size_t)result;
             if (_write_index != _write_size)
@@ -586,13 +1046,122 @@ public:
     void Flush()
     {
         FlushBuffer();
+    }
+
+    void Sync()
+    {
+        FlushBuffer();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = fsync(_file);
         if (result != 0)
-            throwex FileSystemException("Cannot flush the file buffers!").Attach(path());
+            throwex FileSystemException("Cannot synchronize the file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!FlushFileBuffers(_file))
+            throwex FileSystemException("Cannot synchronize the file!").Attach(path());
+#endif
+    }
+
+    void DataSync()
+    {
+        FlushBuffer();
+#if defined(__APPLE__)
+        // fdatasync() is not available on all supported MacOS versions
+        int result = fsync(_file);
+        if (result != 0)
+            throwex FileSystemException("Cannot synchronize the file data!").Attach(path());
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        int result = fdatasync(_file);
+        if (result != 0)
+            throwex FileSystemException("Cannot synchronize the file data!").Attach(path());
 #elif defined(_WIN32) || defined(_WIN64)
         if (!FlushFileBuffers(_file))
-            throwex FileSystemException("Cannot flush the file buffers!").Attach(path());
+            throwex FileSystemException("Cannot synchronize the file data!").Attach(path());
+#endif
+    }
+
+    void SyncRange(uint64_t offset, uint64_t size, bool wait)
+    {
+        FlushBuffer();
+#if defined(__linux__)
+        unsigned int flags = SYNC_FILE_RANGE_WRITE;
+        if (wait)
+            flags |= SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WAIT_AFTER;
+        int result = sync_file_range(_file, (off_t)offset, (off_t)size, flags);
+        if (result != 0)
+            throwex FileSystemException("Cannot synchronize the file range!").Attach(path());
+#else
+        // Range synchronization is not supported, so synchronize the whole file data
+        (void)offset;
+        (void)size;
+        if (wait)
+            DataSync();
+#endif
+    }
+
+    void Advise(FileAdvice advice, uint64_t offset, uint64_t size)
+    {
+        assert(IsFileOpened() && "File is not opened!");
+        if (!IsFileOpened())
+            throwex FileSystemException("File is not opened!").Attach(path());
+#if defined(__APPLE__)
+        // MacOS supports only the read-ahead control and the read advisory
+        int result = 0;
+        switch (advice)
+        {
+            case FileAdvice::NORMAL:
+            case FileAdvice::SEQUENTIAL:
+                result = fcntl(_file, F_RDAHEAD, 1);
+                break;
+            case FileAdvice::RANDOM:
+                result = fcntl(_file, F_RDAHEAD, 0);
+                break;
+            case FileAdvice::WILLNEED:
+            {
+                struct radvisory ra;
+                ra.ra_offset = (off_t)offset;
+                ra.ra_count = (int)(((size == 0) || (size > INT_MAX)) ? INT_MAX : size);
+                result = fcntl(_file, F_RDADVISE, &ra);
+                break;
+            }
+            default:
+                break;
+        }
+        if (result == -1)
+            throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+#elif defined(unix) || defined(__unix) || defined(__unix__)
+        int flag = POSIX_FADV_NORMAL;
+        switch (advice)
+        {
+            case FileAdvice::SEQUENTIAL:
+                flag = POSIX_FADV_SEQUENTIAL;
+                break;
+            case FileAdvice::RANDOM:
+                flag = POSIX_FADV_RANDOM;
+                break;
+            case FileAdvice::WILLNEED:
+                flag = POSIX_FADV_WILLNEED;
+                break;
+            case FileAdvice::DONTNEED:
+                flag = POSIX_FADV_DONTNEED;
+                break;
+            case FileAdvice::NOREUSE:
+                flag = POSIX_FADV_NOREUSE;
+                break;
+            default:
+                break;
+        }
+        // posix_fadvise() returns the error number instead of setting errno
+        int result = posix_fadvise(_file, (off_t)offset, (off_t)size, flag);
+        if (result != 0)
+        {
+            errno = result;
+            throwex FileSystemException("Cannot advise the file access pattern!").Attach(path());
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        // Windows has no equivalent of access pattern advice for opened files
+        (void)advice;
+        (void)offset;
+        (void)size;
 #endif
     }
 
@@ -605,6 +1174,11 @@ public:
         if (IsFileWriteOpened())
             FlushBuffer();
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        if (_cached >= 0)
+        {
+            close(_cached);
+            _cached = -1;
+        }
         int result = close(_file);
         if (result != 0)
             throwex FileSystemException("Cannot close the file descriptor!").Attach(path());
@@ -614,37 +1188,430 @@ public:
             throwex FileSystemException("Cannot close the file handle!").Attach(path());
         _file = INVALID_HANDLE_VALUE;
 #endif
-        // Clear file read buffer
-        _read = false;
-        _read_index = 0;
-        _read_size = 0;
-        _read_buffer.clear();
+        // Clear file buffers
+        ReleaseBuffers();
 
-        // Clear file write buffer
-        _write = false;
-        _write_index = 0;
-        _write_size = 0;
-        _write_buffer.clear();
+        _direct = false;
     }
 
 private:
+    // Count of I/O vectors passed into a single system call
+    static const int IOV_CHUNK = 64;
+
     const Path* _path;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     int _file;
+    // Cached descriptor of the direct file for unaligned operations (Linux only)
+    int _cached;
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _file;
 #endif
+    bool _direct;
+
     // File read buffer
     bool _read;
+    bool _read_owned;
     size_t _read_index;
     size_t _read_size;
-    std::vector<uint8_t> _read_buffer;
+    size_t _read_capacity;
+    uint8_t* _read_buffer;
 
     // File write buffer
     bool _write;
+    bool _write_owned;
     size_t _write_index;
     size_t _write_size;
-    std::vector<uint8_t> _write_buffer;
+    size_t _write_capacity;
+    uint8_t* _write_buffer;
+
+    size_t BufferAlignment() const noexcept
+    {
+        // Direct I/O buffers are aligned to the disk block size
+        return _direct ? File::DIRECT_ALIGNMENT : alignof(std::max_align_t);
+    }
+
+    void InitBuffers(bool read, bool write, size_t buffer)
+    {
+        // Direct I/O buffers are sized to the disk block size
+        if (_direct)
+            buffer = ((buffer + File::DIRECT_ALIGNMENT - 1) / File::DIRECT_ALIGNMENT) * File::DIRECT_ALIGNMENT;
+
+        // Buffers are allocated lazily on the first I/O operation
+        _read = read;
+        _read_owned = true;
+        _read_index = 0;
+        _read_size = 0;
+        _read_capacity = read ? buffer : 0;
+        _read_buffer = nullptr;
+
+        _write = write;
+        _write_owned = true;
+        _write_index = 0;
+        _write_size = 0;
+        _write_capacity = write ? buffer : 0;
+        _write_buffer = nullptr;
+    }
+
+    void AcquireReadBuffer()
+    {
+        if (_read_buffer == nullptr)
+        {
+            _read_buffer = Internals::FileBufferPool::Acquire(_read_capacity, BufferAlignment());
+            if (_read_buffer == nullptr)
+                throwex FileSystemException("Cannot allocate the file read buffer!").Attach(path());
+        }
+    }
+
+    void AcquireWriteBuffer()
+    {
+        if (_write_buffer == nullptr)
+        {
+            _write_buffer = Internals::FileBufferPool::Acquire(_write_capacity, BufferAlignment());
+            if (_write_buffer == nullptr)
+                throwex FileSystemException("Cannot allocate the file write buffer!").Attach(path());
+        }
+    }
+
+    void ReleaseBuffers()
+    {
+        // Return the file read buffer into the pool
+        if ((_read_buffer != nullptr) && _read_owned)
+            Internals::FileBufferPool::Release(_read_buffer, _read_capacity, BufferAlignment());
+        _read = false;
+        _read_owned = false;
+        _read_index = 0;
+        _read_size = 0;
+        _read_capacity = 0;
+        _read_buffer = nullptr;
+
+        // Return the file write buffer into the pool
+        if ((_write_buffer != nullptr) && _write_owned)
+            Internals::FileBufferPool::Release(_write_buffer, _write_capacity, BufferAlignment());
+        _write = false;
+        _write_owned = false;
+        _write_index = 0;
+        _write_size = 0;
+        _write_capacity = 0;
+        _write_buffer = nullptr;
+    }
+
+    // Maximal size of the single kernel transfer operation
+    static const size_t TRANSFER_CHUNK = 0x40000000;
+    // Size of the user space transfer buffer
+    static const size_t TRANSFER_BUFFER = 65536;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    void WriteHandle(int handle, const uint8_t* buffer, size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t result = write(handle, buffer, size);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot transfer the file data!").Attach(path());
+            }
+            buffer += result;
+            size -= (size_t)result;
+        }
+    }
+#elif defined(_WIN32) || defined(_WIN64)
+    void WriteHandle(HANDLE handle, const uint8_t* buffer, size_t size)
+    {
+        while (size > 0)
+        {
+            DWORD result;
+            if (!WriteFile(handle, buffer, (DWORD)size, &result, nullptr))
+                throwex FileSystemException("Cannot transfer the file data!").Attach(path());
+            buffer += result;
+            size -= (size_t)result;
+        }
+    }
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    uint64_t ConsumeBuffer(int handle, uint64_t size)
+#elif defined(_WIN32) || defined(_WIN64)
+    uint64_t ConsumeBuffer(HANDLE handle, uint64_t size)
+#endif
+    {
+        size_t remain = _read_size - _read_index;
+        size_t num = ((size == 0) || (size > remain)) ? remain : (size_t)size;
+        if (num > 0)
+            WriteHandle(handle, _read_buffer + _read_index, num);
+
+        // Reset the read buffer cursor if all buffered data were consumed
+        _read_index += num;
+        if (_read_index == _read_size)
+        {
+            _read_index = 0;
+            _read_size = 0;
+        }
+        return num;
+    }
+
+#if defined(__linux__)
+    static bool IsTransferUnsupported(int error) noexcept
+    {
+        // Errors which mean that the kernel transfer is not possible for the given descriptors
+        return ((error == EXDEV) || (error == EINVAL) || (error == ENOSYS) || (error == EOPNOTSUPP) || (error == EBADF));
+    }
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    uint64_t TransferData(int source, int handle, uint64_t size, bool file)
+#elif defined(_WIN32) || defined(_WIN64)
+    uint64_t TransferData(HANDLE source, HANDLE handle, uint64_t size, bool file)
+#endif
+    {
+        uint64_t counter = 0;
+        std::vector<uint8_t> buffer;
+#if defined(__linux__)
+        bool copy = file;
+        bool send = true;
+#else
+        (void)file;
+#endif
+        // Transfer until the required size is reached or the end of file is met
+        while ((size == 0) || (counter < size))
+        {
+            size_t chunk = ((size == 0) || ((size - counter) > TRANSFER_CHUNK)) ? TRANSFER_CHUNK : (size_t)(size - counter);
+#if defined(__linux__)
+            if (copy)
+            {
+                // In-kernel file to file copy (server side copy, reflink, etc)
+                ssize_t result = copy_file_range(source, nullptr, handle, nullptr, chunk, 0);
+                if (result < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    if (IsTransferUnsupported(errno) && (counter == 0))
+                    {
+                        copy = false;
+                        continue;
+                    }
+                    throwex FileSystemException("Cannot transfer the file data!").Attach(path());
+                }
+                if (result == 0)
+                    break;
+                counter += (size_t)result;
+                continue;
+            }
+            if (send)
+            {
+                // In-kernel file to any descriptor transfer
+                ssize_t result = sendfile(handle, source, nullptr, chunk);
+                if (result < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    if (IsTransferUnsupported(errno) && (counter == 0))
+                    {
+                        send = false;
+                        continue;
+                    }
+                    throwex FileSystemException("Cannot transfer the file data!").Attach(path());
+                }
+                if (result == 0)
+                    break;
+                counter += (size_t)result;
+                continue;
+            }
+#endif
+            // User space transfer through the intermediate buffer
+            if (buffer.empty())
+                buffer.resize(TRANSFER_BUFFER);
+            size_t num = (chunk < buffer.size()) ? chunk : buffer.size();
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            ssize_t result = read(source, buffer.data(), num);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+            }
+#elif defined(_WIN32) || defined(_WIN64)
+            DWORD result;
+            if (!ReadFile(source, buffer.data(), (DWORD)num, &result, nullptr))
+                throwex FileSystemException("Cannot read from the file!").Attach(path());
+#endif
+            if (result == 0)
+                break;
+            WriteHandle(handle, buffer.data(), (size_t)result);
+            counter += (size_t)result;
+        }
+        return counter;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    bool EnableDirect(int access)
+    {
+#if defined(__linux__)
+        // Linux direct I/O requires aligned operations, so unaligned ones (e.g. the
+        // file tail) are performed with the second descriptor of the same file which
+        // uses the page cache. O_DIRECT is never changed after the file is opened,
+        // so concurrent positional operations are safe.
+        _cached = open(path().string().c_str(), access);
+        if (_cached < 0)
+            return false;
+        int flags = fcntl(_file, F_GETFL);
+        // Filesystems without direct I/O support (e.g. old tmpfs) fail with EINVAL
+        if ((flags == -1) || (fcntl(_file, F_SETFL, flags | O_DIRECT) != 0))
+        {
+            close(_cached);
+            _cached = -1;
+            return false;
+        }
+        return true;
+#elif defined(__APPLE__)
+        (void)access;
+        return (fcntl(_file, F_NOCACHE, 1) != -1);
+#else
+        // Direct I/O is not supported by the platform
+        (void)access;
+        return false;
+#endif
+    }
+
+    // Linux direct I/O requires the buffer address, size and file offset to be
+    // aligned to the disk block size. Other platforms have no such requirement.
+    static bool IsAligned(size_t value) noexcept
+    {
+        return ((value & (File::DIRECT_ALIGNMENT - 1)) == 0);
+    }
+
+    bool IsDirectAligned(const void* buffer, size_t size, uint64_t offset) const noexcept
+    {
+        return (_cached < 0) || (IsAligned((size_t)buffer) && IsAligned(size) && IsAligned((size_t)offset));
+    }
+
+    bool IsDirectAligned(const struct iovec* iov, int count, uint64_t offset) const noexcept
+    {
+        if (_cached < 0)
+            return true;
+        for (int i = 0; i < count; ++i)
+            if (!IsDirectAligned(iov[i].iov_base, iov[i].iov_len, offset))
+                return false;
+        return true;
+    }
+
+    // Get the descriptor for the positional operation
+    int Handle(bool aligned) const noexcept
+    {
+        return (aligned || (_cached < 0)) ? _file : _cached;
+    }
+
+    // Unaligned sequential operation of the direct file is performed as the positional
+    // operation of the cached descriptor at the current file offset which is advanced then
+    ssize_t SequentialRead(void* buffer, size_t size)
+    {
+#if defined(__linux__)
+        if (_cached >= 0)
+        {
+            off_t offset = lseek(_file, 0, SEEK_CUR);
+            if (offset == (off_t)-1)
+                return -1;
+            if (!IsDirectAligned(buffer, size, (uint64_t)offset))
+                return Advance(pread(_cached, buffer, size, offset), offset);
+        }
+#endif
+        return read(_file, buffer, size);
+    }
+
+    ssize_t SequentialWrite(const void* buffer, size_t size)
+    {
+#if defined(__linux__)
+        if (_cached >= 0)
+        {
+            off_t offset = lseek(_file, 0, SEEK_CUR);
+            if (offset == (off_t)-1)
+                return -1;
+            if (!IsDirectAligned(buffer, size, (uint64_t)offset))
+                return Advance(pwrite(_cached, buffer, size, offset), offset);
+        }
+#endif
+        return write(_file, buffer, size);
+    }
+
+    ssize_t SequentialReadV(const struct iovec* iov, int count)
+    {
+#if defined(__linux__)
+        if (_cached >= 0)
+        {
+            off_t offset = lseek(_file, 0, SEEK_CUR);
+            if (offset == (off_t)-1)
+                return -1;
+            if (!IsDirectAligned(iov, count, (uint64_t)offset))
+                return Advance(preadv(_cached, iov, count, offset), offset);
+        }
+#endif
+        return readv(_file, iov, count);
+    }
+
+    ssize_t SequentialWriteV(const struct iovec* iov, int count)
+    {
+#if defined(__linux__)
+        if (_cached >= 0)
+        {
+            off_t offset = lseek(_file, 0, SEEK_CUR);
+            if (offset == (off_t)-1)
+                return -1;
+            if (!IsDirectAligned(iov, count, (uint64_t)offset))
+                return Advance(pwritev(_cached, iov, count, offset), offset);
+        }
+#endif
+        return writev(_file, iov, count);
+    }
+
+    ssize_t Advance(ssize_t result, off_t offset)
+    {
+        if ((result > 0) && (lseek(_file, offset + result, SEEK_SET) == (off_t)-1))
+            return -1;
+        return result;
+    }
+#endif
+
+    // Kernel transfer works with the page cache, so the direct file is transferred
+    // through its cached descriptor. File offsets of both descriptors are synchronized
+    // before and after the transfer.
+    class TransferHandle
+    {
+    public:
+        explicit TransferHandle(Impl& impl) : _impl(impl)
+        {
+#if defined(__linux__)
+            if (_impl._cached >= 0)
+            {
+                off_t offset = lseek(_impl._file, 0, SEEK_CUR);
+                if ((offset == (off_t)-1) || (lseek(_impl._cached, offset, SEEK_SET) == (off_t)-1))
+                    throwex FileSystemException("Cannot seek the file!").Attach(_impl.path());
+            }
+#endif
+        }
+        TransferHandle(const TransferHandle&) = delete;
+        TransferHandle& operator=(const TransferHandle&) = delete;
+        ~TransferHandle()
+        {
+#if defined(__linux__)
+            if (_impl._cached >= 0)
+            {
+                off_t offset = lseek(_impl._cached, 0, SEEK_CUR);
+                if (offset != (off_t)-1)
+                    lseek(_impl._file, offset, SEEK_SET);
+            }
+#endif
+        }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int handle() const noexcept { return (_impl._cached >= 0) ? _impl._cached : _impl._file; }
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE handle() const noexcept { return _impl._file; }
+#endif
+
+    private:
+        Impl& _impl;
+    };
 };
 
 //! @endcond
@@ -652,6 +1619,7 @@ private:
 const Flags<FileAttributes> File::DEFAULT_ATTRIBUTES = FileAttributes::NORMAL;
 const Flags<FilePermissions> File::DEFAULT_PERMISSIONS = FilePermissions::IRUSR | FilePermissions::IWUSR | FilePermissions::IRGRP | FilePermissions::IROTH;
 const size_t File::DEFAULT_BUFFER = 8192;
+const size_t File::DIRECT_ALIGNMENT = 4096;
 
 File::File() : Path()
 {
@@ -675,6 +1643,17 @@ File::File(const Path& path) : Path(path)
     new(&_storage)Impl(this);
 }
 
+File::File(Path&& path) : Path(std::move(path))
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "File::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "File::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
 File::File(const File& file) : Path(file)
 {
     // Check implementation storage parameters
@@ -709,6 +1688,11 @@ File& File::operator=(File&& file) noexcept
     return *this;
 }
 
+void* File::native() const noexcept { return impl().native(); }
+
+std::span<const uint8_t> File::read_buffer() const noexcept { return impl().read_buffer(); }
+std::span<const uint8_t> File::write_buffer() const noexcept { return impl().write_buffer(); }
+
 uint64_t File::offset() const { return impl().offset(); }
 uint64_t File::size() const { return impl().size(); }
 
@@ -751,6 +1735,7 @@ bool File::IsFileExists() const
 bool File::IsFileOpened() const { return impl().IsFileOpened(); }
 bool File::IsFileReadOpened() const { return impl().IsFileReadOpened(); }
 bool File::IsFileWriteOpened() const { return impl().IsFileWriteOpened(); }
+bool File::IsFileDirect() const { return impl().IsFileDirect(); }
 
 void File::Create(bool read, bool write, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { return impl().Create(read, write, attributes, permissions, buffer); }
 void File::Open(bool read, bool write, bool truncate, const Flags<FileAttributes>& attributes, const Flags<FilePermissions>& permissions, size_t buffer) { impl().Open(read, write, truncate, attributes, permissions, buffer); }
@@ -758,10 +1743,34 @@ void File::OpenOrCreate(bool read, bool write, bool truncate, const Flags<FileAt
 
 size_t File::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
 size_t File::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t File::ReadV(std::span<const IOBuffer> buffers) { return impl().ReadV(buffers); }
+size_t File::WriteV(std::span<const ConstIOBuffer> buffers) { return impl().WriteV(buffers); }
+
+size_t File::ReadAt(void* buffer, size_t size, uint64_t offset) const { return impl().ReadAt(buffer, size, offset); }
+size_t File::ReadAt(std::span<const IOBuffer> buffers, uint64_t offset) const { return impl().ReadAt(buffers, offset); }
+size_t File::WriteAt(const void* buffer, size_t size, uint64_t offset) { return impl().WriteAt(buffer, size, offset); }
+size_t File::WriteAt(std::span<const ConstIOBuffer> buffers, uint64_t offset) { return impl().WriteAt(buffers, offset); }
+
+uint64_t File::CopyTo(File& file, uint64_t size) { return impl().CopyTo(file.impl(), size); }
+
+uint64_t File::Transfer(void* handle, uint64_t size)
+{
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    return impl().Transfer((int)(size_t)handle, size);
+#elif defined(_WIN32) || defined(_WIN64)
+    return impl().Transfer((HANDLE)handle, size);
+#endif
+}
+
+void File::SetBuffers(std::span<uint8_t> read, std::span<uint8_t> write) { impl().SetBuffers(read, write); }
 
 void File::Seek(uint64_t offset) { return impl().Seek(offset); }
 void File::Resize(uint64_t size) { return impl().Resize(size); }
 void File::Flush() { impl().Flush(); }
+void File::Sync() { impl().Sync(); }
+void File::DataSync() { impl().DataSync(); }
+void File::SyncRange(uint64_t offset, uint64_t size, bool wait) { impl().SyncRange(offset, size, wait); }
+void File::Advise(FileAdvice advice, uint64_t offset, uint64_t size) { impl().Advise(advice, offset, size); }
 void File::Close() { impl().Close(); }
 
 std::vector<uint8_t> File::ReadAllBytes(const Path& path)
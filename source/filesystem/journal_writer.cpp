@@ -0,0 +1,151 @@
+/*!
+    \file journal_writer.cpp
+    \brief Group commit journal writer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/journal_writer.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+
+namespace CppCommon {
+
+JournalWriter::JournalWriter(const Path& path, bool data)
+    : _file(path), _data(data), _error(), _committing(false), _size(0), _appended(0), _durable(0), _commits(0)
+{
+    // Batches are written with a single system call, so the file buffer is not required
+    _file.OpenOrCreate(false, true, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    _size = _file.size();
+    _file.Seek(_size);
+}
+
+JournalWriter::~JournalWriter()
+{
+    try
+    {
+        if (_file.IsFileOpened())
+            Close();
+    }
+    catch (const FileSystemException& ex)
+    {
+        fatality(FileSystemException(ex.string()).Attach(_file));
+    }
+}
+
+uint64_t JournalWriter::size() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _size;
+}
+
+uint64_t JournalWriter::records() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _durable;
+}
+
+uint64_t JournalWriter::commits() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _commits;
+}
+
+uint64_t JournalWriter::Append(const void* buffer, size_t size)
+{
+    Locker<CriticalSection> locker(_cs);
+
+    // Journal is broken by the previous commit failure
+    if (_error)
+        std::rethrow_exception(_error);
+    if (!_file.IsFileOpened())
+        throwex FileSystemException("Journal is closed!").Attach(_file);
+
+    // Append the record into the current batch
+    uint64_t offset = _size;
+    const uint8_t* bytes = (const uint8_t*)buffer;
+    _batch.insert(_batch.end(), bytes, bytes + size);
+    _size += size;
+    uint64_t sequence = ++_appended;
+
+    while (_durable < sequence)
+    {
+        if (_error)
+            std::rethrow_exception(_error);
+
+        if (_committing)
+        {
+            // Wait for the current leader to commit the batch
+            _cv.Wait(_cs);
+            continue;
+        }
+
+        // Become a leader and commit all accumulated records
+        _committing = true;
+        _commit.swap(_batch);
+        uint64_t commit = _appended;
+
+        _cs.Unlock();
+        std::exception_ptr error;
+        try
+        {
+            // Unbuffered file write may be partial
+            size_t written = 0;
+            while (written < _commit.size())
+            {
+                size_t result = _file.Write(_commit.data() + written, _commit.size() - written);
+                if (result == 0)
+                    throwex FileSystemException("Cannot write the journal batch!").Attach(_file);
+                written += result;
+            }
+            if (_data)
+                _file.DataSync();
+            else
+                _file.Sync();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+        _commit.clear();
+        _cs.Lock();
+
+        _committing = false;
+        if (!error)
+        {
+            _durable = commit;
+            ++_commits;
+        }
+        else
+            _error = error;
+
+        // Wake up all followers of the committed batch and the next leader
+        _cv.NotifyAll();
+    }
+
+    return offset;
+}
+
+size_t JournalWriter::Write(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    Append(buffer, size);
+    return size;
+}
+
+void JournalWriter::Close()
+{
+    Locker<CriticalSection> locker(_cs);
+
+    // Wait for all pending records to be committed
+    _cv.Wait(_cs, [this]() { return (!_committing && (_error || (_durable == _appended))); });
+
+    if (_file.IsFileOpened())
+        _file.Close();
+}
+
+} // namespace CppCommon
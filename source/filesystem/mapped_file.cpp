@@ -0,0 +1,584 @@
+/*!
+    \file mapped_file.cpp
+    \brief Filesystem memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "filesystem/mapped_file.h"
+
+#include "errors/fatal.h"
+#include "filesystem/exceptions.h"
+#include "utility/validate_aligned_storage.h"
+
+#include <cassert>
+#include <cstring>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+class MappedFile::Impl
+{
+    friend class MappedFile;
+
+public:
+    explicit Impl(const Path* path) : _path(path), _write(false), _whole(false), _huge(false), _base(nullptr), _length(0), _data(nullptr), _size(0), _offset(0), _position(0)
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _file = -1;
+#elif defined(_WIN32) || defined(_WIN64)
+        _file = INVALID_HANDLE_VALUE;
+        _mapping = nullptr;
+#endif
+    }
+
+    ~Impl()
+    {
+        try
+        {
+            if (IsMapped())
+                Unmap();
+        }
+        catch (const FileSystemException& ex)
+        {
+            fatality(FileSystemException(ex.string()).Attach(path()));
+        }
+    }
+
+    const Path& path() const { return *_path; }
+
+    uint8_t* data() noexcept { return _data; }
+    const uint8_t* data() const noexcept { return _data; }
+    size_t size() const noexcept { return _size; }
+    uint64_t offset() const noexcept { return _offset; }
+    size_t position() const noexcept { return _position; }
+
+    bool IsMapped() const noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return (_file >= 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        return (_file != INVALID_HANDLE_VALUE);
+#endif
+    }
+
+    bool IsWritable() const noexcept { return IsMapped() && _write; }
+
+    void Map(bool write, uint64_t offset, size_t size, bool huge)
+    {
+        // Unmap previously mapped file
+        assert(!IsMapped() && "File is already mapped!");
+        if (IsMapped())
+            Unmap();
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _file = open(path().string().c_str(), (write ? O_RDWR : O_RDONLY));
+        if (_file < 0)
+            throwex FileSystemException("Cannot open the file for mapping!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        _file = CreateFileW(path().wstring().c_str(), GENERIC_READ | (write ? GENERIC_WRITE : 0), FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE)
+            throwex FileSystemException("Cannot open the file for mapping!").Attach(path());
+#endif
+        _write = write;
+        _whole = (size == 0);
+        _huge = huge;
+        _offset = offset;
+        _position = 0;
+
+        // Validate the mapped window bounds
+        uint64_t total = FileSize();
+        if ((offset > total) || (!_whole && ((offset + size) > total)))
+        {
+            CloseFile();
+            throwex FileSystemException("Mapped window is out of the file bounds!").Attach(path());
+        }
+
+        try
+        {
+            MapView(_whole ? (size_t)(total - offset) : size);
+        }
+        catch (...)
+        {
+            CloseFile();
+            throw;
+        }
+    }
+
+    void Unmap()
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        UnmapView();
+        CloseFile();
+
+        _write = false;
+        _whole = false;
+        _huge = false;
+        _offset = 0;
+        _position = 0;
+    }
+
+    void Advise(MappedFileAdvice advice, size_t offset, size_t size)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        uint8_t* start;
+        size_t length;
+        if (!Range(offset, size, start, length))
+            return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flag = MADV_NORMAL;
+        switch (advice)
+        {
+            case MappedFileAdvice::SEQUENTIAL:
+                flag = MADV_SEQUENTIAL;
+                break;
+            case MappedFileAdvice::RANDOM:
+                flag = MADV_RANDOM;
+                break;
+            case MappedFileAdvice::WILLNEED:
+                flag = MADV_WILLNEED;
+                break;
+            case MappedFileAdvice::DONTNEED:
+                flag = MADV_DONTNEED;
+                break;
+            default:
+                break;
+        }
+        int result = madvise(start, length, flag);
+        if (result != 0)
+            throwex FileSystemException("Cannot advise the mapped file access pattern!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        // Windows has no direct equivalent of access pattern advice for mapped views
+        (void)advice;
+#endif
+    }
+
+    void Resize(uint64_t size)
+    {
+        if (!IsMapped())
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            int result = truncate(path().string().c_str(), (off_t)size);
+            if (result != 0)
+                throwex FileSystemException("Cannot resize the mapped file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+            Map(true, 0, 0, false);
+            Resize(size);
+            Unmap();
+#endif
+            return;
+        }
+
+        assert(IsWritable() && "File is not mapped for writing!");
+        if (!IsWritable())
+            throwex FileSystemException("File is not mapped for writing!").Attach(path());
+
+        // Calculate the new window size
+        size_t available = (size > _offset) ? (size_t)(size - _offset) : 0;
+        size_t window = _whole ? available : ((_size < available) ? _size : available);
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = ftruncate(_file, (off_t)size);
+        if (result != 0)
+            throwex FileSystemException("Cannot resize the mapped file!").Attach(path());
+#if defined(__linux__)
+        // Remap the window in place if it is possible
+        if (!_huge && (_base != nullptr) && (window > 0))
+        {
+            size_t length = (size_t)(_data - _base) + window;
+            void* base = mremap(_base, _length, length, MREMAP_MAYMOVE);
+            if (base == MAP_FAILED)
+                throwex FileSystemException("Cannot remap the file window!").Attach(path());
+            _data = (uint8_t*)base + (_data - _base);
+            _base = (uint8_t*)base;
+            _length = length;
+            _size = window;
+            if (_position > _size)
+                _position = _size;
+            return;
+        }
+#endif
+        UnmapView();
+#elif defined(_WIN32) || defined(_WIN64)
+        // File mapping must be closed before the file size is changed
+        UnmapView();
+        LARGE_INTEGER seek;
+        seek.QuadPart = (LONGLONG)size;
+        if (!SetFilePointerEx(_file, seek, nullptr, FILE_BEGIN) || !SetEndOfFile(_file))
+            throwex FileSystemException("Cannot resize the mapped file!").Attach(path());
+#endif
+        MapView(window);
+    }
+
+    void Sync(size_t offset, size_t size, bool async)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        uint8_t* start;
+        size_t length;
+        if (!Range(offset, size, start, length))
+            return;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = msync(start, length, (async ? MS_ASYNC : MS_SYNC));
+        if (result != 0)
+            throwex FileSystemException("Cannot synchronize the mapped file!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        if (!FlushViewOfFile(start, length))
+            throwex FileSystemException("Cannot synchronize the mapped file!").Attach(path());
+        if (!async && _write && !FlushFileBuffers(_file))
+            throwex FileSystemException("Cannot flush the mapped file buffers!").Attach(path());
+#endif
+    }
+
+    size_t Read(void* buffer, size_t size)
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+
+        size_t remain = _size - _position;
+        size_t num = (size < remain) ? size : remain;
+        if (num > 0)
+        {
+            std::memcpy(buffer, _data + _position, num);
+            _position += num;
+        }
+        return num;
+    }
+
+    size_t Write(const void* buffer, size_t size)
+    {
+        if ((buffer == nullptr) || (size == 0))
+            return 0;
+
+        assert(IsWritable() && "File is not mapped for writing!");
+        if (!IsWritable())
+            throwex FileSystemException("File is not mapped for writing!").Attach(path());
+
+        size_t remain = _size - _position;
+        size_t num = (size < remain) ? size : remain;
+        if (num > 0)
+        {
+            std::memcpy(_data + _position, buffer, num);
+            _position += num;
+        }
+        return num;
+    }
+
+    void Seek(size_t position)
+    {
+        assert(IsMapped() && "File is not mapped!");
+        if (!IsMapped())
+            throwex FileSystemException("File is not mapped!").Attach(path());
+        if (position > _size)
+            throwex FileSystemException("Seek position is out of the mapped window!").Attach(path());
+
+        _position = position;
+    }
+
+    void Flush()
+    {
+        if (IsWritable())
+            Sync(0, 0, true);
+    }
+
+private:
+    const Path* _path;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    int _file;
+#elif defined(_WIN32) || defined(_WIN64)
+    HANDLE _file;
+    HANDLE _mapping;
+#endif
+    bool _write;
+    bool _whole;
+    bool _huge;
+    // Mapped region (aligned to the page or the allocation granularity)
+    uint8_t* _base;
+    size_t _length;
+    // Mapped window
+    uint8_t* _data;
+    size_t _size;
+    uint64_t _offset;
+    size_t _position;
+
+    static size_t Granularity()
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        static size_t granularity = (size_t)sysconf(_SC_PAGESIZE);
+#elif defined(_WIN32) || defined(_WIN64)
+        static size_t granularity = []()
+        {
+            SYSTEM_INFO si;
+            GetSystemInfo(&si);
+            return (size_t)si.dwAllocationGranularity;
+        }();
+#endif
+        return granularity;
+    }
+
+    uint64_t FileSize() const
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        struct stat status;
+        int result = fstat(_file, &status);
+        if (result != 0)
+            throwex FileSystemException("Cannot get the mapped file size!").Attach(path());
+        return (uint64_t)status.st_size;
+#elif defined(_WIN32) || defined(_WIN64)
+        LARGE_INTEGER result;
+        if (!GetFileSizeEx(_file, &result))
+            throwex FileSystemException("Cannot get the mapped file size!").Attach(path());
+        return (uint64_t)result.QuadPart;
+#endif
+    }
+
+    // Get the page aligned region for the given mapped window range
+    bool Range(size_t offset, size_t size, uint8_t*& start, size_t& length) const
+    {
+        if ((_data == nullptr) || (offset >= _size))
+            return false;
+
+        size_t count = ((size == 0) || (size > (_size - offset))) ? (_size - offset) : size;
+        uintptr_t page = (uintptr_t)Granularity();
+        uintptr_t first = ((uintptr_t)(_data + offset)) & ~(page - 1);
+        uintptr_t last = (uintptr_t)(_data + offset + count);
+        start = (uint8_t*)first;
+        length = (size_t)(last - first);
+        return true;
+    }
+
+    void MapView(size_t size)
+    {
+        _base = nullptr;
+        _length = 0;
+        _data = nullptr;
+        _size = 0;
+        if (_position > size)
+            _position = size;
+
+        // Empty window could not be mapped
+        if (size == 0)
+            return;
+
+        uint64_t aligned = _offset & ~((uint64_t)Granularity() - 1);
+        size_t delta = (size_t)(_offset - aligned);
+        size_t length = delta + size;
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int protection = PROT_READ | (_write ? PROT_WRITE : 0);
+        void* base = MAP_FAILED;
+        if (_huge)
+        {
+            // Reserve address space to place the mapping at the address congruent
+            // to the file offset modulo the huge page size. It is required to
+            // allow the kernel to back the mapping with transparent huge pages.
+            size_t reserved = length + 2 * HUGE_PAGE_SIZE;
+            void* reservation = mmap(nullptr, reserved, PROT_NONE, (MAP_PRIVATE | MAP_ANONYMOUS), -1, 0);
+            if (reservation == MAP_FAILED)
+                throwex FileSystemException("Cannot reserve the address space for the file mapping!").Attach(path());
+
+            uintptr_t first = (uintptr_t)reservation;
+            uintptr_t address = ((first + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1)) + (uintptr_t)(aligned % HUGE_PAGE_SIZE);
+            base = mmap((void*)address, length, protection, (MAP_SHARED | MAP_FIXED), _file, (off_t)aligned);
+            if (base == MAP_FAILED)
+            {
+                munmap(reservation, reserved);
+                throwex FileSystemException("Cannot map the file window!").Attach(path());
+            }
+
+            // Release unused parts of the reservation
+            uintptr_t page = (uintptr_t)Granularity();
+            uintptr_t tail = (address + length + page - 1) & ~(page - 1);
+            if (address > first)
+                munmap((void*)first, (size_t)(address - first));
+            if ((first + reserved) > tail)
+                munmap((void*)tail, (size_t)((first + reserved) - tail));
+
+#if defined(MADV_HUGEPAGE)
+            // Huge pages advice is optional and may be rejected by the kernel
+            madvise(base, length, MADV_HUGEPAGE);
+#endif
+        }
+        else
+        {
+            base = mmap(nullptr, length, protection, MAP_SHARED, _file, (off_t)aligned);
+            if (base == MAP_FAILED)
+                throwex FileSystemException("Cannot map the file window!").Attach(path());
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        _mapping = CreateFileMappingW(_file, nullptr, (_write ? PAGE_READWRITE : PAGE_READONLY), 0, 0, nullptr);
+        if (_mapping == nullptr)
+            throwex FileSystemException("Cannot create the file mapping!").Attach(path());
+
+        void* base = MapViewOfFile(_mapping, (_write ? FILE_MAP_WRITE : FILE_MAP_READ), (DWORD)(aligned >> 32), (DWORD)(aligned & 0xFFFFFFFF), length);
+        if (base == nullptr)
+        {
+            CloseHandle(_mapping);
+            _mapping = nullptr;
+            throwex FileSystemException("Cannot map the file window!").Attach(path());
+        }
+#endif
+        _base = (uint8_t*)base;
+        _length = length;
+        _data = _base + delta;
+        _size = size;
+    }
+
+    void UnmapView()
+    {
+        if (_base != nullptr)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            int result = munmap(_base, _length);
+            if (result != 0)
+                throwex FileSystemException("Cannot unmap the file window!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+            if (!UnmapViewOfFile(_base))
+                throwex FileSystemException("Cannot unmap the file window!").Attach(path());
+#endif
+        }
+#if defined(_WIN32) || defined(_WIN64)
+        if (_mapping != nullptr)
+        {
+            if (!CloseHandle(_mapping))
+                throwex FileSystemException("Cannot close the file mapping!").Attach(path());
+            _mapping = nullptr;
+        }
+#endif
+        _base = nullptr;
+        _length = 0;
+        _data = nullptr;
+        _size = 0;
+    }
+
+    void CloseFile()
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int result = close(_file);
+        _file = -1;
+        if (result != 0)
+            throwex FileSystemException("Cannot close the file descriptor!").Attach(path());
+#elif defined(_WIN32) || defined(_WIN64)
+        BOOL result = CloseHandle(_file);
+        _file = INVALID_HANDLE_VALUE;
+        if (!result)
+            throwex FileSystemException("Cannot close the file handle!").Attach(path());
+#endif
+    }
+};
+
+//! @endcond
+
+const size_t MappedFile::HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+MappedFile::MappedFile() : Path()
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "MappedFile::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "MappedFile::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
+MappedFile::MappedFile(const Path& path) : Path(path)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "MappedFile::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "MappedFile::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
+MappedFile::MappedFile(const MappedFile& file) : Path(file)
+{
+    // Check implementation storage parameters
+    [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
+    static_assert((StorageSize >= sizeof(Impl)), "MappedFile::StorageSize must be increased!");
+    static_assert(((StorageAlign % alignof(Impl)) == 0), "MappedFile::StorageAlign must be adjusted!");
+
+    // Create the implementation instance
+    new(&_storage)Impl(this);
+}
+
+MappedFile::MappedFile(MappedFile&& file) noexcept : MappedFile()
+{
+    file.swap(*this);
+}
+
+MappedFile::~MappedFile()
+{
+    // Delete the implementation instance
+    reinterpret_cast<Impl*>(&_storage)->~Impl();
+}
+
+MappedFile& MappedFile::operator=(const MappedFile& file)
+{
+    MappedFile(file).swap(*this);
+    return *this;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& file) noexcept
+{
+    MappedFile(std::move(file)).swap(*this);
+    return *this;
+}
+
+uint8_t* MappedFile::data() noexcept { return impl().data(); }
+const uint8_t* MappedFile::data() const noexcept { return impl().data(); }
+size_t MappedFile::size() const noexcept { return impl().size(); }
+uint64_t MappedFile::offset() const noexcept { return impl().offset(); }
+size_t MappedFile::position() const noexcept { return impl().position(); }
+
+bool MappedFile::IsMapped() const noexcept { return impl().IsMapped(); }
+bool MappedFile::IsWritable() const noexcept { return impl().IsWritable(); }
+
+void MappedFile::Map(bool write, uint64_t offset, size_t size, bool huge) { impl().Map(write, offset, size, huge); }
+void MappedFile::Unmap() { impl().Unmap(); }
+void MappedFile::Advise(MappedFileAdvice advice, size_t offset, size_t size) { impl().Advise(advice, offset, size); }
+void MappedFile::Resize(uint64_t size) { impl().Resize(size); }
+void MappedFile::Sync(size_t offset, size_t size, bool async) { impl().Sync(offset, size, async); }
+
+size_t MappedFile::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
+size_t MappedFile::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+
+void MappedFile::Seek(size_t position) { impl().Seek(position); }
+void MappedFile::Flush() { impl().Flush(); }
+
+void MappedFile::swap(MappedFile& file) noexcept
+{
+    using std::swap;
+    Path::swap(file);
+    swap(_storage, file._storage);
+    swap(impl()._path, file.impl()._path);
+}
+
+} // namespace CppCommon
@@ -9,13 +9,13 @@
 #include "filesystem/path.h"
 
 #include "filesystem/directory.h"
+#include "filesystem/file.h"
 #include "filesystem/symlink.h"
 #include "system/uuid.h"
 #include "utility/countof.h"
 #include "utility/resource.h"
 
 #include <algorithm>
-#include <regex>
 #include <stack>
 #include <tuple>
 #include <vector>
@@ -23,8 +23,6 @@
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #if defined(__APPLE__)
 #include <libproc.h>
-#elif defined(linux) || defined(__linux) || defined(__linux__)
-#include <sys/sendfile.h>
 #endif
 #include <sys/statvfs.h>
 #include <sys/stat.h>
@@ -1037,76 +1035,19 @@ Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Open the source file for reading
-        int source = open(src.string().c_str(), O_RDONLY, 0);
-        if (source < 0)
-            throwex FileSystemException("Cannot open source file for copy!").Attach(src);
-
-        // Get the source file status
-        struct stat status;
-        int result = fstat(source, &status);
-        if (result != 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot get the source file status for copy!").Attach(src);
-        }
+        File source(src);
+        source.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
 
         // Open the destination file for writing
-        int destination = open(dst.string().c_str(), O_CREAT | O_WRONLY | O_TRUNC, status.st_mode);
-        if (destination < 0)
-        {
-            close(source);
-            throwex FileSystemException("Cannot open destination file for copy!").Attach(dst);
-        }
-
-#if defined(linux) || defined(__linux) || defined(__linux__)
-        // Transfer data between source and destination file descriptors
-        off_t offset = 0;
-        size_t cur = 0;
-        size_t tot = status.st_size;
-        while (cur < tot)
-        {
-            ssize_t sent;
-            if ((sent = sendfile(destination, source, &offset, tot - cur)) <= 0)
-            {
-                if ((errno == EINTR) || (errno == EAGAIN))
-                {
-                    // Interrupted system call/try again
-                    // Just skip to the top of the loop and try again
-                    continue;
-                }
+        File destination(dst);
+        destination.OpenOrCreate(false, true, true, File::DEFAULT_ATTRIBUTES, src.permissions(), 0);
 
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot send the source file to the destination file!").Attach(src, dst);
-            }
-            cur += sent;
-        }
-#else
-        char buffer[BUFSIZ];
-        int size;
-
-        do
-        {
-            size = read(source, buffer, countof(buffer));
-            if (size < 0)
-            {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot read from the file!").Attach(src);
-            }
-            size = write(destination, buffer, size);
-            if (size < 0)
-            {
-                close(source);
-                close(destination);
-                throwex FileSystemException("Cannot write into the file!").Attach(dst);
-            }
-        } while (size > 0);
-#endif
+        // Copy the whole file with the kernel zero-copy transfer
+        source.CopyTo(destination);
 
         // Close files
-        close(source);
-        close(destination);
+        destination.Close();
+        source.Close();
 #elif defined(_WIN32) || defined(_WIN64)
         if (!CopyFileW(src.wstring().c_str(), dst.wstring().c_str(), FALSE))
             throwex FileSystemException("Cannot copy the file!").Attach(src, dst);
@@ -1117,7 +1058,7 @@ Path Path::Copy(const Path& src, const Path& dst, bool overwrite)
 
 Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern, bool overwrite)
 {
-    std::regex matcher(pattern);
+    PatternSet matcher = PatternSet::FromRegex(pattern);
 
     // Check if the destination path exists
     bool exists = dst.IsExists();
@@ -1127,7 +1068,7 @@ Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern,
     // Copy symbolic link or regular file
     if (src.IsSymlink() || !src.IsDirectory())
     {
-        if (pattern.empty() || std::regex_match(src.filename().string(), matcher))
+        if (matcher.empty() || matcher.Match(src.filename().string()))
             return Copy(src, dst, overwrite);
         else
             return Path();
@@ -1141,7 +1082,7 @@ Path Path::CopyIf(const Path& src, const Path& dst, const std::string& pattern,
     Directory directory(src);
     for (auto it = directory.begin(); it != directory.end(); ++it)
     {
-        if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+        if (matcher.empty() || matcher.Match(it->filename().string()))
         {
             // Copy symbolic link or regular file
             if (it->IsSymlink() || !it->IsDirectory())
@@ -1247,7 +1188,7 @@ Path Path::Remove(const Path& path)
 
 Path Path::RemoveIf(const Path& path, const std::string& pattern)
 {
-    std::regex matcher(pattern);
+    PatternSet matcher = PatternSet::FromRegex(pattern);
 
     bool is_directory = false;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -1267,13 +1208,13 @@ Path Path::RemoveIf(const Path& path, const std::string& pattern)
         // Remove all directory entries
         Directory directory(path);
         for (auto it = directory.begin(); it != directory.end(); ++it)
-            if (pattern.empty() || std::regex_match(it->filename().string(), matcher))
+            if (matcher.empty() || matcher.Match(it->filename().string()))
                 Remove(*it);
         return path;
     }
 
     // Remove the path
-    if (pattern.empty() || std::regex_match(path.filename().string(), matcher))
+    if (matcher.empty() || matcher.Match(path.filename().string()))
         return Remove(path);
     else
         return Path();
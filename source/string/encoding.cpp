@@ -8,151 +8,680 @@
 
 #include "string/encoding.h"
 
+#include "errors/exceptions.h"
+#include "system/cpu.h"
+
 #include <algorithm>
 #include <cassert>
-#include <codecvt>
-#include <locale>
+#include <cstring>
 #include <vector>
 
+#if defined(__i386__) || defined(__x86_64__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+#define CPPCOMMON_ENCODING_X86
+#include <immintrin.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_ENCODING_SSE2
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#define CPPCOMMON_ENCODING_TARGET(isa)
+#else
+#define CPPCOMMON_ENCODING_TARGET(isa) __attribute__((target(isa)))
+#endif
+
 namespace CppCommon {
 
-std::string Encoding::ToUTF8(std::wstring_view wstr)
+//! @cond INTERNALS
+namespace Internals {
+
+// UTF-8 validation is based on the lookup algorithm by John Keiser and Daniel Lemire
+// https://arxiv.org/abs/2010.03090
+
+bool UTF8ValidateScalar(const uint8_t* src, size_t size)
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes((char16_t*)wstr.data(), (char16_t*)wstr.data() + wstr.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.to_bytes(wstr.data(), wstr.data() + wstr.size());
-#endif
+    size_t i = 0;
+    while (i < size)
+    {
+        // Skip ASCII words
+        if ((i + 8) <= size)
+        {
+            uint64_t word;
+            std::memcpy(&word, src + i, sizeof(word));
+            if ((word & 0x8080808080808080ull) == 0)
+            {
+                i += 8;
+                continue;
+            }
+        }
+
+        uint8_t lead = src[i];
+        if (lead < 0x80)
+        {
+            i += 1;
+            continue;
+        }
+        else if (lead < 0xC2)
+            return false;
+        else if (lead < 0xE0)
+        {
+            if (((i + 1) >= size) || ((src[i + 1] & 0xC0) != 0x80))
+                return false;
+            i += 2;
+        }
+        else if (lead < 0xF0)
+        {
+            if (((i + 2) >= size) || ((src[i + 1] & 0xC0) != 0x80) || ((src[i + 2] & 0xC0) != 0x80))
+                return false;
+            // Overlong encoding or surrogate
+            if (((lead == 0xE0) && (src[i + 1] < 0xA0)) || ((lead == 0xED) && (src[i + 1] > 0x9F)))
+                return false;
+            i += 3;
+        }
+        else if (lead < 0xF5)
+        {
+            if (((i + 3) >= size) || ((src[i + 1] & 0xC0) != 0x80) || ((src[i + 2] & 0xC0) != 0x80) || ((src[i + 3] & 0xC0) != 0x80))
+                return false;
+            // Overlong encoding or code point above U+10FFFF
+            if (((lead == 0xF0) && (src[i + 1] < 0x90)) || ((lead == 0xF4) && (src[i + 1] > 0x8F)))
+                return false;
+            i += 4;
+        }
+        else
+            return false;
+    }
+
+    return true;
 }
 
-std::wstring Encoding::FromUTF8(std::string_view str)
+#if defined(CPPCOMMON_ENCODING_X86)
+
+// Error bits of the UTF-8 lookup tables
+const uint8_t UTF8_TOO_SHORT = 1 << 0;
+const uint8_t UTF8_TOO_LONG = 1 << 1;
+const uint8_t UTF8_OVERLONG_3 = 1 << 2;
+const uint8_t UTF8_TOO_LARGE = 1 << 3;
+const uint8_t UTF8_SURROGATE = 1 << 4;
+const uint8_t UTF8_OVERLONG_2 = 1 << 5;
+const uint8_t UTF8_TOO_LARGE_1000 = 1 << 6;
+const uint8_t UTF8_OVERLONG_4 = 1 << 6;
+const uint8_t UTF8_TWO_CONTS = 1 << 7;
+const uint8_t UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS;
+
+// High nibble of the first byte
+#define CPPCOMMON_UTF8_BYTE_1_HIGH \
+    (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, \
+    (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, (char)UTF8_TOO_LONG, \
+    (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS, (char)UTF8_TWO_CONTS, \
+    (char)(UTF8_TOO_SHORT | UTF8_OVERLONG_2), \
+    (char)UTF8_TOO_SHORT, \
+    (char)(UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE), \
+    (char)(UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4)
+
+// Low nibble of the first byte
+#define CPPCOMMON_UTF8_BYTE_1_LOW \
+    (char)(UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4), \
+    (char)(UTF8_CARRY | UTF8_OVERLONG_2), \
+    (char)UTF8_CARRY, \
+    (char)UTF8_CARRY, \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000), \
+    (char)(UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000)
+
+// High nibble of the second byte
+#define CPPCOMMON_UTF8_BYTE_2_HIGH \
+    (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, \
+    (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, \
+    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4), \
+    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE), \
+    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE), \
+    (char)(UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE), \
+    (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT, (char)UTF8_TOO_SHORT
+
+// Maximal values of the last block bytes which do not start an incomplete sequence
+#define CPPCOMMON_UTF8_INCOMPLETE \
+    (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, \
+    (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xEF, (char)0xDF, (char)0xBF
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+inline __m128i UTF8CheckBlockSSSE3(__m128i input, __m128i prev_input)
 {
-#if defined(__CYGWIN__) || defined(__MINGW32__) || defined(__MINGW64__)
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::wstring(tmp.data(), tmp.data() + tmp.size());
-#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    std::wstring_convert<std::codecvt_utf8<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#elif defined(_WIN32) || defined(_WIN64)
-    std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
-#endif
+    const __m128i byte_1_high = _mm_setr_epi8(CPPCOMMON_UTF8_BYTE_1_HIGH);
+    const __m128i byte_1_low = _mm_setr_epi8(CPPCOMMON_UTF8_BYTE_1_LOW);
+    const __m128i byte_2_high = _mm_setr_epi8(CPPCOMMON_UTF8_BYTE_2_HIGH);
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    // Check special cases of the two byte sequences
+    __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    __m128i special = _mm_and_si128(
+        _mm_and_si128(_mm_shuffle_epi8(byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), mask)), _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, mask))),
+        _mm_shuffle_epi8(byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), mask)));
+
+    // Check continuations of the three and four byte sequences
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    __m128i is_third = _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xE0 - 0x80)));
+    __m128i is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xF0 - 0x80)));
+    __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third, is_fourth), _mm_set1_epi8((char)0x80));
+
+    return _mm_xor_si128(must_be_continuation, special);
 }
 
-std::u16string Encoding::UTF8toUTF16(std::string_view str)
+CPPCOMMON_ENCODING_TARGET("ssse3")
+bool UTF8ValidateSSSE3(const uint8_t* src, size_t size)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u16string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
+    const __m128i incomplete = _mm_setr_epi8(CPPCOMMON_UTF8_INCOMPLETE);
+
+    __m128i error = _mm_setzero_si128();
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+
+    uint8_t tail[16] = { 0 };
+    for (size_t i = 0; i < size; i += 16)
+    {
+        // The last block is padded with zeros
+        __m128i input;
+        if ((i + 16) <= size)
+            input = _mm_loadu_si128((const __m128i*)(src + i));
+        else
+        {
+            std::memcpy(tail, src + i, size - i);
+            input = _mm_loadu_si128((const __m128i*)tail);
+        }
+
+        if (_mm_movemask_epi8(input) == 0)
+            error = _mm_or_si128(error, prev_incomplete);
+        else
+        {
+            error = _mm_or_si128(error, UTF8CheckBlockSSSE3(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, incomplete);
+        }
+        prev_input = input;
+    }
+    error = _mm_or_si128(error, prev_incomplete);
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+inline __m256i UTF8CheckBlockAVX2(__m256i input, __m256i prev_input)
+{
+    const __m256i byte_1_high = _mm256_setr_epi8(CPPCOMMON_UTF8_BYTE_1_HIGH, CPPCOMMON_UTF8_BYTE_1_HIGH);
+    const __m256i byte_1_low = _mm256_setr_epi8(CPPCOMMON_UTF8_BYTE_1_LOW, CPPCOMMON_UTF8_BYTE_1_LOW);
+    const __m256i byte_2_high = _mm256_setr_epi8(CPPCOMMON_UTF8_BYTE_2_HIGH, CPPCOMMON_UTF8_BYTE_2_HIGH);
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    // Shift the input by N bytes across 128-bit lanes
+    __m256i prev = _mm256_permute2x128_si256(prev_input, input, 0x21);
+
+    // Check special cases of the two byte sequences
+    __m256i prev1 = _mm256_alignr_epi8(input, prev, 15);
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(_mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask)), _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, mask))),
+        _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask)));
+
+    // Check continuations of the three and four byte sequences
+    __m256i prev2 = _mm256_alignr_epi8(input, prev, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, prev, 13);
+    __m256i is_third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+    __m256i is_fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+    __m256i must_be_continuation = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8((char)0x80));
+
+    return _mm256_xor_si256(must_be_continuation, special);
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+bool UTF8ValidateAVX2(const uint8_t* src, size_t size)
+{
+    const __m256i incomplete = _mm256_setr_epi8((char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF, (char)0xFF,
+                                                CPPCOMMON_UTF8_INCOMPLETE);
+
+    __m256i error = _mm256_setzero_si256();
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+
+    uint8_t tail[32] = { 0 };
+    for (size_t i = 0; i < size; i += 32)
+    {
+        // The last block is padded with zeros
+        __m256i input;
+        if ((i + 32) <= size)
+            input = _mm256_loadu_si256((const __m256i*)(src + i));
+        else
+        {
+            std::memcpy(tail, src + i, size - i);
+            input = _mm256_loadu_si256((const __m256i*)tail);
+        }
+
+        if (_mm256_movemask_epi8(input) == 0)
+            error = _mm256_or_si256(error, prev_incomplete);
+        else
+        {
+            error = _mm256_or_si256(error, UTF8CheckBlockAVX2(input, prev_input));
+            prev_incomplete = _mm256_subs_epu8(input, incomplete);
+        }
+        prev_input = input;
+    }
+    error = _mm256_or_si256(error, prev_incomplete);
+
+    return _mm256_testz_si256(error, error) != 0;
+}
+
+#undef CPPCOMMON_UTF8_BYTE_1_HIGH
+#undef CPPCOMMON_UTF8_BYTE_1_LOW
+#undef CPPCOMMON_UTF8_BYTE_2_HIGH
+#undef CPPCOMMON_UTF8_INCOMPLETE
+
+#endif
+
+bool UTF8Validate(const uint8_t* src, size_t size)
+{
+#if defined(CPPCOMMON_ENCODING_X86)
+    if (CPU::HasAVX2())
+        return UTF8ValidateAVX2(src, size);
+    else if (CPU::HasSSSE3())
+        return UTF8ValidateSSSE3(src, size);
 #endif
+    return UTF8ValidateScalar(src, size);
 }
 
-std::u32string Encoding::UTF8toUTF32(std::string_view str)
+// Count UTF-8 leading bytes and leading bytes of four byte sequences
+void UTF8Count(const uint8_t* src, size_t size, size_t& leads, size_t& leads4)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(str.data(), str.data() + str.size());
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.from_bytes(str.data(), str.data() + str.size());
+    size_t i = 0;
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    while ((i + 16) <= size)
+    {
+        // Accumulate 8-bit counters in batches to avoid overflow
+        __m128i count = _mm_setzero_si128();
+        __m128i count4 = _mm_setzero_si128();
+        for (size_t batch = 0; ((i + 16) <= size) && (batch < 255); i += 16, ++batch)
+        {
+            __m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+            count = _mm_sub_epi8(count, _mm_cmpgt_epi8(input, _mm_set1_epi8(-65)));
+            count4 = _mm_sub_epi8(count4, _mm_cmpeq_epi8(_mm_max_epu8(input, _mm_set1_epi8((char)0xF0)), input));
+        }
+        count = _mm_sad_epu8(count, zero);
+        count4 = _mm_sad_epu8(count4, zero);
+        leads += (size_t)_mm_cvtsi128_si32(count) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(count, 8));
+        leads4 += (size_t)_mm_cvtsi128_si32(count4) + (size_t)_mm_cvtsi128_si32(_mm_srli_si128(count4, 8));
+    }
 #endif
+    for (; i < size; ++i)
+    {
+        leads += ((int8_t)src[i] > -65) ? 1 : 0;
+        leads4 += (src[i] >= 0xF0) ? 1 : 0;
+    }
 }
 
-std::string Encoding::UTF16toUTF8(std::u16string_view str)
+// Decode the valid UTF-8 string into UTF-16 or UTF-32 code units
+template <typename T>
+T* UTF8Decode(const uint8_t* src, size_t size, T* dst)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8_utf16<uint16_t>, uint16_t> convert;
-    return convert.to_bytes((uint16_t*)str.data(), (uint16_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
+    size_t i = 0;
+    while (i < size)
+    {
+#if defined(CPPCOMMON_ENCODING_SSE2)
+        // Widen ASCII blocks
+        if ((i + 16) <= size)
+        {
+            __m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+            if (_mm_movemask_epi8(input) == 0)
+            {
+                const __m128i zero = _mm_setzero_si128();
+                __m128i lo = _mm_unpacklo_epi8(input, zero);
+                __m128i hi = _mm_unpackhi_epi8(input, zero);
+                if constexpr (sizeof(T) == 2)
+                {
+                    _mm_storeu_si128((__m128i*)(dst + 0), lo);
+                    _mm_storeu_si128((__m128i*)(dst + 8), hi);
+                }
+                else
+                {
+                    _mm_storeu_si128((__m128i*)(dst + 0), _mm_unpacklo_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i*)(dst + 4), _mm_unpackhi_epi16(lo, zero));
+                    _mm_storeu_si128((__m128i*)(dst + 8), _mm_unpacklo_epi16(hi, zero));
+                    _mm_storeu_si128((__m128i*)(dst + 12), _mm_unpackhi_epi16(hi, zero));
+                }
+                i += 16;
+                dst += 16;
+                continue;
+            }
+        }
 #endif
+
+        uint32_t lead = src[i];
+        if (lead < 0x80)
+        {
+            *dst++ = (T)lead;
+            i += 1;
+        }
+        else if (lead < 0xE0)
+        {
+            *dst++ = (T)(((lead & 0x1F) << 6) | (src[i + 1] & 0x3F));
+            i += 2;
+        }
+        else if (lead < 0xF0)
+        {
+            *dst++ = (T)(((lead & 0x0F) << 12) | ((src[i + 1] & 0x3F) << 6) | (src[i + 2] & 0x3F));
+            i += 3;
+        }
+        else
+        {
+            uint32_t cp = ((lead & 0x07) << 18) | ((src[i + 1] & 0x3F) << 12) | ((src[i + 2] & 0x3F) << 6) | (src[i + 3] & 0x3F);
+            if constexpr (sizeof(T) == 2)
+            {
+                cp -= 0x10000;
+                *dst++ = (T)(0xD800 + (cp >> 10));
+                *dst++ = (T)(0xDC00 + (cp & 0x3FF));
+            }
+            else
+                *dst++ = (T)cp;
+            i += 4;
+        }
+    }
+    return dst;
 }
 
-std::u32string Encoding::UTF16toUTF32(std::u16string_view str)
+// Get UTF-8 length of the UTF-16 string (each surrogate is counted as two bytes)
+template <typename T>
+size_t UTF16LengthUTF8(const T* src, size_t size)
 {
-    std::string bytes;
-    bytes.reserve(str.size() * 2);
+    size_t result = 0;
 
-    for (const char16_t ch : str)
+    size_t i = 0;
+#if defined(CPPCOMMON_ENCODING_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+    while ((i + 8) <= size)
     {
-        bytes.push_back((uint8_t)(ch / 256));
-        bytes.push_back((uint8_t)(ch % 256));
+        // Accumulate 32-bit counters in batches to avoid overflow
+        __m128i sum = _mm_setzero_si128();
+        for (size_t batch = 0; ((i + 8) <= size) && (batch < 65536); i += 8, ++batch)
+        {
+            __m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+            __m128i high = _mm_and_si128(input, _mm_set1_epi16((short)0xF800));
+            __m128i lt80 = _mm_cmpeq_epi16(_mm_and_si128(input, _mm_set1_epi16((short)0xFF80)), zero);
+            __m128i lt800 = _mm_cmpeq_epi16(high, zero);
+            __m128i surrogate = _mm_cmpeq_epi16(high, _mm_set1_epi16((short)0xD800));
+            __m128i length = _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(lt80, _mm_add_epi16(lt800, surrogate)));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(length, ones));
+        }
+        uint32_t sums[4];
+        _mm_storeu_si128((__m128i*)sums, sum);
+        result += (size_t)sums[0] + sums[1] + sums[2] + sums[3];
     }
-
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    auto tmp = convert.from_bytes(bytes);
-    return std::u32string(tmp.data(), tmp.data() + tmp.size());
-#else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    return convert.from_bytes(bytes);
 #endif
+    for (; i < size; ++i)
+    {
+        uint32_t ch = (uint16_t)src[i];
+        result += 1 + ((ch >= 0x80) ? 1 : 0) + ((ch >= 0x800) ? 1 : 0) - (((ch & 0xF800) == 0xD800) ? 1 : 0);
+    }
+
+    return result;
 }
 
-std::string Encoding::UTF32toUTF8(std::u32string_view str)
+// Encode the UTF-16 string into UTF-8 with validation
+template <typename T>
+bool UTF16EncodeUTF8(const T* src, size_t size, uint8_t* dst)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convert;
-    return convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convert;
-    return convert.to_bytes(str.data(), str.data() + str.size());
+    size_t i = 0;
+    while (i < size)
+    {
+#if defined(CPPCOMMON_ENCODING_SSE2)
+        // Narrow ASCII blocks
+        if ((i + 16) <= size)
+        {
+            __m128i lo = _mm_loadu_si128((const __m128i*)(src + i + 0));
+            __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 8));
+            __m128i ascii = _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi16((short)0xFF80));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(ascii, _mm_setzero_si128())) == 0xFFFF)
+            {
+                _mm_storeu_si128((__m128i*)dst, _mm_packus_epi16(lo, hi));
+                i += 16;
+                dst += 16;
+                continue;
+            }
+        }
 #endif
+
+        uint32_t ch = (uint16_t)src[i++];
+        if (ch < 0x80)
+            *dst++ = (uint8_t)ch;
+        else if (ch < 0x800)
+        {
+            *dst++ = (uint8_t)(0xC0 | (ch >> 6));
+            *dst++ = (uint8_t)(0x80 | (ch & 0x3F));
+        }
+        else if ((ch & 0xF800) != 0xD800)
+        {
+            *dst++ = (uint8_t)(0xE0 | (ch >> 12));
+            *dst++ = (uint8_t)(0x80 | ((ch >> 6) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | (ch & 0x3F));
+        }
+        else
+        {
+            // Surrogate pair
+            if ((ch >= 0xDC00) || (i >= size) || (((uint16_t)src[i] & 0xFC00) != 0xDC00))
+                return false;
+            uint32_t cp = 0x10000 + ((ch - 0xD800) << 10) + ((uint16_t)src[i++] - 0xDC00);
+            *dst++ = (uint8_t)(0xF0 | (cp >> 18));
+            *dst++ = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | (cp & 0x3F));
+        }
+    }
+    return true;
 }
 
-std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+// Decode the UTF-16 string into UTF-32 with validation
+template <typename TInput, typename TOutput>
+TOutput* UTF16Decode(const TInput* src, size_t size, TOutput* dst)
 {
-#if defined(_MSC_VER)
-    std::wstring_convert<std::codecvt_utf16<uint32_t>, uint32_t> convert;
-    std::string bytes = convert.to_bytes((uint32_t*)str.data(), (uint32_t*)str.data() + str.size());
-#else
-    std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> convert;
-    std::string bytes = convert.to_bytes(str.data(), str.data() + str.size());
-#endif
+    size_t i = 0;
+    while (i < size)
+    {
+        uint32_t ch = (uint16_t)src[i++];
+        if ((ch & 0xF800) != 0xD800)
+            *dst++ = (TOutput)ch;
+        else
+        {
+            // Surrogate pair
+            if ((ch >= 0xDC00) || (i >= size) || (((uint16_t)src[i] & 0xFC00) != 0xDC00))
+                return nullptr;
+            *dst++ = (TOutput)(0x10000 + ((ch - 0xD800) << 10) + ((uint16_t)src[i++] - 0xDC00));
+        }
+    }
+    return dst;
+}
 
-    std::u16string result;
-    result.reserve(bytes.size() / 2);
+// Check the UTF-32 code point
+inline bool UTF32IsValid(uint32_t cp)
+{
+    return (cp <= 0x10FFFF) && ((cp & 0xFFFFF800) != 0xD800);
+}
 
-    for (size_t i = 0; i < bytes.size(); i += 2)
-        result.push_back((char16_t)((uint8_t)(bytes[i]) * 256 + (uint8_t)(bytes[i + 1])));
+// Get UTF-8 length of the UTF-32 string
+template <typename T>
+size_t UTF32LengthUTF8(const T* src, size_t size)
+{
+    size_t result = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint32_t cp = (uint32_t)src[i];
+        result += 1 + ((cp >= 0x80) ? 1 : 0) + ((cp >= 0x800) ? 1 : 0) + ((cp >= 0x10000) ? 1 : 0);
+    }
+    return result;
+}
 
+// Get UTF-16 length of the UTF-32 string
+template <typename T>
+size_t UTF32LengthUTF16(const T* src, size_t size)
+{
+    size_t result = 0;
+    for (size_t i = 0; i < size; ++i)
+        result += 1 + (((uint32_t)src[i] >= 0x10000) ? 1 : 0);
     return result;
 }
 
-std::string Encoding::Base16Encode(std::string_view str)
+// Encode the UTF-32 string into UTF-8 with validation
+template <typename T>
+bool UTF32EncodeUTF8(const T* src, size_t size, uint8_t* dst)
 {
-    const char base16[] = "0123456789ABCDEF";
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint32_t cp = (uint32_t)src[i];
+        if (cp < 0x80)
+            *dst++ = (uint8_t)cp;
+        else if (cp < 0x800)
+        {
+            *dst++ = (uint8_t)(0xC0 | (cp >> 6));
+            *dst++ = (uint8_t)(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            if (!UTF32IsValid(cp))
+                return false;
+            *dst++ = (uint8_t)(0xE0 | (cp >> 12));
+            *dst++ = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            if (!UTF32IsValid(cp))
+                return false;
+            *dst++ = (uint8_t)(0xF0 | (cp >> 18));
+            *dst++ = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = (uint8_t)(0x80 | (cp & 0x3F));
+        }
+    }
+    return true;
+}
 
-    size_t ilength = str.length();
-    size_t olength = ilength * 2;
+// Encode the UTF-32 string into UTF-16 with validation
+template <typename TInput, typename TOutput>
+bool UTF32EncodeUTF16(const TInput* src, size_t size, TOutput* dst)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint32_t cp = (uint32_t)src[i];
+        if (!UTF32IsValid(cp))
+            return false;
+        if (cp < 0x10000)
+            *dst++ = (TOutput)cp;
+        else
+        {
+            cp -= 0x10000;
+            *dst++ = (TOutput)(0xD800 + (cp >> 10));
+            *dst++ = (TOutput)(0xDC00 + (cp & 0x3FF));
+        }
+    }
+    return true;
+}
 
-    std::string result;
-    result.resize(olength, 0);
+// Convert the UTF-8 string into UTF-16 or UTF-32 string
+template <class TString>
+bool UTF8Convert(std::string_view str, TString& result)
+{
+    const uint8_t* src = (const uint8_t*)str.data();
+    size_t size = str.size();
+
+    if (!UTF8Validate(src, size))
+        return false;
+
+    size_t leads = 0;
+    size_t leads4 = 0;
+    UTF8Count(src, size, leads, leads4);
+
+    size_t offset = result.size();
+    result.resize(offset + ((sizeof(typename TString::value_type) == 2) ? (leads + leads4) : leads));
+    UTF8Decode(src, size, result.data() + offset);
+    return true;
+}
 
-    for (size_t i = 0, j = 0; i < ilength;)
+// Convert the UTF-16 string into UTF-8 string
+template <typename T>
+bool UTF16ConvertUTF8(const T* src, size_t size, std::string& result)
+{
+    size_t offset = result.size();
+    result.resize(offset + UTF16LengthUTF8(src, size));
+    if (!UTF16EncodeUTF8(src, size, (uint8_t*)result.data() + offset))
     {
-        uint8_t ch = (uint8_t)str[i++];
+        result.resize(offset);
+        return false;
+    }
+    return true;
+}
 
-        result[j++] = base16[(ch & 0xF0) >> 4];
-        result[j++] = base16[(ch & 0x0F) >> 0];
+// Convert the UTF-16 string into UTF-32 string
+template <typename T, class TString>
+bool UTF16ConvertUTF32(const T* src, size_t size, TString& result)
+{
+    size_t offset = result.size();
+    result.resize(offset + size);
+    auto end = UTF16Decode(src, size, result.data() + offset);
+    if (end == nullptr)
+    {
+        result.resize(offset);
+        return false;
     }
+    result.resize(end - result.data());
+    return true;
+}
 
-    return result;
+// Convert the UTF-32 string into UTF-8 string
+template <typename T>
+bool UTF32ConvertUTF8(const T* src, size_t size, std::string& result)
+{
+    size_t offset = result.size();
+    result.resize(offset + UTF32LengthUTF8(src, size));
+    if (!UTF32EncodeUTF8(src, size, (uint8_t*)result.data() + offset))
+    {
+        result.resize(offset);
+        return false;
+    }
+    return true;
 }
 
-std::string Encoding::Base16Decode(std::string_view str)
+// Convert the UTF-32 string into UTF-16 string
+template <typename T, class TString>
+bool UTF32ConvertUTF16(const T* src, size_t size, TString& result)
+{
+    size_t offset = result.size();
+    result.resize(offset + UTF32LengthUTF16(src, size));
+    if (!UTF32EncodeUTF16(src, size, result.data() + offset))
+    {
+        result.resize(offset);
+        return false;
+    }
+    return true;
+}
+
+void Base16EncodeScalar(const uint8_t* src, size_t size, char* dst)
+{
+    const char base16[] = "0123456789ABCDEF";
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint8_t ch = src[i];
+        *dst++ = base16[(ch & 0xF0) >> 4];
+        *dst++ = base16[(ch & 0x0F) >> 0];
+    }
+}
+
+bool Base16DecodeScalar(const uint8_t* src, size_t size, uint8_t* dst)
 {
     static const unsigned char base16[128] =
     {
@@ -174,116 +703,106 @@ std::string Encoding::Base16Decode(std::string_view str)
         0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
     };
 
-    size_t ilength = str.length();
-
-    assert(((ilength % 2) == 0) && "Invalid Base16 sting!");
-    if ((ilength % 2) != 0)
-        return "";
-
-    size_t olength = ilength / 2;
-
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
+    for (size_t j = 0; j < size; ++j)
     {
-        uint8_t a = (uint8_t)str[i++];
-        uint8_t b = (uint8_t)str[i++];
+        uint8_t a = *src++;
+        uint8_t b = *src++;
 
         // Validate ASCII
-        assert(((a < 0x80) && (b < 0x80)) && "Invalid Base16 content!");
         if ((a >= 0x80) || (b >= 0x80))
-            return "";
+            return false;
 
         // Convert ASCII to Base16
         a = base16[a];
         b = base16[b];
 
-        result[j++] = ((a << 4) | b);
+        // Validate Base16
+        if ((a == 0xFF) || (b == 0xFF))
+            return false;
+
+        dst[j] = (uint8_t)((a << 4) | b);
     }
 
-    return result;
+    return true;
 }
 
-std::string Encoding::Base32Encode(std::string_view str)
+void Base32EncodeScalar(const uint8_t* src, size_t size, char* dst)
 {
     const char base32[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567=";
 
-    size_t ilength = str.length();
-    size_t olength = ((ilength / 5) * 8) + ((ilength % 5) ? 8 : 0);
-
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
+    // Full 5-byte blocks as 40-bit integers
+    size_t i = 0;
+    for (; (i + 5) <= size; i += 5)
     {
-        size_t block = ((ilength - i) < 5 ? (ilength - i) : 5);
-        uint8_t n1, n2, n3, n4, n5, n6, n7, n8;
-        n1 = n2 = n3 = n4 = n5 = n6 = n7 = n8 = 0;
+        uint64_t block = ((uint64_t)src[i + 0] << 32) | ((uint64_t)src[i + 1] << 24) | ((uint64_t)src[i + 2] << 16) | ((uint64_t)src[i + 3] << 8) | (uint64_t)src[i + 4];
+
+        dst[0] = base32[(block >> 35) & 0x1F];
+        dst[1] = base32[(block >> 30) & 0x1F];
+        dst[2] = base32[(block >> 25) & 0x1F];
+        dst[3] = base32[(block >> 20) & 0x1F];
+        dst[4] = base32[(block >> 15) & 0x1F];
+        dst[5] = base32[(block >> 10) & 0x1F];
+        dst[6] = base32[(block >> 5) & 0x1F];
+        dst[7] = base32[(block >> 0) & 0x1F];
+        dst += 8;
+    }
 
-        switch (block)
-        {
-            case 5:
-                n8  = (((uint8_t)str[i + 4] & 0x1F) >> 0);
-                n7  = (((uint8_t)str[i + 4] & 0xE0) >> 5);
-            case 4:
-                n7 |= (((uint8_t)str[i + 3] & 0x03) << 3);
-                n6  = (((uint8_t)str[i + 3] & 0x7C) >> 2);
-                n5  = (((uint8_t)str[i + 3] & 0x80) >> 7);
-            case 3:
-                n5 |= (((uint8_t)str[i + 2] & 0x0F) << 1);
-                n4  = (((uint8_t)str[i + 2] & 0xF0) >> 4);
-            case 2:
-                n4 |= (((uint8_t)str[i + 1] & 0x01) << 4);
-                n3  = (((uint8_t)str[i + 1] & 0x3E) >> 1);
-                n2  = (((uint8_t)str[i + 1] & 0xC0) >> 6);
-            case 1:
-                n2 |= (((uint8_t)str[i + 0] & 0x07) << 2);
-                n1  = (((uint8_t)str[i + 0] & 0xF8) >> 3);
-                break;
-            default:
-                assert(false && "Invalid Base32 operation!");
-        }
-        i += block;
-
-        // Validate
-        assert((n1 <= 31) && "Invalid Base32 n1 value!");
-        assert((n2 <= 31) && "Invalid Base32 n2 value!" );
-        assert((n3 <= 31) && "Invalid Base32 n3 value!" );
-        assert((n4 <= 31) && "Invalid Base32 n4 value!" );
-        assert((n5 <= 31) && "Invalid Base32 n5 value!" );
-        assert((n6 <= 31) && "Invalid Base32 n6 value!" );
-        assert((n7 <= 31) && "Invalid Base32 n7 value!" );
-        assert((n8 <= 31) && "Invalid Base32 n8 value!" );
+    // Last partial block with padding
+    size_t block = size - i;
+    if (block == 0)
+        return;
 
-        // Padding
-        switch (block)
-        {
-            case 1: n3 = n4 = 32;
-            case 2: n5 = 32;
-            case 3: n6 = n7 = 32;
-            case 4: n8 = 32;
-            case 5:
-                break;
-            default:
-                assert(false && "Invalid Base32 operation!");
-        }
+    uint8_t n1, n2, n3, n4, n5, n6, n7, n8;
+    n1 = n2 = n3 = n4 = n5 = n6 = n7 = n8 = 0;
+
+    switch (block)
+    {
+        case 4:
+            n7 |= ((src[i + 3] & 0x03) << 3);
+            n6  = ((src[i + 3] & 0x7C) >> 2);
+            n5  = ((src[i + 3] & 0x80) >> 7);
+            [[fallthrough]];
+        case 3:
+            n5 |= ((src[i + 2] & 0x0F) << 1);
+            n4  = ((src[i + 2] & 0xF0) >> 4);
+            [[fallthrough]];
+        case 2:
+            n4 |= ((src[i + 1] & 0x01) << 4);
+            n3  = ((src[i + 1] & 0x3E) >> 1);
+            n2  = ((src[i + 1] & 0xC0) >> 6);
+            [[fallthrough]];
+        case 1:
+            n2 |= ((src[i + 0] & 0x07) << 2);
+            n1  = ((src[i + 0] & 0xF8) >> 3);
+            break;
+        default:
+            assert(false && "Invalid Base32 operation!");
+    }
 
-        // 8 outputs
-        result[j++] = base32[n1];
-        result[j++] = base32[n2];
-        result[j++] = base32[n3];
-        result[j++] = base32[n4];
-        result[j++] = base32[n5];
-        result[j++] = base32[n6];
-        result[j++] = base32[n7];
-        result[j++] = base32[n8];
+    // Padding
+    switch (block)
+    {
+        case 1: n3 = n4 = 32; [[fallthrough]];
+        case 2: n5 = 32; [[fallthrough]];
+        case 3: n6 = n7 = 32; [[fallthrough]];
+        case 4: n8 = 32;
+            break;
+        default:
+            assert(false && "Invalid Base32 operation!");
     }
 
-    return result;
+    // 8 outputs
+    *dst++ = base32[n1];
+    *dst++ = base32[n2];
+    *dst++ = base32[n3];
+    *dst++ = base32[n4];
+    *dst++ = base32[n5];
+    *dst++ = base32[n6];
+    *dst++ = base32[n7];
+    *dst++ = base32[n8];
 }
 
-std::string Encoding::Base32Decode(std::string_view str)
+size_t Base32DecodeScalar(const uint8_t* src, size_t size, uint8_t* dst)
 {
     static const unsigned char base32[128] =
     {
@@ -305,166 +824,835 @@ std::string Encoding::Base32Decode(std::string_view str)
         0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
     };
 
-    size_t ilength = str.length();
-
-    assert(((ilength % 8) == 0) && "Invalid Base32 sting!");
-    if ((ilength % 8) != 0)
-        return "";
-
-    size_t olength = (ilength / 8) * 5;
-
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
+    size_t j = 0;
+    for (size_t i = 0; i < size; i += 8)
     {
         // 8 inputs
-        uint8_t n1 = (uint8_t)str[i++];
-        uint8_t n2 = (uint8_t)str[i++];
-        uint8_t n3 = (uint8_t)str[i++];
-        uint8_t n4 = (uint8_t)str[i++];
-        uint8_t n5 = (uint8_t)str[i++];
-        uint8_t n6 = (uint8_t)str[i++];
-        uint8_t n7 = (uint8_t)str[i++];
-        uint8_t n8 = (uint8_t)str[i++];
+        const uint8_t* n = src + i;
 
         // Validate ASCII
-        assert(((n1 < 0x80) && (n2 < 0x80) && (n3 < 0x80) && (n4 < 0x80) && (n5 < 0x80) && (n6 < 0x80) && (n7 < 0x80) && (n8 < 0x80)) && "Invalid Base32 content!");
-        if ((n1 >= 0x80) || (n2 >= 0x80) || (n3 >= 0x80) || (n4 >= 0x80) || (n5 >= 0x80) || (n6 >= 0x80) || (n7 >= 0x80) || (n8 >= 0x80))
-            return "";
+        uint8_t ascii = n[0] | n[1] | n[2] | n[3] | n[4] | n[5] | n[6] | n[7];
+        if (ascii >= 0x80)
+            return (size_t)-1;
 
         // Convert ASCII to Base32
-        n1 = base32[n1];
-        n2 = base32[n2];
-        n3 = base32[n3];
-        n4 = base32[n4];
-        n5 = base32[n5];
-        n6 = base32[n6];
-        n7 = base32[n7];
-        n8 = base32[n8];
+        uint8_t n1 = base32[n[0]];
+        uint8_t n2 = base32[n[1]];
+        uint8_t n3 = base32[n[2]];
+        uint8_t n4 = base32[n[3]];
+        uint8_t n5 = base32[n[4]];
+        uint8_t n6 = base32[n[5]];
+        uint8_t n7 = base32[n[6]];
+        uint8_t n8 = base32[n[7]];
+
+        // Fast path for the block without padding
+        if ((n1 | n2 | n3 | n4 | n5 | n6 | n7 | n8) <= 31)
+        {
+            uint64_t block = ((uint64_t)n1 << 35) | ((uint64_t)n2 << 30) | ((uint64_t)n3 << 25) | ((uint64_t)n4 << 20) | ((uint64_t)n5 << 15) | ((uint64_t)n6 << 10) | ((uint64_t)n7 << 5) | (uint64_t)n8;
+            dst[j++] = (uint8_t)(block >> 32);
+            dst[j++] = (uint8_t)(block >> 24);
+            dst[j++] = (uint8_t)(block >> 16);
+            dst[j++] = (uint8_t)(block >> 8);
+            dst[j++] = (uint8_t)(block >> 0);
+            continue;
+        }
 
         // Validate Base32
-        assert(((n1 <= 31) && (n2 <= 31)) && "Invalid Base32 content!");
         if ((n1 > 31) || (n2 > 31))
-            return "";
+            return (size_t)-1;
 
         // The following can be padding
-        assert(((n3 <= 32) && (n4 <= 32) && (n5 <= 32) && (n6 <= 32) && (n7 <= 32) && (n8 <= 32)) && "Invalid Base32 content!");
         if ((n3 > 32) || (n4 > 32) || (n5 > 32) || (n6 > 32) || (n7 > 32) || (n8 > 32))
-            return "";
+            return (size_t)-1;
+
+        // Padding is allowed only at the end of the last block (6, 4, 3 or 1 characters)
+        if ((i + 8) < size)
+            return (size_t)-1;
+        if ((n8 != 32) || ((n3 == 32) && (n4 != 32)) || ((n4 == 32) && (n5 != 32)) || ((n5 == 32) && (n6 != 32)) || ((n6 == 32) && (n7 != 32)))
+            return (size_t)-1;
+        if (((n7 == 32) && (n6 != 32)) || ((n4 == 32) && (n3 != 32)))
+            return (size_t)-1;
 
         // 5 outputs
-        result[j++] = ((n1 & 0x1f) << 3) | ((n2 & 0x1c) >> 2);
-        result[j++] = ((n2 & 0x03) << 6) | ((n3 & 0x1f) << 1) | ((n4 & 0x10) >> 4);
-        result[j++] = ((n4 & 0x0f) << 4) | ((n5 & 0x1e) >> 1);
-        result[j++] = ((n5 & 0x01) << 7) | ((n6 & 0x1f) << 2) | ((n7 & 0x18) >> 3);
-        result[j++] = ((n7 & 0x07) << 5) | ((n8 & 0x1f));
+        dst[j++] = (uint8_t)(((n1 & 0x1f) << 3) | ((n2 & 0x1c) >> 2));
+        dst[j++] = (uint8_t)(((n2 & 0x03) << 6) | ((n3 & 0x1f) << 1) | ((n4 & 0x10) >> 4));
+        dst[j++] = (uint8_t)(((n4 & 0x0f) << 4) | ((n5 & 0x1e) >> 1));
+        dst[j++] = (uint8_t)(((n5 & 0x01) << 7) | ((n6 & 0x1f) << 2) | ((n7 & 0x18) >> 3));
+        dst[j++] = (uint8_t)(((n7 & 0x07) << 5) | ((n8 & 0x1f)));
 
         // Padding
         if (n8 == 32)
         {
-            result.resize(result.size() - 1);
-            assert((((n7 == 32) && (n6 == 32)) || (n7 != 32)) && "Invalid Base32 content!");
+            --j;
             if (n6 == 32)
             {
-                result.resize(result.size() - 1);
+                --j;
                 if (n5 == 32)
                 {
-                    result.resize(result.size() - 1);
-                    assert((((n4 == 32) && (n3 == 32)) || (n4 != 32)) && "Invalid Base32 content!");
+                    --j;
                     if (n3 == 32)
-                    {
-                        result.resize(result.size() - 1);
-                    }
+                        --j;
                 }
             }
         }
     }
 
-    return result;
+    return j;
 }
 
-std::string Encoding::Base64Encode(std::string_view str)
+void Base64EncodeScalar(const uint8_t* src, size_t size, char* dst)
 {
     const char base64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-    const size_t mods[] = { 0, 2, 1 };
-
-    size_t ilength = str.length();
-    size_t olength = 4 * ((ilength + 2) / 3);
 
-    std::string result;
-    result.resize(olength, 0);
-
-    for (size_t i = 0, j = 0; i < ilength;)
+    size_t i = 0;
+    for (; (i + 3) <= size; i += 3)
     {
-        uint32_t octet_a = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_b = i < ilength ? (uint8_t)str[i++] : 0;
-        uint32_t octet_c = i < ilength ? (uint8_t)str[i++] : 0;
+        uint32_t triple = ((uint32_t)src[i] << 0x10) + ((uint32_t)src[i + 1] << 0x08) + (uint32_t)src[i + 2];
 
-        uint32_t triple = (octet_a << 0x10) + (octet_b << 0x08) + octet_c;
-
-        result[j++] = base64[(triple >> 3 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 2 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 1 * 6) & 0x3F];
-        result[j++] = base64[(triple >> 0 * 6) & 0x3F];
+        *dst++ = base64[(triple >> 3 * 6) & 0x3F];
+        *dst++ = base64[(triple >> 2 * 6) & 0x3F];
+        *dst++ = base64[(triple >> 1 * 6) & 0x3F];
+        *dst++ = base64[(triple >> 0 * 6) & 0x3F];
     }
 
-    for (size_t i = 0; i < mods[ilength % 3]; ++i)
-        result[result.size() - 1 - i] = '=';
+    // Last partial block with padding
+    size_t block = size - i;
+    if (block == 0)
+        return;
 
-    return result;
+    uint32_t octet_a = src[i];
+    uint32_t octet_b = (block > 1) ? src[i + 1] : 0;
+    uint32_t triple = (octet_a << 0x10) + (octet_b << 0x08);
+
+    *dst++ = base64[(triple >> 3 * 6) & 0x3F];
+    *dst++ = base64[(triple >> 2 * 6) & 0x3F];
+    *dst++ = (block > 1) ? base64[(triple >> 1 * 6) & 0x3F] : '=';
+    *dst++ = '=';
 }
 
-std::string Encoding::Base64Decode(std::string_view str)
+bool Base64DecodeScalar(const uint8_t* src, size_t size, uint8_t* dst)
 {
+    // Invalid characters are marked with 0xFF, padding character is marked with 0x40
     static const unsigned char base64[256] =
     {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3f,
-        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
-        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
-        0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3e, 0xFF, 0xFF, 0xFF, 0x3f,
+        0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xFF, 0xFF, 0xFF, 0x40, 0xFF, 0xFF,
+        0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+        0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
     };
 
-    size_t ilength = str.length();
+    for (size_t i = 0, j = 0; i < size; i += 4)
+    {
+        uint8_t n1 = base64[src[i + 0]];
+        uint8_t n2 = base64[src[i + 1]];
+        uint8_t n3 = base64[src[i + 2]];
+        uint8_t n4 = base64[src[i + 3]];
 
-    if (ilength % 4 != 0)
-        return "";
+        // Fast path for the block without padding
+        if ((n1 | n2 | n3 | n4) <= 0x3F)
+        {
+            uint32_t triple = ((uint32_t)n1 << 3 * 6) + ((uint32_t)n2 << 2 * 6) + ((uint32_t)n3 << 1 * 6) + ((uint32_t)n4 << 0 * 6);
+            dst[j++] = (triple >> 2 * 8) & 0xFF;
+            dst[j++] = (triple >> 1 * 8) & 0xFF;
+            dst[j++] = (triple >> 0 * 8) & 0xFF;
+            continue;
+        }
 
-    size_t olength = ilength / 4 * 3;
+        // Padding is allowed only in two last characters of the last block
+        if ((n1 > 0x3F) || (n2 > 0x3F) || (n4 != 0x40) || ((n3 > 0x3F) && (n3 != 0x40)) || ((i + 4) < size))
+            return false;
 
-    if (str[ilength - 1] == '=') olength--;
+        uint32_t triple = ((uint32_t)n1 << 3 * 6) + ((uint32_t)n2 << 2 * 6) + ((uint32_t)(n3 & 0x3F) << 1 * 6);
+        dst[j++] = (triple >> 2 * 8) & 0xFF;
+        if (n3 != 0x40)
+            dst[j++] = (triple >> 1 * 8) & 0xFF;
+    }
+
+    return true;
+}
+
+#if defined(CPPCOMMON_ENCODING_X86)
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+size_t Base16EncodeSSSE3(const uint8_t* src, size_t size, char* dst)
+{
+    const __m128i lut = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m128i mask = _mm_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 16)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+        __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(input, mask));
+        _mm_storeu_si128((__m128i*)(dst + i * 2 + 0), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128((__m128i*)(dst + i * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+size_t Base16EncodeAVX2(const uint8_t* src, size_t size, char* dst)
+{
+    const __m256i lut = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+                                         '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        // Reorder 64-bit quarters, so in-lane unpacking gives the sequential output
+        __m256i input = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i*)(src + i)), 0xD8);
+        __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+        __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(input, mask));
+        _mm256_storeu_si256((__m256i*)(dst + i * 2 + 0), _mm256_unpacklo_epi8(hi, lo));
+        _mm256_storeu_si256((__m256i*)(dst + i * 2 + 32), _mm256_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+inline __m128i Base16NibblesSSSE3(__m128i input, int& valid)
+{
+    __m128i digits = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    __m128i letters = _mm_sub_epi8(_mm_or_si128(input, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+    valid &= _mm_movemask_epi8(_mm_or_si128(is_digit, is_letter));
+    return _mm_or_si128(_mm_and_si128(is_digit, digits), _mm_and_si128(is_letter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+size_t Base16DecodeSSSE3(const uint8_t* src, size_t size, uint8_t* dst)
+{
+    const __m128i weights = _mm_set1_epi16(0x0110);
+
+    size_t j = 0;
+    for (; (j + 16) <= size; j += 16)
+    {
+        int valid = 0xFFFF;
+        __m128i a = Base16NibblesSSSE3(_mm_loadu_si128((const __m128i*)(src + j * 2 + 0)), valid);
+        __m128i b = Base16NibblesSSSE3(_mm_loadu_si128((const __m128i*)(src + j * 2 + 16)), valid);
+
+        // Invalid characters are left for the scalar decoder
+        if (valid != 0xFFFF)
+            break;
+
+        _mm_storeu_si128((__m128i*)(dst + j), _mm_packus_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights)));
+    }
+    return j;
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+inline __m256i Base16NibblesAVX2(__m256i input, int& valid)
+{
+    __m256i digits = _mm256_sub_epi8(input, _mm256_set1_epi8('0'));
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    __m256i letters = _mm256_sub_epi8(_mm256_or_si256(input, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+    valid &= _mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter));
+    return _mm256_or_si256(_mm256_and_si256(is_digit, digits), _mm256_and_si256(is_letter, _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+size_t Base16DecodeAVX2(const uint8_t* src, size_t size, uint8_t* dst)
+{
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+
+    size_t j = 0;
+    for (; (j + 32) <= size; j += 32)
+    {
+        int valid = -1;
+        __m256i a = Base16NibblesAVX2(_mm256_loadu_si256((const __m256i*)(src + j * 2 + 0)), valid);
+        __m256i b = Base16NibblesAVX2(_mm256_loadu_si256((const __m256i*)(src + j * 2 + 32)), valid);
+
+        // Invalid characters are left for the scalar decoder
+        if (valid != -1)
+            break;
+
+        // Packing works in 128-bit lanes, so reorder 64-bit quarters back
+        __m256i packed = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights), _mm256_maddubs_epi16(b, weights));
+        _mm256_storeu_si256((__m256i*)(dst + j), _mm256_permute4x64_epi64(packed, 0xD8));
+    }
+    return j;
+}
+
+// Base64 codec is based on the SIMD algorithms by Wojciech Mula, Daniel Lemire and Alfred Klomp
+// http://0x80.pl/articles/index.html#base64-algorithm-new
+// https://github.com/aklomp/base64
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+inline __m128i Base64EncodeBlockSSSE3(__m128i input)
+{
+    // Split 3 bytes into 4 sextets in each 32-bit lane
+    input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(t0, t1);
+
+    // Translate sextets into ASCII with the offset lookup
+    __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, result), indices);
+}
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+size_t Base64EncodeSSSE3(const uint8_t* src, size_t size, char* dst)
+{
+    // Each block reads 16 bytes and encodes 12 of them
+    size_t i = 0;
+    for (; (i + 16) <= size; i += 12, dst += 16)
+        _mm_storeu_si128((__m128i*)dst, Base64EncodeBlockSSSE3(_mm_loadu_si128((const __m128i*)(src + i))));
+    return i;
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+size_t Base64EncodeAVX2(const uint8_t* src, size_t size, char* dst)
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+                                             1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    // Each block reads 28 bytes and encodes 24 of them (12 bytes per 128-bit lane)
+    size_t i = 0;
+    for (; (i + 28) <= size; i += 24, dst += 32)
+    {
+        __m128i lo = _mm_loadu_si128((const __m128i*)(src + i + 0));
+        __m128i hi = _mm_loadu_si128((const __m128i*)(src + i + 12));
+        __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        input = _mm256_shuffle_epi8(input, shuffle);
+        __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(t0, t1);
+
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*)dst, _mm256_add_epi8(_mm256_shuffle_epi8(offsets, result), indices));
+    }
+    return i;
+}
+
+CPPCOMMON_ENCODING_TARGET("ssse3")
+size_t Base64DecodeSSSE3(const uint8_t* src, size_t size, uint8_t* dst, size_t olength)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask_2F = _mm_set1_epi8(0x2F);
+
+    // Each block decodes 16 characters into 12 bytes and writes 16 bytes
+    size_t i = 0;
+    for (size_t j = 0; ((i + 16) <= size) && ((j + 16) <= olength); i += 16, j += 12)
+    {
+        __m128i input = _mm_loadu_si128((const __m128i*)(src + i));
+
+        // Invalid and padding characters are left for the scalar decoder
+        __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(input, 4), mask_2F);
+        __m128i lo_nibbles = _mm_and_si128(input, mask_2F);
+        __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+            break;
+
+        // Translate ASCII into sextets
+        __m128i eq_2F = _mm_cmpeq_epi8(input, mask_2F);
+        __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi_nibbles));
+        input = _mm_add_epi8(input, roll);
+
+        // Pack 4 sextets into 3 bytes in each 32-bit lane
+        __m128i merged = _mm_maddubs_epi16(input, _mm_set1_epi32(0x01400140));
+        __m128i output = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        output = _mm_shuffle_epi8(output, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        _mm_storeu_si128((__m128i*)(dst + j), output);
+    }
+    return i;
+}
+
+CPPCOMMON_ENCODING_TARGET("avx2")
+size_t Base64DecodeAVX2(const uint8_t* src, size_t size, uint8_t* dst, size_t olength)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                              0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i mask_2F = _mm256_set1_epi8(0x2F);
+    const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                             2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    // Each block decodes 32 characters into 24 bytes and writes 32 bytes
+    size_t i = 0;
+    for (size_t j = 0; ((i + 32) <= size) && ((j + 32) <= olength); i += 32, j += 24)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(src + i));
+
+        // Invalid and padding characters are left for the scalar decoder
+        __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), mask_2F);
+        __m256i lo_nibbles = _mm256_and_si256(input, mask_2F);
+        __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        if (!_mm256_testz_si256(lo, hi))
+            break;
+
+        // Translate ASCII into sextets
+        __m256i eq_2F = _mm256_cmpeq_epi8(input, mask_2F);
+        __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+        input = _mm256_add_epi8(input, roll);
+
+        // Pack 4 sextets into 3 bytes in each 32-bit lane and join 12-byte lane results
+        __m256i merged = _mm256_maddubs_epi16(input, _mm256_set1_epi32(0x01400140));
+        __m256i output = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        output = _mm256_shuffle_epi8(output, shuffle);
+        output = _mm256_permutevar8x32_epi32(output, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm256_storeu_si256((__m256i*)(dst + j), output);
+    }
+    return i;
+}
+
+#endif
+
+} // namespace Internals
+//! @endcond
+
+
+std::string Encoding::ToUTF8(std::wstring_view wstr)
+{
+    std::string result;
+    if (!ToUTF8(wstr, result))
+        throwex ArgumentException("Invalid wide string!");
+    return result;
+}
+
+bool Encoding::ToUTF8(std::wstring_view wstr, std::string& result)
+{
+    // System wide-string is UTF-16 (Windows) or UTF-32 (Unix)
+    if constexpr (sizeof(wchar_t) == 2)
+        return Internals::UTF16ConvertUTF8(wstr.data(), wstr.size(), result);
+    else
+        return Internals::UTF32ConvertUTF8(wstr.data(), wstr.size(), result);
+}
+
+std::wstring Encoding::FromUTF8(std::string_view str)
+{
+    std::wstring result;
+    if (!FromUTF8(str, result))
+        throwex ArgumentException("Invalid UTF-8 string!");
+    return result;
+}
+
+bool Encoding::FromUTF8(std::string_view str, std::wstring& result)
+{
+    return Internals::UTF8Convert(str, result);
+}
+
+std::u16string Encoding::UTF8toUTF16(std::string_view str)
+{
+    std::u16string result;
+    if (!UTF8toUTF16(str, result))
+        throwex ArgumentException("Invalid UTF-8 string!");
+    return result;
+}
+
+bool Encoding::UTF8toUTF16(std::string_view str, std::u16string& result)
+{
+    return Internals::UTF8Convert(str, result);
+}
+
+std::u32string Encoding::UTF8toUTF32(std::string_view str)
+{
+    std::u32string result;
+    if (!UTF8toUTF32(str, result))
+        throwex ArgumentException("Invalid UTF-8 string!");
+    return result;
+}
+
+bool Encoding::UTF8toUTF32(std::string_view str, std::u32string& result)
+{
+    return Internals::UTF8Convert(str, result);
+}
+
+std::string Encoding::UTF16toUTF8(std::u16string_view str)
+{
+    std::string result;
+    if (!UTF16toUTF8(str, result))
+        throwex ArgumentException("Invalid UTF-16 string!");
+    return result;
+}
+
+bool Encoding::UTF16toUTF8(std::u16string_view str, std::string& result)
+{
+    return Internals::UTF16ConvertUTF8(str.data(), str.size(), result);
+}
+
+std::u32string Encoding::UTF16toUTF32(std::u16string_view str)
+{
+    std::u32string result;
+    if (!UTF16toUTF32(str, result))
+        throwex ArgumentException("Invalid UTF-16 string!");
+    return result;
+}
+
+bool Encoding::UTF16toUTF32(std::u16string_view str, std::u32string& result)
+{
+    return Internals::UTF16ConvertUTF32(str.data(), str.size(), result);
+}
+
+std::string Encoding::UTF32toUTF8(std::u32string_view str)
+{
+    std::string result;
+    if (!UTF32toUTF8(str, result))
+        throwex ArgumentException("Invalid UTF-32 string!");
+    return result;
+}
+
+bool Encoding::UTF32toUTF8(std::u32string_view str, std::string& result)
+{
+    return Internals::UTF32ConvertUTF8(str.data(), str.size(), result);
+}
+
+std::u16string Encoding::UTF32toUTF16(std::u32string_view str)
+{
+    std::u16string result;
+    if (!UTF32toUTF16(str, result))
+        throwex ArgumentException("Invalid UTF-32 string!");
+    return result;
+}
+
+bool Encoding::UTF32toUTF16(std::u32string_view str, std::u16string& result)
+{
+    return Internals::UTF32ConvertUTF16(str.data(), str.size(), result);
+}
+
+bool Encoding::IsValidUTF8(std::string_view str) noexcept
+{
+    return Internals::UTF8Validate((const uint8_t*)str.data(), str.size());
+}
+
+bool Encoding::IsValidUTF16(std::u16string_view str) noexcept
+{
+    for (size_t i = 0; i < str.size(); ++i)
+    {
+        char16_t ch = str[i];
+        if ((ch & 0xF800) != 0xD800)
+            continue;
+        // Surrogate pair
+        if ((ch >= 0xDC00) || ((i + 1) >= str.size()) || ((str[i + 1] & 0xFC00) != 0xDC00))
+            return false;
+        ++i;
+    }
+    return true;
+}
+
+size_t Encoding::CountUTF8(std::string_view str) noexcept
+{
+    size_t leads = 0;
+    size_t leads4 = 0;
+    Internals::UTF8Count((const uint8_t*)str.data(), str.size(), leads, leads4);
+    return leads;
+}
+
+size_t Encoding::UTF16Length(std::string_view str) noexcept
+{
+    size_t leads = 0;
+    size_t leads4 = 0;
+    Internals::UTF8Count((const uint8_t*)str.data(), str.size(), leads, leads4);
+    return leads + leads4;
+}
+
+size_t Encoding::UTF8Length(std::u16string_view str) noexcept
+{
+    return Internals::UTF16LengthUTF8(str.data(), str.size());
+}
+
+size_t Encoding::UTF8Length(std::u32string_view str) noexcept
+{
+    return Internals::UTF32LengthUTF8(str.data(), str.size());
+}
+
+void Encoding::Base16Encode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+    size_t offset = result.size();
+    result.resize(offset + ilength * 2);
+
+    const uint8_t* src = (const uint8_t*)str.data();
+    char* dst = result.data() + offset;
+
+    size_t i = 0;
+#if defined(CPPCOMMON_ENCODING_X86)
+    if (CPU::HasAVX2())
+        i = Internals::Base16EncodeAVX2(src, ilength, dst);
+    else if (CPU::HasSSSE3())
+        i = Internals::Base16EncodeSSSE3(src, ilength, dst);
+#endif
+    Internals::Base16EncodeScalar(src + i, ilength - i, dst + i * 2);
+}
+
+std::string Encoding::Base16Encode(std::string_view str)
+{
+    std::string result;
+    Base16Encode(str, result);
+    return result;
+}
+
+bool Encoding::Base16Decode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+
+    if ((ilength % 2) != 0)
+        return false;
+
+    size_t olength = ilength / 2;
+    size_t offset = result.size();
+    result.resize(offset + olength);
+
+    const uint8_t* src = (const uint8_t*)str.data();
+    uint8_t* dst = (uint8_t*)result.data() + offset;
+
+    size_t j = 0;
+#if defined(CPPCOMMON_ENCODING_X86)
+    if (CPU::HasAVX2())
+        j = Internals::Base16DecodeAVX2(src, olength, dst);
+    else if (CPU::HasSSSE3())
+        j = Internals::Base16DecodeSSSE3(src, olength, dst);
+#endif
+    if (!Internals::Base16DecodeScalar(src + j * 2, olength - j, dst + j))
+    {
+        result.resize(offset);
+        return false;
+    }
+
+    return true;
+}
+
+std::string Encoding::Base16Decode(std::string_view str)
+{
+    std::string result;
+    Base16Decode(str, result);
+    return result;
+}
+
+void Encoding::Base32Encode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+    size_t olength = ((ilength / 5) * 8) + ((ilength % 5) ? 8 : 0);
+    size_t offset = result.size();
+    result.resize(offset + olength);
+
+    Internals::Base32EncodeScalar((const uint8_t*)str.data(), ilength, result.data() + offset);
+}
+
+std::string Encoding::Base32Encode(std::string_view str)
+{
+    std::string result;
+    Base32Encode(str, result);
+    return result;
+}
+
+bool Encoding::Base32Decode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+
+    if ((ilength % 8) != 0)
+        return false;
+
+    size_t offset = result.size();
+    result.resize(offset + (ilength / 8) * 5);
+
+    size_t olength = Internals::Base32DecodeScalar((const uint8_t*)str.data(), ilength, (uint8_t*)result.data() + offset);
+    if (olength == (size_t)-1)
+    {
+        result.resize(offset);
+        return false;
+    }
+
+    result.resize(offset + olength);
+    return true;
+}
+
+std::string Encoding::Base32Decode(std::string_view str)
+{
+    std::string result;
+    Base32Decode(str, result);
+    return result;
+}
+
+void Encoding::Base64Encode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+    size_t olength = 4 * ((ilength + 2) / 3);
+    size_t offset = result.size();
+    result.resize(offset + olength);
+
+    const uint8_t* src = (const uint8_t*)str.data();
+    char* dst = result.data() + offset;
+
+    size_t i = 0;
+#if defined(CPPCOMMON_ENCODING_X86)
+    if (CPU::HasAVX2())
+        i = Internals::Base64EncodeAVX2(src, ilength, dst);
+    else if (CPU::HasSSSE3())
+        i = Internals::Base64EncodeSSSE3(src, ilength, dst);
+#endif
+    Internals::Base64EncodeScalar(src + i, ilength - i, dst + (i / 3) * 4);
+}
+
+std::string Encoding::Base64Encode(std::string_view str)
+{
+    std::string result;
+    Base64Encode(str, result);
+    return result;
+}
+
+bool Encoding::Base64Decode(std::string_view str, std::string& result)
+{
+    size_t ilength = str.length();
+
+    if ((ilength % 4) != 0)
+        return false;
+    if (ilength == 0)
+        return true;
+
+    size_t olength = ilength / 4 * 3;
+
+    if (str[ilength - 1] == '=') olength--;
     if (str[ilength - 2] == '=') olength--;
 
+    size_t offset = result.size();
+    result.resize(offset + olength);
+
+    const uint8_t* src = (const uint8_t*)str.data();
+    uint8_t* dst = (uint8_t*)result.data() + offset;
+
+    size_t i = 0;
+#if defined(CPPCOMMON_ENCODING_X86)
+    if (CPU::HasAVX2())
+        i = Internals::Base64DecodeAVX2(src, ilength, dst, olength);
+    else if (CPU::HasSSSE3())
+        i = Internals::Base64DecodeSSSE3(src, ilength, dst, olength);
+#endif
+    if (!Internals::Base64DecodeScalar(src + i, ilength - i, dst + (i / 4) * 3))
+    {
+        result.resize(offset);
+        return false;
+    }
+
+    return true;
+}
+
+std::string Encoding::Base64Decode(std::string_view str)
+{
     std::string result;
-    result.resize(olength, 0);
+    Base64Decode(str, result);
+    return result;
+}
+
+void Base64Encoder::Encode(std::string_view chunk, std::string& result)
+{
+    // Complete the pending group
+    while ((_size > 0) && (_size < 3) && !chunk.empty())
+    {
+        _buffer[_size++] = chunk.front();
+        chunk.remove_prefix(1);
+    }
+    if (_size == 3)
+    {
+        Encoding::Base64Encode(std::string_view(_buffer, 3), result);
+        _size = 0;
+    }
+
+    // Encode all complete groups directly from the chunk
+    size_t size = (chunk.size() / 3) * 3;
+    Encoding::Base64Encode(chunk.substr(0, size), result);
+    chunk.remove_prefix(size);
+
+    // Keep the rest for the next chunk
+    for (char ch : chunk)
+        _buffer[_size++] = ch;
+}
+
+void Base64Encoder::Finish(std::string& result)
+{
+    Encoding::Base64Encode(std::string_view(_buffer, _size), result);
+    _size = 0;
+}
+
+bool Base64Decoder::Decode(std::string_view chunk, std::string& result)
+{
+    if (_failed)
+        return false;
 
-    for (size_t i = 0, j = 0; i < ilength;)
+    // Complete the pending group
+    while ((_size > 0) && (_size < 4) && !chunk.empty())
+    {
+        _buffer[_size++] = chunk.front();
+        chunk.remove_prefix(1);
+    }
+    if (_size == 4)
     {
-        uint32_t sextet_a = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_b = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_c = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
-        uint32_t sextet_d = str[i] == '=' ? 0 & i++ : base64[(uint8_t)str[i++]];
+        if (!DecodeGroups(std::string_view(_buffer, 4), result))
+            return false;
+        _size = 0;
+    }
+
+    // Decode all complete groups directly from the chunk
+    size_t size = (chunk.size() / 4) * 4;
+    if (!DecodeGroups(chunk.substr(0, size), result))
+        return false;
+    chunk.remove_prefix(size);
 
-        uint32_t triple = (sextet_a << 3 * 6) + (sextet_b << 2 * 6) + (sextet_c << 1 * 6) + (sextet_d << 0 * 6);
+    // Data after the padding is invalid
+    if (_padded && !chunk.empty())
+    {
+        _failed = true;
+        return false;
+    }
 
-        if (j < olength) result[j++] = (triple >> 2 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 1 * 8) & 0xFF;
-        if (j < olength) result[j++] = (triple >> 0 * 8) & 0xFF;
+    // Keep the rest for the next chunk
+    for (char ch : chunk)
+        _buffer[_size++] = ch;
 
+    return true;
+}
+
+bool Base64Decoder::DecodeGroups(std::string_view groups, std::string& result)
+{
+    if (groups.empty())
+        return true;
+
+    // Data after the padding is invalid
+    if (_padded || !Encoding::Base64Decode(groups, result))
+    {
+        _failed = true;
+        return false;
     }
 
+    _padded = (groups.back() == '=');
+    return true;
+}
+
+bool Base64Decoder::Finish()
+{
+    bool result = !_failed && (_size == 0);
+    Reset();
     return result;
 }
 
@@ -0,0 +1,261 @@
+/*!
+    \file multi_searcher.cpp
+    \brief Multiple substrings searcher implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/multi_searcher.h"
+
+#include "errors/exceptions.h"
+#include "string/format.h"
+
+#include <cstring>
+#include <deque>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_MULTI_SEARCHER_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Output flag of the transition
+const uint32_t MULTI_SEARCHER_OUTPUT = 0x80000000;
+// Missing transition of the trie
+const uint32_t MULTI_SEARCHER_MISSING = 0xFFFFFFFF;
+// Maximal count of start characters compared with SIMD instructions
+const size_t MULTI_SEARCHER_SIMD_STARTS = 8;
+
+inline uint8_t FoldCase(uint8_t ch)
+{
+    return ((ch >= 'A') && (ch <= 'Z')) ? (ch | 0x20) : ch;
+}
+
+} // namespace Internals
+//! @endcond
+
+MultiSearcher::MultiSearcher(const std::vector<std::string>& patterns, bool ignore_case)
+    : _patterns(patterns), _ignore_case(ignore_case), _alphabet(1), _classes()
+{
+    // Assign character classes to bytes used in patterns, all other bytes share the class 0
+    for (const auto& pattern : _patterns)
+    {
+        if (pattern.empty())
+            throwex ArgumentException("Empty pattern is not allowed!");
+
+        for (char ch : pattern)
+        {
+            uint8_t byte = _ignore_case ? Internals::FoldCase((uint8_t)ch) : (uint8_t)ch;
+            if (_classes[byte] == 0)
+            {
+                if (_alphabet > 255)
+                    break;
+                _classes[byte] = (uint8_t)_alphabet++;
+            }
+        }
+    }
+    if (_ignore_case)
+        for (int ch = 'A'; ch <= 'Z'; ++ch)
+            _classes[ch] = _classes[ch | 0x20];
+
+    // Build the trie of patterns
+    std::vector<uint32_t> transitions(_alphabet, Internals::MULTI_SEARCHER_MISSING);
+    std::vector<uint32_t> outputs(1, 0);
+    for (size_t i = 0; i < _patterns.size(); ++i)
+    {
+        uint32_t state = 0;
+        for (char ch : _patterns[i])
+        {
+            uint32_t& next = transitions[state * _alphabet + _classes[(uint8_t)ch]];
+            if (next == Internals::MULTI_SEARCHER_MISSING)
+            {
+                if ((transitions.size() + _alphabet) >= Internals::MULTI_SEARCHER_OUTPUT)
+                    throwex ArgumentException(format("Too many patterns to search: {}", _patterns.size()));
+
+                next = (uint32_t)outputs.size();
+                transitions.resize(transitions.size() + _alphabet, Internals::MULTI_SEARCHER_MISSING);
+                outputs.push_back(0);
+            }
+            state = transitions[state * _alphabet + _classes[(uint8_t)ch]];
+        }
+
+        // Keep the first one of duplicate patterns
+        if (outputs[state] == 0)
+            outputs[state] = (uint32_t)i + 1;
+    }
+
+    // Complete the trie into the automaton with breadth-first traversal of failure links
+    std::vector<uint32_t> failures(outputs.size(), 0);
+    std::deque<uint32_t> queue;
+    for (uint32_t c = 0; c < _alphabet; ++c)
+    {
+        uint32_t& next = transitions[c];
+        if (next == Internals::MULTI_SEARCHER_MISSING)
+            next = 0;
+        else
+            queue.push_back(next);
+    }
+    while (!queue.empty())
+    {
+        uint32_t state = queue.front();
+        queue.pop_front();
+
+        for (uint32_t c = 0; c < _alphabet; ++c)
+        {
+            uint32_t fallback = transitions[failures[state] * _alphabet + c];
+            uint32_t& next = transitions[state * _alphabet + c];
+            if (next == Internals::MULTI_SEARCHER_MISSING)
+                next = fallback;
+            else
+            {
+                failures[next] = fallback;
+                // The pattern of the state is longer than any pattern of its failure states
+                if (outputs[next] == 0)
+                    outputs[next] = outputs[fallback];
+                queue.push_back(next);
+            }
+        }
+    }
+
+    // Premultiply transitions by the alphabet size and mark output states
+    for (auto& next : transitions)
+        next = (next * _alphabet) | ((outputs[next] != 0) ? Internals::MULTI_SEARCHER_OUTPUT : 0);
+
+    _transitions.swap(transitions);
+    _outputs.swap(outputs);
+
+    // Collect start characters of patterns
+    _starts.clear();
+    for (int ch = 0; ch < 256; ++ch)
+        if ((_transitions[_classes[ch]] & ~Internals::MULTI_SEARCHER_OUTPUT) != 0)
+            _starts.push_back((char)ch);
+}
+
+bool MultiSearcher::Find(std::string_view str, Match& match, size_t position) const noexcept
+{
+    if (_transitions.empty())
+        return false;
+
+    const uint8_t* data = (const uint8_t*)str.data();
+    size_t size = str.size();
+
+#if defined(CPPCOMMON_MULTI_SEARCHER_SSE2)
+    // Broadcast start characters (the first one fills unused slots)
+    size_t count = _starts.size();
+    bool simd = (count <= Internals::MULTI_SEARCHER_SIMD_STARTS);
+    __m128i starts[Internals::MULTI_SEARCHER_SIMD_STARTS];
+    if (simd)
+        for (size_t i = 0; i < Internals::MULTI_SEARCHER_SIMD_STARTS; ++i)
+            starts[i] = _mm_set1_epi8(_starts[(i < count) ? i : 0]);
+#endif
+
+    uint32_t state = 0;
+    for (size_t i = position; i < size; ++i)
+    {
+#if defined(CPPCOMMON_MULTI_SEARCHER_SSE2)
+        // Skip characters which could not start any pattern
+        if (simd && (state == 0) && (_transitions[_classes[data[i]]] == 0))
+        {
+            for (++i; (i + 16) <= size; i += 16)
+            {
+                __m128i input = _mm_loadu_si128((const __m128i*)(data + i));
+                __m128i matches = _mm_cmpeq_epi8(input, starts[0]);
+                for (size_t j = 1; j < count; ++j)
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(input, starts[j]));
+                int mask = _mm_movemask_epi8(matches);
+                if (mask != 0)
+                {
+#if defined(_MSC_VER)
+                    unsigned long index;
+                    _BitScanForward(&index, (unsigned long)mask);
+                    i += index;
+#else
+                    i += __builtin_ctz((unsigned)mask);
+#endif
+                    break;
+                }
+            }
+            if (i >= size)
+                break;
+        }
+#endif
+
+        uint32_t next = _transitions[state + _classes[data[i]]];
+        state = next & ~Internals::MULTI_SEARCHER_OUTPUT;
+        if ((next & Internals::MULTI_SEARCHER_OUTPUT) != 0)
+        {
+            match.pattern = _outputs[state / _alphabet] - 1;
+            match.size = _patterns[match.pattern].size();
+            match.position = i + 1 - match.size;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<MultiSearcher::Match> MultiSearcher::FindAll(std::string_view str) const
+{
+    std::vector<Match> result;
+
+    Match match;
+    size_t position = 0;
+    while (Find(str, match, position))
+    {
+        result.push_back(match);
+        position = match.position + match.size;
+    }
+
+    return result;
+}
+
+size_t MultiSearcher::CountAll(std::string_view str) const noexcept
+{
+    size_t count = 0;
+
+    Match match;
+    size_t position = 0;
+    while (Find(str, match, position))
+    {
+        position = match.position + match.size;
+        ++count;
+    }
+
+    return count;
+}
+
+bool MultiSearcher::ReplaceAll(std::string& str, const std::vector<std::string>& with) const
+{
+    if (with.size() != _patterns.size())
+        throwex ArgumentException(format("Invalid count of substrings to replace: {} (expected {})", with.size(), _patterns.size()));
+
+    Match match;
+    if (!Find(str, match))
+        return false;
+
+    // Build the result string in one pass
+    std::string result;
+    result.reserve(str.size());
+
+    size_t last = 0;
+    do
+    {
+        result.append(str, last, match.position - last);
+        result.append(with[match.pattern]);
+        last = match.position + match.size;
+    } while (Find(str, match, last));
+    result.append(str, last, std::string::npos);
+
+    str.swap(result);
+    return true;
+}
+
+} // namespace CppCommon
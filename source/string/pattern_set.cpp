@@ -0,0 +1,799 @@
+/*!
+    \file pattern_set.cpp
+    \brief Compiled pattern set implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/pattern_set.h"
+
+#include "errors/exceptions.h"
+#include "string/format.h"
+#include "string/string_utils.h"
+
+#include <algorithm>
+#include <bitset>
+#include <cctype>
+#include <cstring>
+#include <map>
+#include <regex>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+namespace Internals {
+
+typedef std::bitset<256> ByteSet;
+
+// Maximal repetition count to expand in the DFA
+const int MAX_REPEAT = 64;
+// Maximal count of NFA states
+const size_t MAX_NFA_STATES = 16384;
+// Maximal count of DFA states
+const size_t MAX_DFA_STATES = 4096;
+
+// Regular expression syntax tree node
+struct RegexNode
+{
+    enum class Type { EMPTY, SET, CONCAT, ALT, REPEAT };
+
+    Type type;
+    ByteSet set;
+    std::vector<RegexNode> children;
+    int min;
+    int max;
+
+    explicit RegexNode(Type t = Type::EMPTY) : type(t), min(0), max(0) {}
+};
+
+// Recursive descent parser of the ECMAScript regular expressions subset which could be compiled into the DFA.
+// Any unsupported or invalid syntax makes the parser fail, so the pattern falls back to std::regex.
+class RegexParser
+{
+public:
+    explicit RegexParser(std::string_view pattern) : _pattern(pattern), _pos(0), _depth(0) {}
+
+    bool Parse(RegexNode& root)
+    {
+        // Leading anchor is a no-op for the whole string match
+        if (!_pattern.empty() && (_pattern[0] == '^'))
+        {
+            ++_pos;
+            if (IsQuantifier())
+                return false;
+        }
+        if (!ParseAlternation(root))
+            return false;
+        return (_pos == _pattern.size());
+    }
+
+private:
+    std::string_view _pattern;
+    size_t _pos;
+    int _depth;
+
+    bool End() const noexcept { return _pos >= _pattern.size(); }
+    char Peek() const noexcept { return _pattern[_pos]; }
+    bool IsQuantifier() const noexcept { return !End() && ((Peek() == '*') || (Peek() == '+') || (Peek() == '?') || (Peek() == '{')); }
+
+    static ByteSet Digits()
+    {
+        ByteSet set;
+        for (int c = '0'; c <= '9'; ++c)
+            set.set(c);
+        return set;
+    }
+
+    static ByteSet Words()
+    {
+        ByteSet set = Digits();
+        for (int c = 'a'; c <= 'z'; ++c)
+            set.set(c);
+        for (int c = 'A'; c <= 'Z'; ++c)
+            set.set(c);
+        set.set('_');
+        return set;
+    }
+
+    static ByteSet Spaces()
+    {
+        ByteSet set;
+        for (char c : { ' ', '\t', '\n', '\v', '\f', '\r' })
+            set.set((uint8_t)c);
+        return set;
+    }
+
+    bool ParseAlternation(RegexNode& node)
+    {
+        RegexNode branch;
+        if (!ParseConcatenation(branch))
+            return false;
+        if (End() || (Peek() != '|'))
+        {
+            node = std::move(branch);
+            return true;
+        }
+
+        node = RegexNode(RegexNode::Type::ALT);
+        node.children.emplace_back(std::move(branch));
+        while (!End() && (Peek() == '|'))
+        {
+            ++_pos;
+            if (!ParseConcatenation(branch))
+                return false;
+            node.children.emplace_back(std::move(branch));
+        }
+        return true;
+    }
+
+    bool ParseConcatenation(RegexNode& node)
+    {
+        node = RegexNode(RegexNode::Type::CONCAT);
+        while (!End() && (Peek() != '|') && (Peek() != ')'))
+        {
+            RegexNode item;
+            if (!ParseRepetition(item))
+                return false;
+            node.children.emplace_back(std::move(item));
+        }
+        return true;
+    }
+
+    bool ParseRepetition(RegexNode& node)
+    {
+        bool assertion = false;
+        if (!ParseAtom(node, assertion))
+            return false;
+        if (!IsQuantifier())
+            return true;
+        if (assertion)
+            return false;
+
+        int min = 0;
+        int max = -1;
+        switch (_pattern[_pos++])
+        {
+            case '*':
+                break;
+            case '+':
+                min = 1;
+                break;
+            case '?':
+                max = 1;
+                break;
+            case '{':
+                if (!ParseCount(min) || End())
+                    return false;
+                max = min;
+                if (Peek() == ',')
+                {
+                    ++_pos;
+                    max = -1;
+                    if (!End() && std::isdigit((uint8_t)Peek()) && !ParseCount(max))
+                        return false;
+                }
+                if (End() || (Peek() != '}'))
+                    return false;
+                ++_pos;
+                if (((max >= 0) && (max < min)) || (min > MAX_REPEAT) || (max > MAX_REPEAT))
+                    return false;
+                break;
+        }
+
+        // Lazy quantifier does not change the whole string match result
+        if (!End() && (Peek() == '?'))
+            ++_pos;
+
+        // Double quantifiers are not allowed
+        if (IsQuantifier())
+            return false;
+
+        RegexNode repeat(RegexNode::Type::REPEAT);
+        repeat.min = min;
+        repeat.max = max;
+        repeat.children.emplace_back(std::move(node));
+        node = std::move(repeat);
+        return true;
+    }
+
+    bool ParseCount(int& count)
+    {
+        size_t start = _pos;
+        count = 0;
+        while (!End() && std::isdigit((uint8_t)Peek()) && (count <= MAX_REPEAT))
+            count = count * 10 + (_pattern[_pos++] - '0');
+        return (_pos > start) && (count <= MAX_REPEAT);
+    }
+
+    bool ParseAtom(RegexNode& node, bool& assertion)
+    {
+        char ch = _pattern[_pos++];
+        switch (ch)
+        {
+            case '(':
+            {
+                if (!End() && (Peek() == '?'))
+                {
+                    // Only non-capturing groups are supported
+                    if (((_pos + 1) >= _pattern.size()) || (_pattern[_pos + 1] != ':'))
+                        return false;
+                    _pos += 2;
+                }
+                ++_depth;
+                if (!ParseAlternation(node))
+                    return false;
+                --_depth;
+                if (End() || (Peek() != ')'))
+                    return false;
+                ++_pos;
+                return true;
+            }
+            case '$':
+                // Trailing anchor is a no-op for the whole string match
+                if (!End() || (_depth > 0))
+                    return false;
+                node = RegexNode(RegexNode::Type::EMPTY);
+                assertion = true;
+                return true;
+            case '.':
+                node = RegexNode(RegexNode::Type::SET);
+                node.set.set();
+                node.set.reset('\n');
+                node.set.reset('\r');
+                return true;
+            case '[':
+                node = RegexNode(RegexNode::Type::SET);
+                return ParseClass(node.set);
+            case '\\':
+            {
+                bool single;
+                node = RegexNode(RegexNode::Type::SET);
+                return ParseEscape(node.set, single);
+            }
+            case '^': case ')': case ']': case '{': case '}': case '*': case '+': case '?': case '|':
+                return false;
+            default:
+                node = RegexNode(RegexNode::Type::SET);
+                node.set.set((uint8_t)ch);
+                return true;
+        }
+    }
+
+    bool ParseEscape(ByteSet& set, bool& single)
+    {
+        if (End())
+            return false;
+
+        single = false;
+        char ch = _pattern[_pos++];
+        switch (ch)
+        {
+            case 'd': set |= Digits(); return true;
+            case 'D': set |= ~Digits(); return true;
+            case 'w': set |= Words(); return true;
+            case 'W': set |= ~Words(); return true;
+            case 's': set |= Spaces(); return true;
+            case 'S': set |= ~Spaces(); return true;
+            default:
+                break;
+        }
+
+        single = true;
+        switch (ch)
+        {
+            case 't': set.set('\t'); return true;
+            case 'n': set.set('\n'); return true;
+            case 'r': set.set('\r'); return true;
+            case 'f': set.set('\f'); return true;
+            case 'v': set.set('\v'); return true;
+            case '0':
+                if (!End() && std::isdigit((uint8_t)Peek()))
+                    return false;
+                set.set(0);
+                return true;
+            default:
+                // Back-references, word boundaries, hex & control escapes are not supported
+                if (std::isalnum((uint8_t)ch))
+                    return false;
+                set.set((uint8_t)ch);
+                return true;
+        }
+    }
+
+    bool ParseClassItem(ByteSet& set, int& single)
+    {
+        char ch = _pattern[_pos++];
+        if (ch == '\\')
+        {
+            bool is_single;
+            ByteSet item;
+            if (!ParseEscape(item, is_single))
+                return false;
+            set |= item;
+            single = -1;
+            if (is_single)
+                for (int c = 0; c < 256; ++c)
+                    if (item.test(c))
+                        single = c;
+            return true;
+        }
+
+        // POSIX character classes, collating elements and equivalence classes are not supported
+        if ((ch == '[') && !End() && ((Peek() == ':') || (Peek() == '.') || (Peek() == '=')))
+            return false;
+
+        single = (uint8_t)ch;
+        set.set((uint8_t)ch);
+        return true;
+    }
+
+    bool ParseClass(ByteSet& set)
+    {
+        bool negative = false;
+        if (!End() && (Peek() == '^'))
+        {
+            negative = true;
+            ++_pos;
+        }
+
+        // Empty class is not supported
+        if (End() || (Peek() == ']'))
+            return false;
+
+        ByteSet result;
+        while (!End() && (Peek() != ']'))
+        {
+            int first;
+            ByteSet item;
+            if (!ParseClassItem(item, first))
+                return false;
+
+            // Character range
+            if (((_pos + 1) < _pattern.size()) && (Peek() == '-') && (_pattern[_pos + 1] != ']'))
+            {
+                ++_pos;
+                int last;
+                ByteSet dummy;
+                if (!ParseClassItem(dummy, last))
+                    return false;
+                if ((first < 0) || (last < 0) || (first > last))
+                    return false;
+                for (int c = first; c <= last; ++c)
+                    result.set(c);
+            }
+            else
+                result |= item;
+        }
+        if (End())
+            return false;
+        ++_pos;
+
+        set = negative ? ~result : result;
+        return true;
+    }
+};
+
+// Thompson NFA
+class RegexNFA
+{
+public:
+    struct State
+    {
+        int set;                    // Byte set index or -1 for epsilon state
+        int next;                   // Next state for the byte set state
+        std::vector<int> epsilon;   // Epsilon transitions
+    };
+
+    std::vector<State> states;
+    std::vector<ByteSet> sets;
+    int start;
+    int accept;
+
+    bool Build(const RegexNode& root)
+    {
+        int first, last;
+        if (!Compile(root, first, last))
+            return false;
+        start = first;
+        accept = last;
+        return true;
+    }
+
+private:
+    int AddState()
+    {
+        states.push_back({ -1, -1, {} });
+        return (int)states.size() - 1;
+    }
+
+    bool Compile(const RegexNode& node, int& first, int& last)
+    {
+        if (states.size() > MAX_NFA_STATES)
+            return false;
+
+        switch (node.type)
+        {
+            case RegexNode::Type::EMPTY:
+                first = last = AddState();
+                return true;
+            case RegexNode::Type::SET:
+                first = AddState();
+                last = AddState();
+                sets.push_back(node.set);
+                states[first].set = (int)sets.size() - 1;
+                states[first].next = last;
+                return true;
+            case RegexNode::Type::CONCAT:
+            {
+                first = last = AddState();
+                for (const auto& child : node.children)
+                {
+                    int child_first, child_last;
+                    if (!Compile(child, child_first, child_last))
+                        return false;
+                    states[last].epsilon.push_back(child_first);
+                    last = child_last;
+                }
+                return true;
+            }
+            case RegexNode::Type::ALT:
+            {
+                first = AddState();
+                last = AddState();
+                for (const auto& child : node.children)
+                {
+                    int child_first, child_last;
+                    if (!Compile(child, child_first, child_last))
+                        return false;
+                    states[first].epsilon.push_back(child_first);
+                    states[child_last].epsilon.push_back(last);
+                }
+                return true;
+            }
+            case RegexNode::Type::REPEAT:
+            {
+                const RegexNode& child = node.children.front();
+                first = last = AddState();
+
+                // Mandatory repetitions
+                for (int i = 0; i < node.min; ++i)
+                {
+                    int child_first, child_last;
+                    if (!Compile(child, child_first, child_last))
+                        return false;
+                    states[last].epsilon.push_back(child_first);
+                    last = child_last;
+                }
+
+                if (node.max < 0)
+                {
+                    // Kleene star
+                    int child_first, child_last;
+                    if (!Compile(child, child_first, child_last))
+                        return false;
+                    int loop = AddState();
+                    states[last].epsilon.push_back(loop);
+                    states[loop].epsilon.push_back(child_first);
+                    states[child_last].epsilon.push_back(loop);
+                    last = AddState();
+                    states[loop].epsilon.push_back(last);
+                }
+                else if (node.max > node.min)
+                {
+                    // Optional repetitions
+                    int end = AddState();
+                    for (int i = node.min; i < node.max; ++i)
+                    {
+                        int child_first, child_last;
+                        if (!Compile(child, child_first, child_last))
+                            return false;
+                        states[last].epsilon.push_back(child_first);
+                        states[last].epsilon.push_back(end);
+                        last = child_last;
+                    }
+                    states[last].epsilon.push_back(end);
+                    last = end;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+// DFA built from the NFA with the subset construction over byte equivalence classes
+struct RegexDFA
+{
+    uint8_t classes[256];
+    size_t count;
+    std::vector<int32_t> transitions;
+    std::vector<uint8_t> accepting;
+    int32_t start;
+
+    bool Build(const RegexNFA& nfa)
+    {
+        // Split bytes into equivalence classes by the byte sets which contain them
+        std::map<std::vector<bool>, uint8_t> signatures;
+        std::vector<uint8_t> representatives;
+        for (int c = 0; c < 256; ++c)
+        {
+            std::vector<bool> signature(nfa.sets.size());
+            for (size_t i = 0; i < nfa.sets.size(); ++i)
+                signature[i] = nfa.sets[i].test(c);
+            auto it = signatures.find(signature);
+            if (it == signatures.end())
+            {
+                it = signatures.emplace(signature, (uint8_t)representatives.size()).first;
+                representatives.push_back((uint8_t)c);
+            }
+            classes[c] = it->second;
+        }
+        count = representatives.size();
+
+        std::map<std::vector<int>, int32_t> indexes;
+        std::vector<std::vector<int>> subsets;
+
+        auto add = [&](std::vector<int>&& subset) -> int32_t
+        {
+            auto it = indexes.find(subset);
+            if (it != indexes.end())
+                return it->second;
+            int32_t index = (int32_t)subsets.size();
+            bool accept = std::find(subset.begin(), subset.end(), nfa.accept) != subset.end();
+            indexes.emplace(subset, index);
+            subsets.emplace_back(std::move(subset));
+            transitions.resize(subsets.size() * count, 0);
+            accepting.push_back(accept ? 1 : 0);
+            return index;
+        };
+
+        // Dead state has index 0
+        add(std::vector<int>());
+        start = add(Closure(nfa, { nfa.start }));
+
+        for (size_t index = 1; index < subsets.size(); ++index)
+        {
+            if (subsets.size() > MAX_DFA_STATES)
+                return false;
+
+            for (size_t cls = 0; cls < count; ++cls)
+            {
+                std::vector<int> targets;
+                for (int state : subsets[index])
+                {
+                    const auto& current = nfa.states[state];
+                    if ((current.set >= 0) && nfa.sets[current.set].test(representatives[cls]))
+                        targets.push_back(current.next);
+                }
+                int32_t next = targets.empty() ? 0 : add(Closure(nfa, targets));
+                transitions[index * count + cls] = next;
+            }
+        }
+        return true;
+    }
+
+    bool Match(std::string_view str) const noexcept
+    {
+        const int32_t* table = transitions.data();
+        int32_t state = start;
+        for (char ch : str)
+        {
+            state = table[state * count + classes[(uint8_t)ch]];
+            if (state == 0)
+                return false;
+        }
+        return accepting[state] != 0;
+    }
+
+    // Epsilon closure which keeps only byte set states and the accept state
+    static std::vector<int> Closure(const RegexNFA& nfa, const std::vector<int>& states)
+    {
+        std::vector<int> result;
+        std::vector<bool> visited(nfa.states.size(), false);
+        std::vector<int> stack(states);
+        while (!stack.empty())
+        {
+            int state = stack.back();
+            stack.pop_back();
+            if (visited[state])
+                continue;
+            visited[state] = true;
+
+            const auto& current = nfa.states[state];
+            if ((current.set >= 0) || (state == nfa.accept))
+                result.push_back(state);
+            for (int next : current.epsilon)
+                if (!visited[next])
+                    stack.push_back(next);
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+// Split the pattern into literal segments separated with ".*" wildcards
+bool ParseGlob(std::string_view pattern, std::vector<std::string>& segments)
+{
+    std::string current;
+    size_t pos = 0;
+
+    // Leading anchor is a no-op for the whole string match
+    if (!pattern.empty() && (pattern[0] == '^'))
+        ++pos;
+
+    while (pos < pattern.size())
+    {
+        char ch = pattern[pos];
+        if ((ch == '.') && ((pos + 1) < pattern.size()) && (pattern[pos + 1] == '*'))
+        {
+            segments.emplace_back(std::move(current));
+            current.clear();
+            pos += 2;
+            // Lazy wildcard does not change the whole string match result
+            if ((pos < pattern.size()) && (pattern[pos] == '?'))
+                ++pos;
+            continue;
+        }
+        if (ch == '\\')
+        {
+            if (((pos + 1) >= pattern.size()) || std::isalnum((uint8_t)pattern[pos + 1]) || (pattern[pos + 1] == '\r') || (pattern[pos + 1] == '\n'))
+                return false;
+            current.push_back(pattern[pos + 1]);
+            pos += 2;
+            continue;
+        }
+        if ((ch == '$') && ((pos + 1) == pattern.size()))
+            break;
+        if (std::strchr("^$.|?*+()[]{}\r\n", ch) != nullptr)
+            return false;
+        current.push_back(ch);
+        ++pos;
+    }
+    segments.emplace_back(std::move(current));
+    return true;
+}
+
+} // namespace Internals
+
+struct PatternSet::Pattern
+{
+    enum class Kind { INVALID, GLOB, DFA, REGEX };
+
+    Kind kind;
+    bool negative;
+    std::vector<std::string> segments;
+    Internals::RegexDFA dfa;
+    std::regex regex;
+
+    Pattern(const std::string& pattern, bool is_negative) : kind(Kind::INVALID), negative(is_negative)
+    {
+        // Try glob matcher
+        if (Internals::ParseGlob(pattern, segments))
+        {
+            kind = Kind::GLOB;
+            return;
+        }
+        segments.clear();
+
+        // Try DFA matcher
+        Internals::RegexNode root;
+        Internals::RegexParser parser(pattern);
+        if (parser.Parse(root))
+        {
+            Internals::RegexNFA nfa;
+            if (nfa.Build(root) && dfa.Build(nfa))
+            {
+                kind = Kind::DFA;
+                return;
+            }
+        }
+        dfa = Internals::RegexDFA();
+
+        // Fall back to std::regex
+        try
+        {
+            regex = std::regex(pattern);
+            kind = Kind::REGEX;
+        }
+        catch (const std::regex_error&) {}
+    }
+
+    bool Match(std::string_view str) const
+    {
+        switch (kind)
+        {
+            case Kind::GLOB:
+                return MatchGlob(str);
+            case Kind::DFA:
+                return dfa.Match(str);
+            case Kind::REGEX:
+                try
+                {
+                    return std::regex_match(str.begin(), str.end(), regex);
+                }
+                catch (const std::regex_error&) {}
+                return false;
+            default:
+                return false;
+        }
+    }
+
+    bool MatchGlob(std::string_view str) const noexcept
+    {
+        // Exact literal
+        if (segments.size() == 1)
+            return (str == segments.front());
+
+        // Wildcard does not match line terminators, literals never contain them
+        if ((std::memchr(str.data(), '\n', str.size()) != nullptr) || (std::memchr(str.data(), '\r', str.size()) != nullptr))
+            return false;
+
+        const std::string& prefix = segments.front();
+        const std::string& suffix = segments.back();
+        if (str.size() < (prefix.size() + suffix.size()))
+            return false;
+        if (str.compare(0, prefix.size(), prefix) != 0)
+            return false;
+        if (str.compare(str.size() - suffix.size(), suffix.size(), suffix) != 0)
+            return false;
+
+        // Leftmost search of the middle segments is enough for wildcards
+        std::string_view middle = str.substr(0, str.size() - suffix.size());
+        size_t pos = prefix.size();
+        for (size_t i = 1; i < (segments.size() - 1); ++i)
+        {
+            size_t found = middle.find(segments[i], pos);
+            if (found == std::string_view::npos)
+                return false;
+            pos = found + segments[i].size();
+        }
+        return true;
+    }
+};
+
+//! @endcond
+
+PatternSet::PatternSet(const std::string& patterns)
+{
+    auto keys = StringUtils::Split(patterns, ';');
+    _patterns.reserve(keys.size());
+    for (const std::string& key : keys)
+    {
+        bool negative = StringUtils::StartsWith(key, "!");
+        _patterns.push_back(std::make_shared<const Pattern>(negative ? key.substr(1) : key, negative));
+    }
+}
+
+void PatternSet::Add(const std::string& pattern, bool negative)
+{
+    auto compiled = std::make_shared<const Pattern>(pattern, negative);
+    if (compiled->kind == Pattern::Kind::INVALID)
+        throwex ArgumentException(format("Invalid regular expression pattern: {}", pattern));
+    _patterns.emplace_back(std::move(compiled));
+}
+
+bool PatternSet::Match(std::string_view str) const
+{
+    bool result = false;
+    for (const auto& pattern : _patterns)
+    {
+        if (pattern->Match(str))
+            return !pattern->negative;
+
+        // Last negative pattern should success result
+        result = pattern->negative;
+    }
+    return result;
+}
+
+PatternSet PatternSet::FromRegex(const std::string& pattern)
+{
+    PatternSet result;
+    if (!pattern.empty())
+        result.Add(pattern);
+    return result;
+}
+
+} // namespace CppCommon
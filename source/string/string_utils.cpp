@@ -8,11 +8,218 @@
 
 #include "string/string_utils.h"
 
+#include "system/cpu.h"
+
 #include <cassert>
-#include <regex>
+#include <cstring>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+#define CPPCOMMON_STRING_X86
+#include <immintrin.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_STRING_SSE2
+#endif
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CPPCOMMON_STRING_TARGET(isa)
+#else
+#define CPPCOMMON_STRING_TARGET(isa) __attribute__((target(isa)))
+#endif
 
 namespace CppCommon {
 
+//! @cond INTERNALS
+namespace Internals {
+
+inline size_t CountTrailingZeros(uint32_t mask)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return index;
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+size_t FindScalar(const char* data, size_t size, const char* substr, size_t length, size_t position)
+{
+    return std::string_view(data, size).find(std::string_view(substr, length), position);
+}
+
+// Substring search is based on the SIMD-friendly algorithm by Wojciech Mula:
+// candidate positions where both the first and the last substring characters
+// match are found for the whole block at once and then verified with memcmp().
+// http://0x80.pl/articles/simd-strfind.html
+
+#if defined(CPPCOMMON_STRING_SSE2)
+
+size_t FindSSE2(const char* data, size_t size, const char* substr, size_t length, size_t position)
+{
+    const __m128i first = _mm_set1_epi8(substr[0]);
+    const __m128i last = _mm_set1_epi8(substr[length - 1]);
+
+    for (; (position + length - 1 + 16) <= size; position += 16)
+    {
+        const __m128i block_first = _mm_loadu_si128((const __m128i*)(data + position));
+        const __m128i block_last = _mm_loadu_si128((const __m128i*)(data + position + length - 1));
+        uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            size_t index = position + CountTrailingZeros(mask);
+            if (std::memcmp(data + index + 1, substr + 1, length - 2) == 0)
+                return index;
+            mask &= mask - 1;
+        }
+    }
+
+    return FindScalar(data, size, substr, length, position);
+}
+
+#endif
+
+#if defined(CPPCOMMON_STRING_X86)
+
+CPPCOMMON_STRING_TARGET("avx2")
+size_t FindAVX2(const char* data, size_t size, const char* substr, size_t length, size_t position)
+{
+    const __m256i first = _mm256_set1_epi8(substr[0]);
+    const __m256i last = _mm256_set1_epi8(substr[length - 1]);
+
+    for (; (position + length - 1 + 32) <= size; position += 32)
+    {
+        const __m256i block_first = _mm256_loadu_si256((const __m256i*)(data + position));
+        const __m256i block_last = _mm256_loadu_si256((const __m256i*)(data + position + length - 1));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last)));
+        while (mask != 0)
+        {
+            size_t index = position + CountTrailingZeros(mask);
+            if (std::memcmp(data + index + 1, substr + 1, length - 2) == 0)
+                return index;
+            mask &= mask - 1;
+        }
+    }
+
+    return FindScalar(data, size, substr, length, position);
+}
+
+#endif
+
+size_t Find(const char* data, size_t size, const char* substr, size_t length, size_t position)
+{
+    if (length == 0)
+        return (position <= size) ? position : std::string::npos;
+    if ((position >= size) || (length > (size - position)))
+        return std::string::npos;
+
+    // Single character is searched with vectorized memchr()
+    if (length == 1)
+    {
+        const void* found = std::memchr(data + position, substr[0], size - position);
+        return (found != nullptr) ? ((const char*)found - data) : std::string::npos;
+    }
+
+#if defined(CPPCOMMON_STRING_X86)
+    if (CPU::HasAVX2())
+        return FindAVX2(data, size, substr, length, position);
+#endif
+#if defined(CPPCOMMON_STRING_SSE2)
+    return FindSSE2(data, size, substr, length, position);
+#else
+    return FindScalar(data, size, substr, length, position);
+#endif
+}
+
+// ASCII case conversion flips 0x20 bit of characters in the range [from, to].
+// Characters with high bit set are negative in signed comparison and never match.
+
+#if defined(CPPCOMMON_STRING_SSE2)
+
+inline __m128i ConvertCaseSSE2(__m128i input, __m128i from, __m128i to)
+{
+    const __m128i range = _mm_and_si128(_mm_cmpgt_epi8(input, from), _mm_cmplt_epi8(input, to));
+    return _mm_xor_si128(input, _mm_and_si128(range, _mm_set1_epi8(0x20)));
+}
+
+#endif
+
+#if defined(CPPCOMMON_STRING_X86)
+
+CPPCOMMON_STRING_TARGET("avx2")
+void ConvertCaseAVX2(char* data, size_t size, char from, char to)
+{
+    const __m256i lower = _mm256_set1_epi8((char)(from - 1));
+    const __m256i upper = _mm256_set1_epi8((char)(to + 1));
+    const __m256i flip = _mm256_set1_epi8(0x20);
+
+    size_t i = 0;
+    for (; (i + 32) <= size; i += 32)
+    {
+        __m256i input = _mm256_loadu_si256((const __m256i*)(data + i));
+        __m256i range = _mm256_and_si256(_mm256_cmpgt_epi8(input, lower), _mm256_cmpgt_epi8(upper, input));
+        _mm256_storeu_si256((__m256i*)(data + i), _mm256_xor_si256(input, _mm256_and_si256(range, flip)));
+    }
+
+    for (; i < size; ++i)
+        if ((data[i] >= from) && (data[i] <= to))
+            data[i] ^= 0x20;
+}
+
+#endif
+
+void ConvertCase(char* data, size_t size, char from, char to)
+{
+#if defined(CPPCOMMON_STRING_X86)
+    if ((size >= 32) && CPU::HasAVX2())
+    {
+        ConvertCaseAVX2(data, size, from, to);
+        return;
+    }
+#endif
+
+    size_t i = 0;
+
+#if defined(CPPCOMMON_STRING_SSE2)
+    const __m128i lower = _mm_set1_epi8((char)(from - 1));
+    const __m128i upper = _mm_set1_epi8((char)(to + 1));
+    for (; (i + 16) <= size; i += 16)
+        _mm_storeu_si128((__m128i*)(data + i), ConvertCaseSSE2(_mm_loadu_si128((const __m128i*)(data + i)), lower, upper));
+#endif
+
+    for (; i < size; ++i)
+        if ((data[i] >= from) && (data[i] <= to))
+            data[i] ^= 0x20;
+}
+
+bool CompareNoCase(const char* data1, const char* data2, size_t size)
+{
+    size_t i = 0;
+
+#if defined(CPPCOMMON_STRING_SSE2)
+    // Compare both strings converted to lower case
+    const __m128i lower = _mm_set1_epi8('A' - 1);
+    const __m128i upper = _mm_set1_epi8('Z' + 1);
+    for (; (i + 16) <= size; i += 16)
+    {
+        __m128i input1 = ConvertCaseSSE2(_mm_loadu_si128((const __m128i*)(data1 + i)), lower, upper);
+        __m128i input2 = ConvertCaseSSE2(_mm_loadu_si128((const __m128i*)(data2 + i)), lower, upper);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(input1, input2)) != 0xFFFF)
+            return false;
+    }
+#endif
+
+    for (; i < size; ++i)
+        if (StringUtils::ToLower(data1[i]) != StringUtils::ToLower(data2[i]))
+            return false;
+
+    return true;
+}
+
+} // namespace Internals
+//! @endcond
+
 bool StringUtils::IsBlank(const char* str)
 {
     for (size_t i = 0; str[i] != 0; ++i)
@@ -36,27 +243,7 @@ bool StringUtils::IsBlank(std::string_view str)
 
 bool StringUtils::IsPatternMatch(const std::string& patterns, const std::string& str)
 {
-    bool result = false;
-    auto keys = Split(patterns, ';');
-    for (const std::string& key : keys)
-    {
-        bool negative = StartsWith(key, "!");
-        std::string pattern = negative ? key.substr(1) : key;
-
-        // Try to match regex pattern
-        try
-        {
-            std::regex expression(pattern);
-            bool matched = std::regex_match(str, expression);
-            if (matched)
-                return !negative;
-        }
-        catch (const std::regex_error&) {}
-
-        // Last negative pattern should success result
-        result = negative;
-    }
-    return result;
+    return PatternSet(patterns).Match(str);
 }
 
 std::string StringUtils::ToLTrim(std::string_view str)
@@ -94,19 +281,39 @@ bool StringUtils::Compare(std::string_view str1, std::string_view str2)
     return (str1 == str2);
 }
 
+std::string& StringUtils::Lower(std::string& str)
+{
+    Internals::ConvertCase(str.data(), str.size(), 'A', 'Z');
+    return str;
+}
+
+std::string& StringUtils::Upper(std::string& str)
+{
+    Internals::ConvertCase(str.data(), str.size(), 'a', 'z');
+    return str;
+}
+
 bool StringUtils::CompareNoCase(std::string_view str1, std::string_view str2)
 {
     if (str1.size() != str2.size())
         return false;
-    return std::equal(str1.cbegin(), str1.cend(), str2.cbegin(), [](std::string::value_type l, std::string::value_type r) { return std::tolower(l) == std::tolower(r); });
+    return Internals::CompareNoCase(str1.data(), str2.data(), str1.size());
+}
+
+size_t StringUtils::Find(std::string_view str, std::string_view substr, size_t position)
+{
+    return Internals::Find(str.data(), str.size(), substr.data(), substr.size(), position);
 }
 
 size_t StringUtils::CountAll(std::string_view str, std::string_view substr)
 {
-    size_t count=0;
+    if (substr.empty())
+        return 0;
+
+    size_t count = 0;
 
     size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    while ((pos = Find(str, substr, pos)) != std::string::npos)
     {
         pos += substr.size();
         ++count;
@@ -117,7 +324,7 @@ size_t StringUtils::CountAll(std::string_view str, std::string_view substr)
 
 bool StringUtils::ReplaceFirst(std::string& str, std::string_view substr, std::string_view with)
 {
-    size_t pos = str.find(substr);
+    size_t pos = Find(str, substr);
     if (pos == std::string::npos)
         return false;
 
@@ -137,163 +344,108 @@ bool StringUtils::ReplaceLast(std::string& str, std::string_view substr, std::st
 
 bool StringUtils::ReplaceAll(std::string& str, std::string_view substr, std::string_view with)
 {
-    bool result = false;
+    if (substr.empty())
+        return false;
 
-    size_t pos = 0;
-    while ((pos = str.find(substr, pos)) != std::string::npos)
+    size_t pos = Find(str, substr);
+    if (pos == std::string::npos)
+        return false;
+
+    // Replace substrings of the same size in place
+    if (substr.size() == with.size())
     {
-        str.replace(pos, substr.size(), with);
-        pos += with.size();
-        result = true;
+        do
+        {
+            std::memmove(str.data() + pos, with.data(), with.size());
+            pos = Find(str, substr, pos + substr.size());
+        } while (pos != std::string::npos);
+        return true;
     }
 
-    return result;
+    // Build the result string in one pass to avoid moving the string tail on each replacement
+    std::string result;
+    result.reserve(str.size());
+
+    size_t last = 0;
+    do
+    {
+        result.append(str, last, pos - last);
+        result.append(with);
+        last = pos + substr.size();
+        pos = Find(str, substr, last);
+    } while (pos != std::string::npos);
+    result.append(str, last, std::string::npos);
+
+    str.swap(result);
+    return true;
 }
 
 std::vector<std::string> StringUtils::Split(std::string_view str, char delimiter, bool skip_empty)
 {
     std::vector<std::string> tokens;
-
-    size_t pos_current;
-    size_t pos_last = 0;
-    size_t length;
-
-    while (true)
-    {
-        pos_current = str.find(delimiter, pos_last);
-        if (pos_current == std::string::npos)
-            pos_current = str.size();
-
-        length = pos_current - pos_last;
-        if (!skip_empty || (length != 0))
-            tokens.emplace_back(str.substr(pos_last, length));
-
-        if (pos_current == str.size())
-            break;
-        else
-            pos_last = pos_current + 1;
-    }
-
+    for (auto token : StringTokenizer(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
     return tokens;
 }
 
 std::vector<std::string> StringUtils::Split(std::string_view str, std::string_view delimiter, bool skip_empty)
 {
     std::vector<std::string> tokens;
-
-    size_t pos_current;
-    size_t pos_last = 0;
-    size_t length;
-
-    while (true)
-    {
-        pos_current = str.find(delimiter, pos_last);
-        if (pos_current == std::string::npos)
-            pos_current = str.size();
-
-        length = pos_current - pos_last;
-        if (!skip_empty || (length != 0))
-            tokens.emplace_back(str.substr(pos_last, length));
-
-        if (pos_current == str.size())
-            break;
-        else
-            pos_last = pos_current + delimiter.size();
-    }
-
+    for (auto token : StringTokenizer(str, delimiter, skip_empty))
+        tokens.emplace_back(token);
     return tokens;
 }
 
 std::vector<std::string> StringUtils::SplitByAny(std::string_view str, std::string_view delimiters, bool skip_empty)
 {
     std::vector<std::string> tokens;
-
-    size_t pos_current;
-    size_t pos_last = 0;
-    size_t length;
-
-    while (true)
-    {
-        pos_current = str.find_first_of(delimiters, pos_last);
-        if (pos_current == std::string::npos)
-            pos_current = str.size();
-
-        length = pos_current - pos_last;
-        if (!skip_empty || (length != 0))
-            tokens.emplace_back(str.substr(pos_last, length));
-
-        if (pos_current == str.size())
-            break;
-        else
-            pos_last = pos_current + 1;
-    }
-
+    for (auto token : StringTokenizer::ByAny(str, delimiters, skip_empty))
+        tokens.emplace_back(token);
     return tokens;
 }
 
-std::string StringUtils::Join(const std::vector<std::string>& tokens, bool skip_empty, bool skip_blank)
+//! @cond INTERNALS
+namespace Internals {
+
+std::string Join(const std::vector<std::string>& tokens, std::string_view delimiter, bool skip_empty, bool skip_blank)
 {
     if (tokens.empty())
         return "";
 
-    std::ostringstream result;
+    // Calculate the result size to allocate it only once
+    size_t size = 0;
+    for (const auto& token : tokens)
+        size += token.size() + delimiter.size();
 
-    for (size_t i = 0; i < tokens.size(); ++i)
-        if (!((skip_empty && tokens[i].empty()) || (skip_blank && IsBlank(tokens[i]))))
-            result << tokens[i];
+    std::string result;
+    result.reserve(size);
 
-    return result.str();
+    // Delimiter is placed only between joined tokens
+    StringUtils::Join(result, tokens, delimiter, skip_empty, skip_blank);
+    return result;
 }
 
-std::string StringUtils::Join(const std::vector<std::string>& tokens, char delimiter, bool skip_empty, bool skip_blank)
-{
-    if (tokens.empty())
-        return "";
-
-    std::ostringstream result;
+} // namespace Internals
+//! @endcond
 
-    for (size_t i = 0; i < tokens.size() - 1; ++i)
-        if (!((skip_empty && tokens[i].empty()) || (skip_blank && IsBlank(tokens[i]))))
-            result << tokens[i] << delimiter;
-
-    if (!((skip_empty && tokens[tokens.size() - 1].empty()) || (skip_blank && IsBlank(tokens[tokens.size() - 1]))))
-        result << tokens[tokens.size() - 1];
+std::string StringUtils::Join(const std::vector<std::string>& tokens, bool skip_empty, bool skip_blank)
+{
+    return Internals::Join(tokens, std::string_view(), skip_empty, skip_blank);
+}
 
-    return result.str();
+std::string StringUtils::Join(const std::vector<std::string>& tokens, char delimiter, bool skip_empty, bool skip_blank)
+{
+    return Internals::Join(tokens, std::string_view(&delimiter, 1), skip_empty, skip_blank);
 }
 
 std::string StringUtils::Join(const std::vector<std::string>& tokens, const char* delimiter, bool skip_empty, bool skip_blank)
 {
-    if (tokens.empty())
-        return "";
-
-    std::ostringstream result;
-
-    for (size_t i = 0; i < tokens.size() - 1; ++i)
-        if (!((skip_empty && tokens[i].empty()) || (skip_blank && IsBlank(tokens[i]))))
-            result << tokens[i] << delimiter;
-
-    if (!((skip_empty && tokens[tokens.size() - 1].empty()) || (skip_blank && IsBlank(tokens[tokens.size() - 1]))))
-        result << tokens[tokens.size() - 1];
-
-    return result.str();
+    return Internals::Join(tokens, std::string_view(delimiter), skip_empty, skip_blank);
 }
 
 std::string StringUtils::Join(const std::vector<std::string>& tokens, std::string_view delimiter, bool skip_empty, bool skip_blank)
 {
-    if (tokens.empty())
-        return "";
-
-    std::ostringstream result;
-
-    for (size_t i = 0; i < tokens.size() - 1; ++i)
-        if (!((skip_empty && tokens[i].empty()) || (skip_blank && IsBlank(tokens[i]))))
-            result << tokens[i] << delimiter;
-
-    if (!((skip_empty && tokens[tokens.size() - 1].empty()) || (skip_blank && IsBlank(tokens[tokens.size() - 1]))))
-        result << tokens[tokens.size() - 1];
-
-    return result.str();
+    return Internals::Join(tokens, delimiter, skip_empty, skip_blank);
 }
 
 template <>
@@ -0,0 +1,96 @@
+/*!
+    \file tokenizer.cpp
+    \brief String tokenizer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "string/tokenizer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define CPPCOMMON_TOKENIZER_SSE2
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+// Maximal count of delimiters compared with SIMD instructions
+const size_t TOKENIZER_SIMD_DELIMITERS = 8;
+
+inline bool IsDelimiter(const uint64_t* table, uint8_t ch)
+{
+    return (table[ch >> 6] & ((uint64_t)1 << (ch & 63))) != 0;
+}
+
+} // namespace Internals
+//! @endcond
+
+StringTokenizer StringTokenizer::ByAny(std::string_view str, std::string_view delimiters, bool skip_empty) noexcept
+{
+    StringTokenizer result;
+    result._str = str;
+    result._delimiter = delimiters;
+    result._character = 0;
+    result._mode = Mode::ANY;
+    result._skip_empty = skip_empty;
+    result._finished = false;
+    result._position = 0;
+
+    // Build delimiters lookup table
+    std::memset(result._table, 0, sizeof(result._table));
+    for (char ch : delimiters)
+        result._table[(uint8_t)ch >> 6] |= (uint64_t)1 << ((uint8_t)ch & 63);
+
+    return result;
+}
+
+size_t StringTokenizer::FindAny(size_t position) const noexcept
+{
+    const uint8_t* data = (const uint8_t*)_str.data();
+    size_t size = _str.size();
+
+#if defined(CPPCOMMON_TOKENIZER_SSE2)
+    size_t count = _delimiter.size();
+    if ((count > 0) && (count <= Internals::TOKENIZER_SIMD_DELIMITERS))
+    {
+        // Broadcast delimiters (the first one fills unused slots)
+        __m128i delimiters[Internals::TOKENIZER_SIMD_DELIMITERS];
+        for (size_t i = 0; i < Internals::TOKENIZER_SIMD_DELIMITERS; ++i)
+            delimiters[i] = _mm_set1_epi8(_delimiter[(i < count) ? i : 0]);
+
+        for (; (position + 16) <= size; position += 16)
+        {
+            __m128i input = _mm_loadu_si128((const __m128i*)(data + position));
+            __m128i matches = _mm_cmpeq_epi8(input, delimiters[0]);
+            for (size_t i = 1; i < count; ++i)
+                matches = _mm_or_si128(matches, _mm_cmpeq_epi8(input, delimiters[i]));
+            int mask = _mm_movemask_epi8(matches);
+            if (mask != 0)
+            {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanForward(&index, (unsigned long)mask);
+                return position + index;
+#else
+                return position + __builtin_ctz((unsigned)mask);
+#endif
+            }
+        }
+    }
+#endif
+
+    for (; position < size; ++position)
+        if (Internals::IsDelimiter(_table, data[position]))
+            return position;
+
+    return std::string_view::npos;
+}
+
+} // namespace CppCommon
@@ -19,6 +19,10 @@
 #include <windows.h>
 #endif
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#endif
+
 namespace CppCommon {
 
 //! @cond INTERNALS
@@ -243,4 +247,47 @@ bool CPU::HyperThreading()
     return (cores.first != cores.second);
 }
 
+bool CPU::HasSSSE3()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+    static const bool result = __builtin_cpu_supports("ssse3");
+    return result;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    int registers[4];
+    __cpuid(registers, 1);
+    return ((registers[2] & (1 << 9)) != 0);
+#else
+    return false;
+#endif
+}
+
+bool CPU::HasAVX2()
+{
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+    static const bool result = __builtin_cpu_supports("avx2");
+    return result;
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    static const bool result = []()
+    {
+        int registers[4];
+        __cpuid(registers, 0);
+        if (registers[0] < 7)
+            return false;
+
+        // Check AVX and OS support of YMM registers state
+        __cpuid(registers, 1);
+        if (((registers[2] & (1 << 27)) == 0) || ((registers[2] & (1 << 28)) == 0))
+            return false;
+        if ((_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(registers, 7, 0);
+        return ((registers[1] & (1 << 5)) != 0);
+    }();
+    return result;
+#else
+    return false;
+#endif
+}
+
 } // namespace CppCommon
@@ -9,11 +9,16 @@
 #include "system/pipe.h"
 
 #include "errors/fatal.h"
+#include "time/timestamp.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
 #include <cassert>
 
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <poll.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
 #include <windows.h>
@@ -26,14 +31,16 @@ namespace CppCommon {
 class Pipe::Impl
 {
 public:
-    Impl()
+    Impl(size_t capacity) : _would_block(false)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         int result = pipe(_pipe);
         if (result != 0)
             throwex SystemException("Failed to create a new pipe!");
+        if (capacity > 0)
+            SetCapacity(capacity);
 #elif defined(_WIN32) || defined(_WIN64)
-        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, 0))
+        if (!CreatePipe(&_pipe[0], &_pipe[1], nullptr, (DWORD)capacity))
             throwex SystemException("Failed to create a new pipe!");
 #endif
     }
@@ -84,6 +91,129 @@ public:
 #endif
     }
 
+    size_t capacity() const
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(__linux__)
+        int result = fcntl(handle(), F_GETPIPE_SZ);
+        if (result < 0)
+            throwex SystemException("Cannot get the pipe capacity!");
+        return (size_t)result;
+#elif defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        long result = fpathconf(handle(), _PC_PIPE_BUF);
+        return (result > 0) ? (size_t)result : 0;
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD output = 0;
+        DWORD input = 0;
+        if (!GetNamedPipeInfo(handle(), nullptr, &output, &input, nullptr))
+            throwex SystemException("Cannot get the pipe capacity!");
+        return (size_t)std::max(output, input);
+#endif
+    }
+
+    bool IsWouldBlock() const noexcept { return _would_block; }
+
+    bool IsBlocking() const
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        int flags = fcntl(handle(), F_GETFL);
+        if (flags < 0)
+            throwex SystemException("Cannot get the pipe blocking mode!");
+        return ((flags & O_NONBLOCK) == 0);
+#elif defined(_WIN32) || defined(_WIN64)
+        DWORD state = 0;
+        if (!GetNamedPipeHandleStateA(handle(), &state, nullptr, nullptr, nullptr, nullptr, 0))
+            throwex SystemException("Cannot get the pipe blocking mode!");
+        return ((state & PIPE_NOWAIT) == 0);
+#endif
+    }
+
+    size_t SetCapacity(size_t capacity)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+#if defined(__linux__)
+        int result = fcntl(handle(), F_SETPIPE_SZ, (int)capacity);
+        if (result < 0)
+            throwex SystemException("Cannot set the pipe capacity!");
+        return (size_t)result;
+#else
+        return this->capacity();
+#endif
+    }
+
+    void SetBlocking(bool blocking)
+    {
+        assert(IsPipeOpened() && "Pipe is not opened!");
+        if (!IsPipeOpened())
+            throwex SystemException("Pipe is not opened!");
+        for (auto endpoint : _pipe)
+        {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            if (endpoint < 0)
+                continue;
+            int flags = fcntl(endpoint, F_GETFL);
+            if (flags < 0)
+                throwex SystemException("Cannot get the pipe blocking mode!");
+            flags = blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK);
+            if (fcntl(endpoint, F_SETFL, flags) != 0)
+                throwex SystemException("Cannot set the pipe blocking mode!");
+#elif defined(_WIN32) || defined(_WIN64)
+            if (endpoint == INVALID_HANDLE_VALUE)
+                continue;
+            DWORD mode = blocking ? PIPE_WAIT : PIPE_NOWAIT;
+            if (!SetNamedPipeHandleState(endpoint, &mode, nullptr, nullptr))
+                throwex SystemException("Cannot set the pipe blocking mode!");
+#endif
+        }
+    }
+
+    bool WaitRead(const Timespan& timespan)
+    {
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot wait for the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Poll(_pipe[0], POLLIN, timespan);
+#elif defined(_WIN32) || defined(_WIN64)
+        Timestamp finish = NanoTimestamp() + timespan;
+        for (;;)
+        {
+            DWORD available = 0;
+            if (!PeekNamedPipe(_pipe[0], nullptr, 0, nullptr, &available, nullptr))
+            {
+                if (GetLastError() == ERROR_BROKEN_PIPE)
+                    return true;
+                throwex SystemException("Cannot wait for the pipe!");
+            }
+            if (available > 0)
+                return true;
+            if (NanoTimestamp() >= finish)
+                return false;
+            Sleep(1);
+        }
+#endif
+    }
+
+    bool WaitWrite(const Timespan& timespan)
+    {
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot wait for the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        return Poll(_pipe[1], POLLOUT, timespan);
+#elif defined(_WIN32) || defined(_WIN64)
+        // Anonymous pipes do not report free space, so the pipe is always ready for writing
+        return true;
+#endif
+    }
+
     size_t Read(void* buffer, size_t size)
     {
         if ((buffer == nullptr) || (size == 0))
@@ -93,15 +223,28 @@ public:
         if (!IsPipeReadOpened())
             throwex SystemException("Cannot read from the closed pipe!");
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _would_block = false;
         ssize_t result = read(_pipe[0], buffer, size);
         if (result < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                _would_block = true;
+                return 0;
+            }
             throwex SystemException("Cannot read from the pipe!");
+        }
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
+        _would_block = false;
         DWORD result = 0;
         if (!ReadFile(_pipe[0], buffer, (DWORD)size, &result, nullptr))
-            if (GetLastError() != ERROR_BROKEN_PIPE)
+        {
+            if (GetLastError() == ERROR_NO_DATA)
+                _would_block = true;
+            else if (GetLastError() != ERROR_BROKEN_PIPE)
                 throwex SystemException("Cannot read from the pipe!");
+        }
         return (size_t)result;
 #endif
     }
@@ -115,19 +258,237 @@ public:
         if (!IsPipeWriteOpened())
             throwex SystemException("Cannot write into the closed pipe!");
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _would_block = false;
         ssize_t result = write(_pipe[1], buffer, size);
         if (result < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                _would_block = true;
+                return 0;
+            }
             throwex SystemException("Cannot write into the pipe!");
+        }
         return (size_t)result;
 #elif defined(_WIN32) || defined(_WIN64)
+        _would_block = false;
         DWORD result = 0;
         if (!WriteFile(_pipe[1], buffer, (DWORD)size, &result, nullptr))
+        {
             if (GetLastError() != ERROR_BROKEN_PIPE)
                 throwex SystemException("Cannot write into the pipe!");
+        }
+        else if (result == 0)
+        {
+            // Full pipe in PIPE_NOWAIT mode accepts nothing without an error
+            _would_block = true;
+        }
         return (size_t)result;
 #endif
     }
 
+    size_t ReadV(std::span<const IOBuffer> buffers)
+    {
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot read from the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _would_block = false;
+        size_t counter = 0;
+        for (size_t index = 0; index < buffers.size();)
+        {
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            size_t expected = 0;
+            for (; (index < buffers.size()) && (count < IOV_CHUNK); ++index)
+            {
+                iov[count].iov_base = buffers[index].data;
+                iov[count].iov_len = buffers[index].size;
+                expected += buffers[index].size;
+                ++count;
+            }
+            ssize_t result = readv(_pipe[0], iov, count);
+            if (result < 0)
+            {
+                if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                {
+                    _would_block = (counter == 0);
+                    break;
+                }
+                throwex SystemException("Cannot read from the pipe!");
+            }
+            counter += (size_t)result;
+            // Pipe returns only the available data
+            if ((size_t)result < expected)
+                break;
+        }
+        return counter;
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t result = Read(buffer.data, buffer.size);
+            counter += result;
+            if (result < buffer.size)
+                break;
+        }
+        return counter;
+#endif
+    }
+
+    size_t WriteV(std::span<const ConstIOBuffer> buffers)
+    {
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot write into the closed pipe!");
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        _would_block = false;
+        size_t counter = 0;
+        for (size_t index = 0; index < buffers.size();)
+        {
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            size_t expected = 0;
+            for (; (index < buffers.size()) && (count < IOV_CHUNK); ++index)
+            {
+                iov[count].iov_base = (void*)buffers[index].data;
+                iov[count].iov_len = buffers[index].size;
+                expected += buffers[index].size;
+                ++count;
+            }
+            ssize_t result = writev(_pipe[1], iov, count);
+            if (result < 0)
+            {
+                if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+                {
+                    _would_block = (counter == 0);
+                    break;
+                }
+                throwex SystemException("Cannot write into the pipe!");
+            }
+            counter += (size_t)result;
+            if ((size_t)result < expected)
+                break;
+        }
+        return counter;
+#elif defined(_WIN32) || defined(_WIN64)
+        size_t counter = 0;
+        for (const auto& buffer : buffers)
+        {
+            size_t result = Write(buffer.data, buffer.size);
+            counter += result;
+            if (result < buffer.size)
+                break;
+        }
+        return counter;
+#endif
+    }
+
+    size_t SpliceFrom(void* handle, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot splice into the closed pipe!");
+        _would_block = false;
+#if defined(__linux__)
+        // Move data from the given descriptor into the pipe in the kernel
+        ssize_t result = splice((int)(size_t)handle, nullptr, _pipe[1], nullptr, size, SPLICE_F_MOVE);
+        if (result >= 0)
+            return (size_t)result;
+        if (errno == EAGAIN)
+        {
+            _would_block = true;
+            return 0;
+        }
+        if (errno != EINVAL)
+            throwex SystemException("Cannot splice into the pipe!");
+#endif
+        // User space transfer through the intermediate buffer
+        uint8_t buffer[SPLICE_BUFFER];
+        size_t count = ReadHandle(NativeHandle(handle), buffer, (size < sizeof(buffer)) ? size : sizeof(buffer), _would_block);
+        WriteHandle(_pipe[1], buffer, count);
+        return count;
+    }
+
+    size_t SpliceTo(void* handle, size_t size)
+    {
+        if (size == 0)
+            return 0;
+
+        assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!IsPipeReadOpened())
+            throwex SystemException("Cannot splice from the closed pipe!");
+        _would_block = false;
+#if defined(__linux__)
+        // Move data from the pipe into the given descriptor in the kernel
+        ssize_t result = splice(_pipe[0], nullptr, (int)(size_t)handle, nullptr, size, SPLICE_F_MOVE);
+        if (result >= 0)
+            return (size_t)result;
+        if (errno == EAGAIN)
+        {
+            _would_block = true;
+            return 0;
+        }
+        if (errno != EINVAL)
+            throwex SystemException("Cannot splice from the pipe!");
+#endif
+        // User space transfer through the intermediate buffer
+        uint8_t buffer[SPLICE_BUFFER];
+        size_t count = ReadHandle(_pipe[0], buffer, (size < sizeof(buffer)) ? size : sizeof(buffer), _would_block);
+        WriteHandle(NativeHandle(handle), buffer, count);
+        return count;
+    }
+
+    size_t SpliceV(std::span<const ConstIOBuffer> buffers)
+    {
+        assert(IsPipeWriteOpened() && "Pipe is not opened for writing!");
+        if (!IsPipeWriteOpened())
+            throwex SystemException("Cannot splice into the closed pipe!");
+#if defined(__linux__)
+        // vmsplice() ignores the non-blocking mode of the pipe without the explicit flag
+        int status = fcntl(_pipe[1], F_GETFL);
+        if (status < 0)
+            throwex SystemException("Cannot get the pipe blocking mode!");
+        unsigned int flags = (status & O_NONBLOCK) ? SPLICE_F_NONBLOCK : 0;
+
+        _would_block = false;
+        size_t counter = 0;
+        for (size_t index = 0; index < buffers.size();)
+        {
+            struct iovec iov[IOV_CHUNK];
+            int count = 0;
+            size_t expected = 0;
+            for (; (index < buffers.size()) && (count < IOV_CHUNK); ++index)
+            {
+                iov[count].iov_base = (void*)buffers[index].data;
+                iov[count].iov_len = buffers[index].size;
+                expected += buffers[index].size;
+                ++count;
+            }
+            // Map user pages into the pipe without copying
+            ssize_t result = vmsplice(_pipe[1], iov, count, flags);
+            if (result < 0)
+            {
+                if (errno == EAGAIN)
+                {
+                    _would_block = (counter == 0);
+                    break;
+                }
+                throwex SystemException("Cannot splice into the pipe!");
+            }
+            counter += (size_t)result;
+            if ((size_t)result < expected)
+                break;
+        }
+        return counter;
+#else
+        return WriteV(buffers);
+#endif
+    }
+
     void CloseRead()
     {
         assert(IsPipeReadOpened() && "Pipe is not opened for reading!");
@@ -171,10 +532,105 @@ public:
     }
 
 private:
+    // Count of I/O vectors passed into a single system call
+    static const int IOV_CHUNK = 64;
+    // Size of the user space splice buffer
+    static const size_t SPLICE_BUFFER = 16384;
+
+    // Was the last read, write or splice operation stopped because the pipe was not ready?
+    bool _would_block;
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     int _pipe[2];
+
+    static int NativeHandle(void* handle) noexcept { return (int)(size_t)handle; }
+
+    // Any opened endpoint to query the pipe properties
+    int handle() const noexcept { return (_pipe[0] >= 0) ? _pipe[0] : _pipe[1]; }
+
+    static bool Poll(int handle, short events, const Timespan& timespan)
+    {
+        struct pollfd fds = { handle, events, 0 };
+        int timeout = (timespan < 0) ? -1 : (int)std::min(timespan.milliseconds(), (int64_t)0x7FFFFFFF);
+        int result;
+        do
+        {
+            result = poll(&fds, 1, timeout);
+        } while ((result < 0) && (errno == EINTR));
+        if (result < 0)
+            throwex SystemException("Cannot wait for the pipe!");
+        return (result > 0);
+    }
+
+    static size_t ReadHandle(int handle, uint8_t* buffer, size_t size, bool& would_block)
+    {
+        ssize_t result;
+        do
+        {
+            result = read(handle, buffer, size);
+        } while ((result < 0) && (errno == EINTR));
+        if (result < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK))
+            {
+                would_block = true;
+                return 0;
+            }
+            throwex SystemException("Cannot splice the pipe data!");
+        }
+        return (size_t)result;
+    }
+
+    static void WriteHandle(int handle, const uint8_t* buffer, size_t size)
+    {
+        while (size > 0)
+        {
+            ssize_t result = write(handle, buffer, size);
+            if (result < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                // Wait for the free space in the non-blocking destination
+                if (((errno == EAGAIN) || (errno == EWOULDBLOCK)) && Poll(handle, POLLOUT, Timespan(-1)))
+                    continue;
+                throwex SystemException("Cannot splice the pipe data!");
+            }
+            buffer += result;
+            size -= (size_t)result;
+        }
+    }
 #elif defined(_WIN32) || defined(_WIN64)
     HANDLE _pipe[2];
+
+    static HANDLE NativeHandle(void* handle) noexcept { return (HANDLE)handle; }
+
+    // Any opened endpoint to query the pipe properties
+    HANDLE handle() const noexcept { return (_pipe[0] != INVALID_HANDLE_VALUE) ? _pipe[0] : _pipe[1]; }
+
+    static size_t ReadHandle(HANDLE handle, uint8_t* buffer, size_t size, bool& would_block)
+    {
+        DWORD result = 0;
+        if (!ReadFile(handle, buffer, (DWORD)size, &result, nullptr))
+        {
+            if (GetLastError() == ERROR_NO_DATA)
+                would_block = true;
+            else if (GetLastError() != ERROR_BROKEN_PIPE)
+                throwex SystemException("Cannot splice the pipe data!");
+        }
+        return (size_t)result;
+    }
+
+    static void WriteHandle(HANDLE handle, const uint8_t* buffer, size_t size)
+    {
+        while (size > 0)
+        {
+            DWORD result;
+            if (!WriteFile(handle, buffer, (DWORD)size, &result, nullptr))
+                throwex SystemException("Cannot splice the pipe data!");
+            buffer += result;
+            size -= (size_t)result;
+        }
+    }
 #endif
 };
 
@@ -188,7 +644,13 @@ Pipe::Pipe()
     static_assert(((StorageAlign % alignof(Impl)) == 0), "Pipe::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl();
+    new(&_storage)Impl(0);
+}
+
+Pipe::Pipe(size_t capacity)
+{
+    // Create the implementation instance
+    new(&_storage)Impl(capacity);
 }
 
 Pipe::~Pipe()
@@ -204,8 +666,23 @@ bool Pipe::IsPipeOpened() const noexcept { return impl().IsPipeOpened(); }
 bool Pipe::IsPipeReadOpened() const noexcept { return impl().IsPipeReadOpened(); }
 bool Pipe::IsPipeWriteOpened() const noexcept { return impl().IsPipeWriteOpened(); }
 
+size_t Pipe::capacity() const { return impl().capacity(); }
+bool Pipe::IsBlocking() const { return impl().IsBlocking(); }
+bool Pipe::IsWouldBlock() const noexcept { return impl().IsWouldBlock(); }
+
+size_t Pipe::SetCapacity(size_t capacity) { return impl().SetCapacity(capacity); }
+void Pipe::SetBlocking(bool blocking) { impl().SetBlocking(blocking); }
+
+bool Pipe::WaitRead(const Timespan& timespan) { return impl().WaitRead(timespan); }
+bool Pipe::WaitWrite(const Timespan& timespan) { return impl().WaitWrite(timespan); }
+
 size_t Pipe::Read(void* buffer, size_t size) { return impl().Read(buffer, size); }
 size_t Pipe::Write(const void* buffer, size_t size) { return impl().Write(buffer, size); }
+size_t Pipe::ReadV(std::span<const IOBuffer> buffers) { return impl().ReadV(buffers); }
+size_t Pipe::WriteV(std::span<const ConstIOBuffer> buffers) { return impl().WriteV(buffers); }
+size_t Pipe::SpliceFrom(void* handle, size_t size) { return impl().SpliceFrom(handle, size); }
+size_t Pipe::SpliceTo(void* handle, size_t size) { return impl().SpliceTo(handle, size); }
+size_t Pipe::SpliceV(std::span<const ConstIOBuffer> buffers) { return impl().SpliceV(buffers); }
 
 void Pipe::CloseRead() { return impl().CloseRead(); }
 void Pipe::CloseWrite() { return impl().CloseWrite(); }
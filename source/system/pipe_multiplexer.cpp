@@ -0,0 +1,132 @@
+/*!
+    \file pipe_multiplexer.cpp
+    \brief Pipe multiplexer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "system/pipe_multiplexer.h"
+
+#include "time/timestamp.h"
+#include "utility/resource.h"
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <unistd.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#undef max
+#undef min
+#endif
+
+namespace CppCommon {
+
+PipeMultiplexer::PipeMultiplexer(size_t buffer) : _buffer(buffer), _dispatching(false)
+{
+    assert((buffer > 0) && "Pipe multiplexer buffer size must be greater than zero!");
+}
+
+void PipeMultiplexer::Add(Pipe& pipe, const Handler& handler)
+{
+    assert(pipe.IsPipeReadOpened() && "Pipe is not opened for reading!");
+    if (!pipe.IsPipeReadOpened())
+        throwex SystemException("Cannot multiplex the closed pipe!");
+
+    _pipes.emplace_back(std::make_unique<Entry>(Entry{ &pipe, handler, false }));
+}
+
+bool PipeMultiplexer::Remove(Pipe& pipe)
+{
+    auto it = std::find_if(_pipes.begin(), _pipes.end(), [&pipe](const std::unique_ptr<Entry>& entry) { return entry->pipe == &pipe; });
+    if (it == _pipes.end())
+        return false;
+
+    // The pipe handler might be executing right now, so destroy it after dispatching
+    (*it)->removed = true;
+    if (_dispatching)
+        _removed.push_back(std::move(*it));
+    _pipes.erase(it);
+    return true;
+}
+
+size_t PipeMultiplexer::Poll(const Timespan& timespan)
+{
+    if (_pipes.empty())
+        return 0;
+
+    // Collect ready pipes
+    std::vector<Entry*> ready;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    std::vector<struct pollfd> fds(_pipes.size());
+    for (size_t i = 0; i < _pipes.size(); ++i)
+    {
+        fds[i].fd = (int)(size_t)_pipes[i]->pipe->reader();
+        fds[i].events = POLLIN;
+        fds[i].revents = 0;
+    }
+    int timeout = (timespan < 0) ? -1 : (int)std::min(timespan.milliseconds(), (int64_t)0x7FFFFFFF);
+    int result;
+    do
+    {
+        result = poll(fds.data(), (nfds_t)fds.size(), timeout);
+    } while ((result < 0) && (errno == EINTR));
+    if (result < 0)
+        throwex SystemException("Cannot poll the multiplexed pipes!");
+    for (size_t i = 0; i < fds.size(); ++i)
+        if (fds[i].revents != 0)
+            ready.push_back(_pipes[i].get());
+#elif defined(_WIN32) || defined(_WIN64)
+    // Anonymous pipes do not support overlapped I/O, so peek them periodically
+    Timestamp finish = NanoTimestamp() + timespan;
+    for (;;)
+    {
+        for (size_t i = 0; i < _pipes.size(); ++i)
+        {
+            DWORD available = 0;
+            if (!PeekNamedPipe((HANDLE)_pipes[i]->pipe->reader(), nullptr, 0, nullptr, &available, nullptr) || (available > 0))
+                ready.push_back(_pipes[i].get());
+        }
+        if (!ready.empty() || ((timespan >= 0) && (NanoTimestamp() >= finish)))
+            break;
+        Sleep(1);
+    }
+#endif
+
+    // Drain ready pipes and remove closed ones
+    size_t total = 0;
+    _dispatching = true;
+    auto dispatching = resource([this](void*) { _dispatching = false; _removed.clear(); });
+    for (auto entry : ready)
+    {
+        // Skip pipes removed by previous handlers
+        if (entry->removed)
+            continue;
+
+        size_t size = entry->pipe->Read(_buffer.data(), _buffer.size());
+
+        // Non-blocking pipe might report readiness without data
+        if ((size == 0) && entry->pipe->IsWouldBlock())
+            continue;
+
+        entry->handler(*entry->pipe, _buffer.data(), size);
+        if ((size == 0) && !entry->removed)
+            Remove(*entry->pipe);
+        total += size;
+    }
+
+    return total;
+}
+
+size_t PipeMultiplexer::Drain()
+{
+    size_t total = 0;
+    while (!empty())
+        total += Poll(Timespan(-1));
+    return total;
+}
+
+} // namespace CppCommon
@@ -11,13 +11,20 @@
 #include "errors/fatal.h"
 #include "string/encoding.h"
 #include "string/format.h"
+#include "system/pipe_multiplexer.h"
 #include "threads/thread.h"
 #include "utility/resource.h"
 #include "utility/validate_aligned_storage.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <string_view>
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/wait.h>
 #include <signal.h>
+#include <spawn.h>
 #include <stdlib.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -197,6 +204,23 @@ public:
 #endif
     }
 
+    static bool IsProcessRunning(uint64_t pid) noexcept
+    {
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Permission error means the process exists, but belongs to another user
+        return ((kill((pid_t)pid, 0) == 0) || (errno == EPERM));
+#elif defined(_WIN32) || defined(_WIN64)
+        HANDLE hProcess = OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, (DWORD)pid);
+        if (hProcess == nullptr)
+            return (GetLastError() == ERROR_ACCESS_DENIED);
+
+        DWORD dwExitCode;
+        bool result = (GetExitCodeProcess(hProcess, &dwExitCode) && (dwExitCode == STILL_ACTIVE));
+        CloseHandle(hProcess);
+        return result;
+#endif
+    }
+
     static uint64_t ParentProcessId() noexcept
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
@@ -240,92 +264,12 @@ public:
     static Process Execute(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        // Prepare arguments
-        size_t index = 0;
-        std::vector<char*> argv(1 + ((arguments != nullptr) ? arguments->size() : 0) + 1);
-        argv[index++] = (char*)command.c_str();
-        if (arguments != nullptr)
-        {
-            for (const auto& argument : *arguments)
-            {
-                argv[index++] = (char*)argument.c_str();
-            }
-        }
-        argv[index++] = nullptr;
-
-        // Prepare environment variables
+        // Prepare arguments and environment variables
+        std::vector<char*> argv = PrepareArguments(command, arguments);
         std::vector<char> environment = PrepareEnvars(envars);
+        std::vector<char*> envp = PrepareEnvironment(environment);
 
-        // Fork the current process
-        pid_t pid = fork();
-        if (pid < 0)
-            throwex SystemException("Failed to fork the current process!");
-        else if (pid == 0)
-        {
-            // Set environment variables of the new process
-            if (!environment.empty())
-            {
-                char* envar = environment.data();
-                while (*envar != '\0')
-                {
-                    putenv(envar);
-                    while (*envar != '\0')
-                        ++envar;
-                    ++envar;
-                }
-            }
-
-            // Change the current directory of the new process
-            if (directory != nullptr)
-            {
-                int result = chdir(directory->c_str());
-                if (result != 0)
-                    _exit(666);
-            }
-
-            // Prepare input communication pipe
-            if (input != nullptr)
-                dup2((int)(size_t)input->reader(), STDIN_FILENO);
-
-            // Prepare output communication pipe
-            if (output != nullptr)
-                dup2((int)(size_t)output->writer(), STDOUT_FILENO);
-
-            // Prepare error communication pipe
-            if (error != nullptr)
-                dup2((int)(size_t)error->writer(), STDERR_FILENO);
-
-            // Close pipes endpoints
-            if (input != nullptr)
-                input->Close();
-            if (output != nullptr)
-                output->Close();
-            if (error != nullptr)
-                error->Close();
-
-            // Close all open file descriptors other than stdin, stdout, stderr
-            for (int i = 3; i < sysconf(_SC_OPEN_MAX); ++i)
-                close(i);
-
-            // Execute a new process image
-            execvp(argv[0], argv.data());
-
-            // Get here only if error occurred during image execution
-            _exit(666);
-        }
-
-        // Close pipes endpoints
-        if (input != nullptr)
-            input->CloseRead();
-        if (output != nullptr)
-            output->CloseWrite();
-        if (error != nullptr)
-            error->CloseWrite();
-
-        // Return result process
-        Process result;
-        result.impl()._pid = pid;
-        return result;
+        return Spawn(command, argv, envp, directory, input, output, error);
 #elif defined(_WIN32) || defined(_WIN64)
         BOOL bInheritHandles = FALSE;
 
@@ -432,6 +376,166 @@ public:
 #endif
     }
 
+    static std::vector<Process> ExecuteMany(const std::string& command, const std::vector<std::vector<std::string>>& arguments, const std::map<std::string, std::string>* envars, const std::string* directory, const std::vector<Pipe*>* outputs, const std::vector<Pipe*>* errors)
+    {
+        assert(((outputs == nullptr) || (outputs->size() == arguments.size())) && "Output pipes count must be equal to the processes count!");
+        assert(((errors == nullptr) || (errors->size() == arguments.size())) && "Error pipes count must be equal to the processes count!");
+
+        std::vector<Process> result;
+        result.reserve(arguments.size());
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+        // Prepare environment variables once for all processes
+        std::vector<char> environment = PrepareEnvars(envars);
+        std::vector<char*> envp = PrepareEnvironment(environment);
+
+        for (size_t i = 0; i < arguments.size(); ++i)
+        {
+            std::vector<char*> argv = PrepareArguments(command, &arguments[i]);
+            result.emplace_back(Spawn(command, argv, envp, directory, nullptr, (outputs != nullptr) ? (*outputs)[i] : nullptr, (errors != nullptr) ? (*errors)[i] : nullptr));
+        }
+#elif defined(_WIN32) || defined(_WIN64)
+        for (size_t i = 0; i < arguments.size(); ++i)
+            result.emplace_back(Execute(command, &arguments[i], envars, directory, nullptr, (outputs != nullptr) ? (*outputs)[i] : nullptr, (errors != nullptr) ? (*errors)[i] : nullptr));
+#endif
+
+        return result;
+    }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+    static std::vector<char*> PrepareArguments(const std::string& command, const std::vector<std::string>* arguments)
+    {
+        std::vector<char*> result;
+        result.reserve(1 + ((arguments != nullptr) ? arguments->size() : 0) + 1);
+        result.push_back((char*)command.c_str());
+        if (arguments != nullptr)
+            for (const auto& argument : *arguments)
+                result.push_back((char*)argument.c_str());
+        result.push_back(nullptr);
+        return result;
+    }
+
+    static std::vector<char*> PrepareEnvironment(std::vector<char>& environment)
+    {
+        std::vector<char*> result;
+
+        // Empty environment means the new process inherits the current one
+        if (environment.empty())
+            return result;
+
+        // Collect overridden environment variables
+        std::vector<std::string_view> keys;
+        for (char* envar = environment.data(); *envar != '\0'; envar += std::strlen(envar) + 1)
+        {
+            result.push_back(envar);
+            keys.emplace_back(envar, std::strchr(envar, '=') - envar + 1);
+        }
+
+        // Inherit other environment variables of the current process
+        for (char** envar = environ; *envar != nullptr; ++envar)
+        {
+            std::string_view current(*envar);
+            if (std::none_of(keys.begin(), keys.end(), [&current](std::string_view key) { return current.starts_with(key); }))
+                result.push_back(*envar);
+        }
+
+        result.push_back(nullptr);
+        return result;
+    }
+
+    static Process Spawn(const std::string& command, std::vector<char*>& argv, std::vector<char*>& envp, const std::string* directory, Pipe* input, Pipe* output, Pipe* error)
+    {
+        char** environment = envp.empty() ? environ : envp.data();
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 34)))
+        // Spawn a new process with clone(CLONE_VM | CLONE_VFORK) inside posix_spawn(),
+        // so page tables of the large parent process are not copied
+        posix_spawn_file_actions_t actions;
+        int status = posix_spawn_file_actions_init(&actions);
+        if (status != 0)
+            throwex SystemException("Failed to initialize process spawn actions!", status);
+        auto cleaner = resource(&actions, [](posix_spawn_file_actions_t* file_actions) { posix_spawn_file_actions_destroy(file_actions); });
+
+        // Change the current directory of the new process
+        if (directory != nullptr)
+            status = posix_spawn_file_actions_addchdir_np(&actions, directory->c_str());
+
+        // Prepare input, output and error communication pipes
+        if ((status == 0) && (input != nullptr))
+            status = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)input->reader(), STDIN_FILENO);
+        if ((status == 0) && (output != nullptr))
+            status = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)output->writer(), STDOUT_FILENO);
+        if ((status == 0) && (error != nullptr))
+            status = posix_spawn_file_actions_adddup2(&actions, (int)(size_t)error->writer(), STDERR_FILENO);
+
+        // Close all open file descriptors other than stdin, stdout, stderr
+        if (status == 0)
+            status = posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+        if (status != 0)
+            throwex SystemException("Failed to prepare process spawn actions!", status);
+
+        // Execute a new process image
+        pid_t pid;
+        status = posix_spawnp(&pid, command.c_str(), &actions, nullptr, argv.data(), environment);
+        if (status != 0)
+            throwex SystemException(CppCommon::format("Failed to execute a new process with command '{}'!", command), status);
+#else
+        // Fork the current process
+        pid_t pid = fork();
+        if (pid < 0)
+            throwex SystemException("Failed to fork the current process!");
+        else if (pid == 0)
+        {
+            // Set environment variables of the new process
+            environ = environment;
+
+            // Change the current directory of the new process
+            if (directory != nullptr)
+            {
+                int result = chdir(directory->c_str());
+                if (result != 0)
+                    _exit(666);
+            }
+
+            // Prepare input communication pipe
+            if (input != nullptr)
+                dup2((int)(size_t)input->reader(), STDIN_FILENO);
+
+            // Prepare output communication pipe
+            if (output != nullptr)
+                dup2((int)(size_t)output->writer(), STDOUT_FILENO);
+
+            // Prepare error communication pipe
+            if (error != nullptr)
+                dup2((int)(size_t)error->writer(), STDERR_FILENO);
+
+            // Close all open file descriptors other than stdin, stdout, stderr
+            for (int i = 3; i < sysconf(_SC_OPEN_MAX); ++i)
+                close(i);
+
+            // Execute a new process image
+            execvp(argv[0], argv.data());
+
+            // Get here only if error occurred during image execution
+            _exit(666);
+        }
+#endif
+
+        // Close pipes endpoints
+        if (input != nullptr)
+            input->CloseRead();
+        if (output != nullptr)
+            output->CloseWrite();
+        if (error != nullptr)
+            error->CloseWrite();
+
+        // Return result process
+        Process result;
+        result.impl()._pid = pid;
+        return result;
+    }
+#endif
+
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
     static std::vector<char> PrepareEnvars(const std::map<std::string, std::string>* envars)
 #elif defined(_WIN32) || defined(_WIN64)
@@ -543,6 +647,7 @@ int Process::WaitFor(const Timespan& timespan) { return impl().WaitFor(timespan)
 
 uint64_t Process::CurrentProcessId() noexcept { return Impl::CurrentProcessId(); }
 uint64_t Process::ParentProcessId() noexcept { return Impl::ParentProcessId(); }
+bool Process::IsProcessRunning(uint64_t pid) noexcept { return Impl::IsProcessRunning(pid); }
 
 void Process::Exit(int result) { return Impl::Exit(result); }
 
@@ -551,6 +656,30 @@ Process Process::Execute(const std::string& command, const std::vector<std::stri
     return Impl::Execute(command, arguments, envars, directory, input, output, error);
 }
 
+std::vector<Process> Process::ExecuteMany(const std::string& command, const std::vector<std::vector<std::string>>& arguments, const std::map<std::string, std::string>* envars, const std::string* directory, const std::vector<Pipe*>* outputs, const std::vector<Pipe*>* errors)
+{
+    return Impl::ExecuteMany(command, arguments, envars, directory, outputs, errors);
+}
+
+int Process::Capture(const std::string& command, const std::vector<std::string>* arguments, const std::map<std::string, std::string>* envars, const std::string* directory, std::string* output, std::string* error)
+{
+    Pipe output_pipe;
+    Pipe error_pipe;
+
+    // Execute a new process with captured output and error streams
+    Process process = Execute(command, arguments, envars, directory, nullptr, (output != nullptr) ? &output_pipe : nullptr, (error != nullptr) ? &error_pipe : nullptr);
+
+    // Drain both streams from the current thread, so the process never blocks on a full pipe
+    PipeMultiplexer multiplexer;
+    if (output != nullptr)
+        multiplexer.Add(output_pipe, [output](Pipe&, const void* buffer, size_t size) { output->append((const char*)buffer, size); });
+    if (error != nullptr)
+        multiplexer.Add(error_pipe, [error](Pipe&, const void* buffer, size_t size) { error->append((const char*)buffer, size); });
+    multiplexer.Drain();
+
+    return process.Wait();
+}
+
 void Process::swap(Process& process) noexcept
 {
     using std::swap;
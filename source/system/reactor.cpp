@@ -0,0 +1,460 @@
+/*!
+    \file reactor.cpp
+    \brief Event loop reactor implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "system/reactor.h"
+
+#include "errors/fatal.h"
+#include "threads/critical_section.h"
+#include "threads/locker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+#if defined(__linux__)
+
+class Reactor::Impl
+{
+public:
+    Impl(size_t buffer) : _token(0), _stop(false), _buffer(buffer), _events(64)
+    {
+        assert((buffer > 0) && "Reactor buffer size must be greater than zero!");
+
+        _epoll = epoll_create1(EPOLL_CLOEXEC);
+        if (_epoll < 0)
+            throwex SystemException("Failed to create a new epoll instance!");
+
+        // Register the wakeup event with the reserved zero token
+        _wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_wakeup < 0)
+        {
+            close(_epoll);
+            throwex SystemException("Failed to create a new wakeup event!");
+        }
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = 0;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, _wakeup, &event) != 0)
+        {
+            close(_wakeup);
+            close(_epoll);
+            throwex SystemException("Failed to register the wakeup event!");
+        }
+    }
+
+    ~Impl()
+    {
+        for (auto& source : _sources)
+            CloseSource(*source.second);
+
+        int result = close(_wakeup);
+        if (result != 0)
+            fatality(SystemException("Failed to close the wakeup event!"));
+        result = close(_epoll);
+        if (result != 0)
+            fatality(SystemException("Failed to close the epoll instance!"));
+    }
+
+    size_t size() const noexcept { return _sources.size(); }
+
+    Token AddPipe(Pipe& pipe, const PipeHandler& handler)
+    {
+        assert(pipe.IsPipeReadOpened() && "Pipe is not opened for reading!");
+        if (!pipe.IsPipeReadOpened())
+            throwex SystemException("Cannot register the closed pipe!");
+
+        pipe.SetBlocking(false);
+
+        auto source = std::make_unique<Source>();
+        source->type = SourceType::PIPE;
+        source->fd = (int)(size_t)pipe.reader();
+        source->owned = false;
+        source->pipe = &pipe;
+        source->pipe_handler = handler;
+        return Register(std::move(source), EPOLLIN | EPOLLRDHUP | EPOLLET);
+    }
+
+    Token AddProcess(Process& process, const ProcessHandler& handler)
+    {
+#if defined(SYS_pidfd_open)
+        int fd = (int)syscall(SYS_pidfd_open, (pid_t)process.pid(), 0);
+#else
+        int fd = -1;
+        errno = ENOSYS;
+#endif
+        if (fd < 0)
+            throwex SystemException("Failed to open the process file descriptor!");
+
+        auto source = std::make_unique<Source>();
+        source->type = SourceType::PROCESS;
+        source->fd = fd;
+        source->owned = true;
+        source->process = &process;
+        source->process_handler = handler;
+        return Register(std::move(source), EPOLLIN);
+    }
+
+    Token AddTimer(const Timespan& timeout, const Handler& handler, bool periodic)
+    {
+        int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+        if (fd < 0)
+            throwex SystemException("Failed to create a new timer!");
+
+        // Zero timer value disarms the timer, so fire it in one nanosecond instead
+        int64_t nanoseconds = std::max(timeout.nanoseconds(), (int64_t)1);
+        struct itimerspec spec = {};
+        spec.it_value.tv_sec = nanoseconds / 1000000000;
+        spec.it_value.tv_nsec = nanoseconds % 1000000000;
+        if (periodic)
+            spec.it_interval = spec.it_value;
+        if (timerfd_settime(fd, 0, &spec, nullptr) != 0)
+        {
+            close(fd);
+            throwex SystemException("Failed to arm the timer!");
+        }
+
+        auto source = std::make_unique<Source>();
+        source->type = periodic ? SourceType::PERIODIC_TIMER : SourceType::TIMER;
+        source->fd = fd;
+        source->owned = true;
+        source->handler = handler;
+        return Register(std::move(source), EPOLLIN);
+    }
+
+    Token AddEvent(const Handler& handler)
+    {
+        int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (fd < 0)
+            throwex SystemException("Failed to create a new event!");
+
+        auto source = std::make_unique<Source>();
+        source->type = SourceType::EVENT;
+        source->fd = fd;
+        source->owned = true;
+        source->handler = handler;
+        return Register(std::move(source), EPOLLIN);
+    }
+
+    bool Remove(Token token)
+    {
+        std::unique_ptr<Source> source;
+        {
+            Locker<CriticalSection> locker(_cs);
+
+            auto it = _sources.find(token);
+            if (it == _sources.end())
+                return false;
+
+            source = std::move(it->second);
+            _sources.erase(it);
+        }
+
+        epoll_ctl(_epoll, EPOLL_CTL_DEL, source->fd, nullptr);
+        CloseSource(*source);
+
+        // The source handler might be executing right now, so destroy it after dispatching
+        _removed.push_back(std::move(source));
+        return true;
+    }
+
+    bool Signal(Token token)
+    {
+        Locker<CriticalSection> locker(_cs);
+
+        auto it = _sources.find(token);
+        if ((it == _sources.end()) || (it->second->type != SourceType::EVENT))
+            return false;
+
+        Notify(it->second->fd);
+        return true;
+    }
+
+    size_t Poll(const Timespan& timespan)
+    {
+        int timeout = (timespan.total() < 0) ? -1 : (int)((timespan.nanoseconds() + 999999) / 1000000);
+
+        int count = epoll_wait(_epoll, _events.data(), (int)_events.size(), timeout);
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                return 0;
+            throwex SystemException("Failed to wait for the epoll instance!");
+        }
+
+        size_t dispatched = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            Token token = _events[i].data.u64;
+            uint32_t events = _events[i].events;
+
+            if (token == 0)
+            {
+                Consume(_wakeup);
+                continue;
+            }
+
+            // Find the ready source which might be removed by previous handlers
+            Source* source;
+            {
+                Locker<CriticalSection> locker(_cs);
+
+                auto it = _sources.find(token);
+                if (it == _sources.end())
+                    continue;
+
+                source = it->second.get();
+            }
+
+            dispatched += Dispatch(token, *source, events);
+        }
+
+        _removed.clear();
+
+        // Grow the events buffer if it was filled completely
+        if ((size_t)count == _events.size())
+            _events.resize(_events.size() * 2);
+
+        return dispatched;
+    }
+
+    void Run()
+    {
+        while (!_stop.exchange(false, std::memory_order_acq_rel))
+            Poll(Timespan(-1));
+    }
+
+    void Stop()
+    {
+        _stop.store(true, std::memory_order_release);
+        Notify(_wakeup);
+    }
+
+private:
+    enum class SourceType { PIPE, PROCESS, TIMER, PERIODIC_TIMER, EVENT };
+
+    struct Source
+    {
+        SourceType type;
+        int fd;
+        bool owned;
+        Pipe* pipe;
+        Process* process;
+        PipeHandler pipe_handler;
+        ProcessHandler process_handler;
+        Handler handler;
+    };
+
+    int _epoll;
+    int _wakeup;
+    Token _token;
+    std::atomic<bool> _stop;
+    CriticalSection _cs;
+    std::unordered_map<Token, std::unique_ptr<Source>> _sources;
+    std::vector<std::unique_ptr<Source>> _removed;
+    std::vector<uint8_t> _buffer;
+    std::vector<struct epoll_event> _events;
+
+    Token Register(std::unique_ptr<Source> source, uint32_t events)
+    {
+        Token token = ++_token;
+
+        struct epoll_event event = {};
+        event.events = events;
+        event.data.u64 = token;
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, source->fd, &event) != 0)
+        {
+            CloseSource(*source);
+            throwex SystemException("Failed to register the reactor source!");
+        }
+
+        Locker<CriticalSection> locker(_cs);
+        _sources.emplace(token, std::move(source));
+        return token;
+    }
+
+    size_t Dispatch(Token token, Source& source, uint32_t events)
+    {
+        switch (source.type)
+        {
+            case SourceType::PIPE:
+            {
+                size_t dispatched = 0;
+
+                // Edge-triggered readiness requires to drain the pipe completely
+                size_t size;
+                while ((size = source.pipe->Read(_buffer.data(), _buffer.size())) > 0)
+                {
+                    source.pipe_handler(*source.pipe, _buffer.data(), size);
+                    ++dispatched;
+
+                    // The pipe might be removed by its handler
+                    if (source.fd < 0)
+                        return dispatched;
+                }
+
+                if (events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR))
+                {
+                    Pipe& pipe = *source.pipe;
+                    PipeHandler handler = std::move(source.pipe_handler);
+                    Remove(token);
+                    handler(pipe, _buffer.data(), 0);
+                    ++dispatched;
+                }
+
+                return dispatched;
+            }
+            case SourceType::PROCESS:
+            {
+                Process& process = *source.process;
+                ProcessHandler handler = std::move(source.process_handler);
+                Remove(token);
+                handler(process, process.Wait());
+                return 1;
+            }
+            case SourceType::TIMER:
+            {
+                Handler handler = std::move(source.handler);
+                Remove(token);
+                handler();
+                return 1;
+            }
+            case SourceType::PERIODIC_TIMER:
+            case SourceType::EVENT:
+            {
+                Consume(source.fd);
+                source.handler();
+                return 1;
+            }
+        }
+
+        return 0;
+    }
+
+    void CloseSource(Source& source)
+    {
+        if (source.owned && (source.fd >= 0))
+        {
+            int result = close(source.fd);
+            if (result != 0)
+                fatality(SystemException("Failed to close the reactor source!"));
+        }
+        source.fd = -1;
+    }
+
+    static void Notify(int fd)
+    {
+        uint64_t value = 1;
+        ssize_t result = write(fd, &value, sizeof(value));
+        (void)result;
+    }
+
+    static void Consume(int fd)
+    {
+        uint64_t value;
+        ssize_t result = read(fd, &value, sizeof(value));
+        (void)result;
+    }
+};
+
+#else
+
+class Reactor::Impl
+{
+public:
+    Impl(size_t) { throwex SystemException("Reactor is not supported by the current platform!"); }
+
+    size_t size() const noexcept { return 0; }
+    Token AddPipe(Pipe&, const PipeHandler&) { return 0; }
+    Token AddProcess(Process&, const ProcessHandler&) { return 0; }
+    Token AddTimer(const Timespan&, const Handler&, bool) { return 0; }
+    Token AddEvent(const Handler&) { return 0; }
+    bool Remove(Token) { return false; }
+    bool Signal(Token) { return false; }
+    size_t Poll(const Timespan&) { return 0; }
+    void Run() {}
+    void Stop() {}
+};
+
+#endif
+
+//! @endcond
+
+Reactor::Reactor(size_t buffer) : _pimpl(std::make_unique<Impl>(buffer))
+{
+}
+
+Reactor::~Reactor()
+{
+}
+
+size_t Reactor::size() const noexcept
+{
+    return _pimpl->size();
+}
+
+Reactor::Token Reactor::AddPipe(Pipe& pipe, const PipeHandler& handler)
+{
+    return _pimpl->AddPipe(pipe, handler);
+}
+
+Reactor::Token Reactor::AddProcess(Process& process, const ProcessHandler& handler)
+{
+    return _pimpl->AddProcess(process, handler);
+}
+
+Reactor::Token Reactor::AddTimer(const Timespan& timeout, const Handler& handler, bool periodic)
+{
+    return _pimpl->AddTimer(timeout, handler, periodic);
+}
+
+Reactor::Token Reactor::AddEvent(const Handler& handler)
+{
+    return _pimpl->AddEvent(handler);
+}
+
+bool Reactor::Remove(Token token)
+{
+    return _pimpl->Remove(token);
+}
+
+bool Reactor::Signal(Token token)
+{
+    return _pimpl->Signal(token);
+}
+
+size_t Reactor::Poll(const Timespan& timespan)
+{
+    return _pimpl->Poll(timespan);
+}
+
+void Reactor::Run()
+{
+    _pimpl->Run();
+}
+
+void Reactor::Stop()
+{
+    _pimpl->Stop();
+}
+
+} // namespace CppCommon
@@ -13,9 +13,18 @@
 
 #include <cassert>
 #include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
 
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/statfs.h>
+#include <sys/syscall.h>
+#endif
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
 #include <sys/mman.h>
+#include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
 #elif defined(_WIN32) || defined(_WIN64)
@@ -25,46 +34,217 @@
 namespace CppCommon {
 
 //! @cond INTERNALS
+namespace Internals {
+
+#if defined(__linux__)
+
+// Find the first hugetlbfs mount point and its huge page size
+std::string FindHugePagesMount(size_t& page)
+{
+    std::ifstream mounts("/proc/mounts");
+    std::string device, mount, type, options;
+    while (mounts >> device >> mount >> type >> options)
+    {
+        mounts.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        if (type != "hugetlbfs")
+            continue;
+
+        struct statfs stfs;
+        if ((statfs(mount.c_str(), &stfs) == 0) && (stfs.f_bsize > 0))
+        {
+            page = (size_t)stfs.f_bsize;
+            return mount;
+        }
+    }
+    return std::string();
+}
+
+#endif
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+
+// Pre-fault all pages of the mapped buffer by touching them
+void TouchPages(void* ptr, size_t size)
+{
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    volatile uint8_t* bytes = (volatile uint8_t*)ptr;
+    uint8_t sum = 0;
+    for (size_t offset = 0; offset < size; offset += page)
+        sum += bytes[offset];
+    (void)sum;
+}
+
+#endif
+
+} // namespace Internals
 
 class SharedMemory::Impl
 {
 public:
-    Impl(const std::string& name, size_t size)
+    Impl(const std::string& name, size_t size, const Flags<SharedMemoryFlags>& flags, int node)
     {
         assert(!name.empty() && "Shared memory buffer name must not be empty!");
         assert((size > 0) && "Shared memory buffer size must be greater than zero!");
 
-        size_t total = SHARED_MEMORY_HEADER_SIZE + size;
+        _total = SHARED_MEMORY_HEADER_SIZE + size;
+        _huge = false;
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-        _name = "/" + name;
-        _owner = true;
+        bool populate = (flags & SharedMemoryFlags::POPULATE) ? true : false;
+#if defined(__linux__)
+        // Pre-fault pages with the mapping only if they are not bound to the NUMA node later
+        int populate_flag = (populate && (node < 0)) ? MAP_POPULATE : 0;
 
-        // Try to create a shared memory handler
-        _shared = shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
-        if (_shared == -1)
+        // Try to create or open the shared memory buffer in the hugetlbfs mount
+        size_t page = 0;
+        std::string mount = (flags & SharedMemoryFlags::HUGE_PAGES) ? Internals::FindHugePagesMount(page) : std::string();
+        if (!mount.empty())
         {
-            // Try to open a shared memory handler
-            _shared = shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
+            _name = mount + "/" + name;
+            _owner = true;
+
+            _shared = open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC), (S_IRUSR | S_IWUSR));
             if (_shared == -1)
-                throwex SystemException("Failed to create or open a shared memory handler!");
-            else
+            {
+                // Missing huge pages file means the owner has fallen back to the regular shared memory
+                _shared = open(_name.c_str(), (O_RDWR | O_CLOEXEC));
+                if ((_shared == -1) && (errno != ENOENT))
+                    throwex SystemException("Failed to create or open a huge pages shared memory handler!");
                 _owner = false;
+            }
+
+            // Huge pages file size must be a multiple of the huge page size
+            size_t total = ((_total + page - 1) / page) * page;
+            if (_owner)
+            {
+                if (ftruncate(_shared, total) == 0)
+                {
+                    _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), (MAP_SHARED | populate_flag), _shared, 0);
+                    if (_ptr != MAP_FAILED)
+                    {
+                        _total = total;
+                        _huge = true;
+                    }
+                }
+
+                // Fall back to the regular shared memory if there are no free huge pages
+                if (!_huge)
+                {
+                    close(_shared);
+                    unlink(_name.c_str());
+                }
+            }
+            else if (_shared != -1)
+            {
+                // Unlinked huge pages file means the owner has fallen back to the regular shared memory
+                struct stat status;
+                if (fstat(_shared, &status) != 0)
+                {
+                    int error = errno;
+                    close(_shared);
+                    throwex SystemException("Failed to get the huge pages shared memory handler status!", error);
+                }
+                if (status.st_nlink > 0)
+                {
+                    // Attach to the huge pages of the owner without a separate fallback segment
+                    _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), (MAP_SHARED | populate_flag), _shared, 0);
+                    if (_ptr == MAP_FAILED)
+                    {
+                        int error = errno;
+                        close(_shared);
+                        throwex SystemException("Failed to map a huge pages shared memory buffer!", error);
+                    }
+                    _total = total;
+                    _huge = true;
+                }
+                else
+                    close(_shared);
+            }
         }
-        else
+#else
+        int populate_flag = 0;
+#endif
+        if (!_huge)
         {
-            // Truncate a shared memory handler
-            int result = ftruncate(_shared, total);
-            if (result != 0)
-                throwex SystemException("Failed to truncate a shared memory handler!");
+            _name = "/" + name;
+            _owner = true;
+
+            // Try to create a shared memory handler
+            _shared = shm_open(_name.c_str(), (O_CREAT | O_EXCL | O_RDWR), (S_IRUSR | S_IWUSR));
+            if (_shared == -1)
+            {
+                // Try to open a shared memory handler
+                _shared = shm_open(_name.c_str(), (O_CREAT | O_RDWR), (S_IRUSR | S_IWUSR));
+                if (_shared == -1)
+                    throwex SystemException("Failed to create or open a shared memory handler!");
+                else
+                    _owner = false;
+            }
+            else
+            {
+                // Truncate a shared memory handler
+                int result = ftruncate(_shared, _total);
+                if (result != 0)
+                    throwex SystemException("Failed to truncate a shared memory handler!");
+            }
+
+            // Map a shared memory buffer
+            _ptr = mmap(nullptr, _total, (PROT_READ | PROT_WRITE), (MAP_SHARED | populate_flag), _shared, 0);
+            if (_ptr == MAP_FAILED)
+            {
+                close(_shared);
+                shm_unlink(_name.c_str());
+                throwex SystemException("Failed to map a shared memory buffer!");
+            }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+            // Ask for transparent huge pages if hugetlbfs is not available
+            if (flags & SharedMemoryFlags::HUGE_PAGES)
+                madvise(_ptr, _total, MADV_HUGEPAGE);
+#endif
         }
 
-        // Map a shared memory buffer
-        _ptr = mmap(nullptr, total, (PROT_READ | PROT_WRITE), MAP_SHARED, _shared, 0);
-        if (_ptr == MAP_FAILED)
+        auto cleanup = [this]()
         {
+            munmap(_ptr, _total);
             close(_shared);
-            shm_unlink(_name.c_str());
-            throwex SystemException("Failed to map a shared memory buffer!");
+            if (_owner)
+            {
+                if (_huge)
+                    unlink(_name.c_str());
+                else
+                    shm_unlink(_name.c_str());
+            }
+        };
+
+#if defined(__linux__)
+        // Bind the shared memory pages to the NUMA node
+        if (node >= 0)
+        {
+            const size_t bits = 8 * sizeof(unsigned long);
+            std::vector<unsigned long> mask((node / bits) + 1, 0);
+            mask[node / bits] = 1ul << (node % bits);
+            long result = syscall(SYS_mbind, _ptr, _total, MPOL_BIND, mask.data(), mask.size() * bits + 1, MPOL_MF_MOVE);
+            if (result != 0)
+            {
+                int error = errno;
+                cleanup();
+                throwex SystemException("Failed to bind a shared memory buffer to the NUMA node!", error);
+            }
+        }
+#endif
+
+        // Pre-fault pages which were not populated with the mapping
+        if (populate && (populate_flag == 0))
+            Internals::TouchPages(_ptr, _total);
+
+        // Lock the shared memory pages in RAM
+        if (flags & SharedMemoryFlags::LOCK)
+        {
+            if (mlock(_ptr, _total) != 0)
+            {
+                cleanup();
+                throwex SystemException("Failed to lock a shared memory buffer in RAM!");
+            }
         }
 #elif defined(_WIN32) || defined(_WIN64)
         _name = "Global\\" + name;
@@ -74,8 +254,25 @@ public:
         _shared = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, _name.c_str());
         if (_shared == nullptr)
         {
+            DWORD dwNode = (node >= 0) ? (DWORD)node : NUMA_NO_PREFERRED_NODE;
+
+            // Try to create a large pages shared memory handler (requires SeLockMemoryPrivilege)
+            SIZE_T page = GetLargePageMinimum();
+            if ((flags & SharedMemoryFlags::HUGE_PAGES) && (page > 0))
+            {
+                ULARGE_INTEGER total;
+                total.QuadPart = ((_total + page - 1) / page) * page;
+                _shared = CreateFileMappingNumaA(INVALID_HANDLE_VALUE, nullptr, (PAGE_READWRITE | SEC_COMMIT | SEC_LARGE_PAGES), total.HighPart, total.LowPart, _name.c_str(), dwNode);
+                if (_shared != nullptr)
+                {
+                    _total = (size_t)total.QuadPart;
+                    _huge = true;
+                }
+            }
+
             // Try to create a shared memory handler
-            _shared = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)total, _name.c_str());
+            if (_shared == nullptr)
+                _shared = CreateFileMappingNumaA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, (DWORD)_total, _name.c_str(), dwNode);
             if (_shared == nullptr)
                 throwex SystemException("Failed to create or open a shared memory handler!");
             else
@@ -83,12 +280,33 @@ public:
         }
 
         // Map a shared memory buffer
-        _ptr = MapViewOfFile(_shared, FILE_MAP_ALL_ACCESS, 0, 0, total);
+        if (node >= 0)
+            _ptr = MapViewOfFileExNuma(_shared, FILE_MAP_ALL_ACCESS, 0, 0, _total, nullptr, (DWORD)node);
+        else
+            _ptr = MapViewOfFile(_shared, FILE_MAP_ALL_ACCESS, 0, 0, _total);
         if (_ptr == nullptr)
         {
             CloseHandle(_shared);
             throwex SystemException("Failed to map a shared memory buffer!");
         }
+
+        // Pre-fault the shared memory pages
+        if (flags & SharedMemoryFlags::POPULATE)
+        {
+            WIN32_MEMORY_RANGE_ENTRY range = { _ptr, _total };
+            PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+        }
+
+        // Lock the shared memory pages in RAM
+        if (flags & SharedMemoryFlags::LOCK)
+        {
+            if (!VirtualLock(_ptr, _total))
+            {
+                UnmapViewOfFile(_ptr);
+                CloseHandle(_shared);
+                throwex SystemException("Failed to lock a shared memory buffer in RAM!");
+            }
+        }
 #endif
         static const char* SHARED_MEMORY_HEADER_PREFIX = "SHMM";
 
@@ -107,7 +325,7 @@ public:
             if (!is_valid_prefix || !is_valid_size)
             {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-                munmap(_ptr, total);
+                munmap(_ptr, _total);
                 close(_shared);
 #elif defined(_WIN32) || defined(_WIN64)
                 UnmapViewOfFile(_ptr);
@@ -125,8 +343,7 @@ public:
     {
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
         // Unmap the shared memory buffer
-        size_t total = ((SharedMemoryHeader*)_ptr)->size + SHARED_MEMORY_HEADER_SIZE;
-        int result = munmap(_ptr, total);
+        int result = munmap(_ptr, _total);
         if (result != 0)
             fatality(SystemException("Failed to unmap a shared memory buffer!"));
 
@@ -138,7 +355,7 @@ public:
         // Unlink the shared memory handler (owner only)
         if (_owner)
         {
-            result = shm_unlink(_name.c_str());
+            result = _huge ? unlink(_name.c_str()) : shm_unlink(_name.c_str());
             if (result != 0)
                 fatality(SystemException("Failed to unlink a shared memory handler!"));
         }
@@ -154,8 +371,9 @@ public:
     }
 
     void* ptr() { return (uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
-    const void* ptr() const { return _ptr; }
+    const void* ptr() const { return (const uint8_t*)_ptr + SHARED_MEMORY_HEADER_SIZE; }
     bool owner() const { return _owner; }
+    bool huge() const { return _huge; }
 
 private:
     // Shared memory header size
@@ -179,12 +397,14 @@ private:
     HANDLE _shared;
 #endif
     void* _ptr;
+    size_t _total;
     bool _owner;
+    bool _huge;
 };
 
 //! @endcond
 
-SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name), _size(size)
+SharedMemory::SharedMemory(const std::string& name, size_t size, const Flags<SharedMemoryFlags>& flags, int node) : _name(name), _size(size), _flags(flags), _node(node)
 {
     // Check implementation storage parameters
     [[maybe_unused]] ValidateAlignedStorage<sizeof(Impl), alignof(Impl), StorageSize, StorageAlign> _;
@@ -192,7 +412,7 @@ SharedMemory::SharedMemory(const std::string& name, size_t size) : _name(name),
     static_assert(((StorageAlign % alignof(Impl)) == 0), "SharedMemory::StorageAlign must be adjusted!");
 
     // Create the implementation instance
-    new(&_storage)Impl(name, size);
+    new(&_storage)Impl(name, size, flags, node);
 }
 
 SharedMemory::~SharedMemory()
@@ -204,5 +424,6 @@ SharedMemory::~SharedMemory()
 void* SharedMemory::ptr() { return impl().ptr(); }
 const void* SharedMemory::ptr() const { return impl().ptr(); }
 bool SharedMemory::owner() const { return impl().owner(); }
+bool SharedMemory::huge() const { return impl().huge(); }
 
 } // namespace CppCommon
@@ -0,0 +1,326 @@
+/*!
+    \file async_writer.cpp
+    \brief Asynchronous buffered writer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/async_writer.h"
+
+#include "errors/exceptions.h"
+#include "threads/thread.h"
+
+#include <algorithm>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+        result <<= 1;
+    return result;
+}
+
+} // namespace Internals
+//! @endcond
+
+AsyncWriter::AsyncWriter(Writer& writer, size_t capacity, AsyncWriterPolicy policy)
+    : _writer(writer), _policy(policy), _buffer(Internals::RoundUpToPowerOfTwo(std::max(capacity, (size_t)2))),
+      _stop(false), _sleeping(false), _blocking(false), _waiting(0),
+      _accepted(0), _processed(0), _flush_target(0), _flush_requested(0), _flush_completed(0),
+      _written(0), _dropped(0), _writes(0)
+{
+    // Batch buffer of the ring buffer capacity dequeues all available data at once
+    _batch.resize(_buffer.capacity());
+
+    // Start the background thread
+    _thread = Thread::Start([this]() { Consume(); });
+}
+
+AsyncWriter::~AsyncWriter()
+{
+    Stop();
+}
+
+uint64_t AsyncWriter::written() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _written;
+}
+
+uint64_t AsyncWriter::dropped() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _dropped;
+}
+
+uint64_t AsyncWriter::writes() const
+{
+    Locker<CriticalSection> locker(_cs);
+    return _writes;
+}
+
+size_t AsyncWriter::Write(const void* buffer, size_t size)
+{
+    if ((buffer == nullptr) || (size == 0))
+        return 0;
+
+    const uint8_t* bytes = (const uint8_t*)buffer;
+
+    Locker<CriticalSection> locker(_cs);
+
+    // Wait for the blocked writer to keep buffers from interleaving
+    if (_blocking)
+    {
+        ++_waiting;
+        _producers.Wait(_cs, [this]() { return (!_blocking || _stop); });
+        --_waiting;
+    }
+
+    // Drop buffers after the writer was closed or the underlying writer failed
+    if (_stop || _error)
+    {
+        _dropped += size;
+        return 0;
+    }
+
+    if (_policy == AsyncWriterPolicy::DROP)
+    {
+        // Drop the whole buffer to keep the written data consistent
+        if ((size > (_buffer.capacity() - _buffer.size())) || !_buffer.Enqueue(bytes, size))
+        {
+            _dropped += size;
+            return 0;
+        }
+    }
+    else
+    {
+        // Buffers larger than the ring buffer capacity are enqueued by chunks
+        size_t offset = 0;
+        while (offset < size)
+        {
+            size_t chunk = std::min(size - offset, _buffer.capacity());
+
+            // Once the overflow list is used all further buffers go there to keep the write order
+            if (_overflow.empty() && _buffer.Enqueue(bytes + offset, chunk))
+            {
+                offset += chunk;
+                continue;
+            }
+
+            if (_policy == AsyncWriterPolicy::EXPAND)
+            {
+                _overflow.emplace_back(bytes + offset, bytes + size);
+                break;
+            }
+
+            // Wake up the background thread and wait for the free space
+            if (_sleeping)
+                _consumer.NotifyOne();
+            _blocking = true;
+            ++_waiting;
+            _producers.Wait(_cs, [this, chunk]() { return (((_buffer.capacity() - _buffer.size()) >= chunk) || _stop || _error); });
+            --_waiting;
+            _blocking = false;
+            if (_waiting > 0)
+                _producers.NotifyAll();
+
+            if (_stop || _error)
+            {
+                _accepted += offset;
+                _dropped += size - offset;
+                if (_sleeping)
+                    _consumer.NotifyOne();
+                return offset;
+            }
+        }
+    }
+
+    _accepted += size;
+
+    // Wake up the background thread only if it sleeps
+    if (_sleeping)
+        _consumer.NotifyOne();
+
+    return size;
+}
+
+void AsyncWriter::Flush()
+{
+    Locker<CriticalSection> locker(_cs);
+
+    if (!_stop)
+    {
+        // Flush barrier covers all buffers accepted before the request
+        uint64_t request = ++_flush_requested;
+        _flush_target = _accepted;
+        if (_sleeping)
+            _consumer.NotifyOne();
+
+        ++_waiting;
+        _producers.Wait(_cs, [this, request]() { return (_flush_completed >= request); });
+        --_waiting;
+    }
+
+    if (_error)
+        std::rethrow_exception(_error);
+}
+
+void AsyncWriter::Close()
+{
+    Stop();
+
+    Locker<CriticalSection> locker(_cs);
+    if (_error)
+        std::rethrow_exception(_error);
+}
+
+void AsyncWriter::Stop()
+{
+    {
+        Locker<CriticalSection> locker(_cs);
+        if (_stop)
+            return;
+
+        _stop = true;
+        _consumer.NotifyOne();
+        _producers.NotifyAll();
+    }
+
+    // The background thread drains all accepted buffers before exit
+    _thread.join();
+
+    try
+    {
+        if (!_error)
+            _writer.Flush();
+    }
+    catch (...)
+    {
+        Locker<CriticalSection> locker(_cs);
+        _error = std::current_exception();
+    }
+}
+
+void AsyncWriter::Consume()
+{
+    for (;;)
+    {
+        // Coalesce all data available in the ring buffer into a single write
+        size_t size = _batch.size();
+        if (_buffer.Dequeue(_batch.data(), size))
+        {
+            uint64_t flush = Process(_batch.data(), size);
+            if (flush > 0)
+                Complete(flush);
+            continue;
+        }
+
+        std::vector<std::vector<uint8_t>> overflow;
+        uint64_t flush = 0;
+        {
+            Locker<CriticalSection> locker(_cs);
+
+            // Wait for new buffers, flush request or stop
+            _sleeping = true;
+            _consumer.Wait(_cs, [this]() { return (!_buffer.empty() || !_overflow.empty() || (_flush_completed < _flush_requested) || _stop); });
+            _sleeping = false;
+
+            if (!_buffer.empty())
+                continue;
+
+            // Overflow buffers are newer than all buffers in the ring buffer
+            if (!_overflow.empty())
+                overflow.swap(_overflow);
+            else if (_flush_completed < _flush_requested)
+                flush = _flush_requested;
+            else
+                return;
+        }
+
+        for (const auto& buffer : overflow)
+        {
+            uint64_t reached = Process(buffer.data(), buffer.size());
+            if (reached > 0)
+                flush = reached;
+        }
+
+        if (flush > 0)
+            Complete(flush);
+    }
+}
+
+uint64_t AsyncWriter::Process(const uint8_t* buffer, size_t size)
+{
+    // The error is changed only by the background thread
+    std::exception_ptr error;
+    if (!_error)
+    {
+        try
+        {
+            size_t written = 0;
+            while (written < size)
+            {
+                size_t result = _writer.Write(buffer + written, size - written);
+                if (result == 0)
+                    throwex RuntimeException("Cannot write into the underlying writer!");
+                written += result;
+            }
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    Locker<CriticalSection> locker(_cs);
+
+    if (error)
+        _error = error;
+    if (_error)
+        _dropped += size;
+    else
+    {
+        _written += size;
+        ++_writes;
+    }
+    _processed += size;
+
+    // Wake up writers blocked by the full ring buffer
+    if (_waiting > 0)
+        _producers.NotifyAll();
+
+    // Flush barrier is reached when all buffers accepted before the latest request are processed
+    return ((_flush_completed < _flush_requested) && (_processed >= _flush_target)) ? _flush_requested : 0;
+}
+
+void AsyncWriter::Complete(uint64_t request)
+{
+    std::exception_ptr error;
+    if (!_error)
+    {
+        try
+        {
+            _writer.Flush();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+    }
+
+    Locker<CriticalSection> locker(_cs);
+
+    if (error)
+        _error = error;
+    _flush_completed = std::max(_flush_completed, request);
+    if (_waiting > 0)
+        _producers.NotifyAll();
+}
+
+} // namespace CppCommon
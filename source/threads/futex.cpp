@@ -0,0 +1,81 @@
+/*!
+    \file futex.cpp
+    \brief Process-shared futex wait/wake primitive implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/futex.h"
+
+#include "threads/thread.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <cerrno>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+namespace Internals {
+
+#if !defined(__linux__)
+// Polling interval of the futex emulation
+const int64_t FUTEX_POLLING_INTERVAL = 100000;
+#endif
+
+} // namespace Internals
+//! @endcond
+
+void Futex::Wait(std::atomic<uint32_t>& word, uint32_t expected) noexcept
+{
+#if defined(__linux__)
+    // Process-shared futex, so FUTEX_PRIVATE_FLAG is not used
+    syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAIT, expected, nullptr, nullptr, 0);
+#else
+    if (word.load(std::memory_order_acquire) == expected)
+        Thread::SleepFor(Timespan(Internals::FUTEX_POLLING_INTERVAL));
+#endif
+}
+
+bool Futex::TryWaitFor(std::atomic<uint32_t>& word, uint32_t expected, const Timespan& timespan) noexcept
+{
+    if (timespan < 0)
+        return false;
+
+#if defined(__linux__)
+    struct timespec timeout;
+    timeout.tv_sec = timespan.seconds();
+    timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
+
+    int result = (int)syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAIT, expected, &timeout, nullptr, 0);
+    return !((result != 0) && (errno == ETIMEDOUT));
+#else
+    if (word.load(std::memory_order_acquire) != expected)
+        return true;
+    Thread::SleepFor(Timespan(std::min(timespan.total(), Internals::FUTEX_POLLING_INTERVAL)));
+    return (timespan.total() > Internals::FUTEX_POLLING_INTERVAL);
+#endif
+}
+
+void Futex::WakeOne(std::atomic<uint32_t>& word) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+void Futex::WakeAll(std::atomic<uint32_t>& word) noexcept
+{
+#if defined(__linux__)
+    syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+} // namespace CppCommon
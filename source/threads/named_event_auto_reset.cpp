@@ -15,7 +15,8 @@
 
 #if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
 #include "system/shared_type.h"
-#include <pthread.h>
+#include "threads/futex.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef max
@@ -37,39 +38,9 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should initializate a named auto-reset event
-        if (_shared.owner())
-        {
-            pthread_mutexattr_t mutex_attribute;
-            int result = pthread_mutexattr_init(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a mutex attribute for the named auto-reset event!", result);
-            result = pthread_mutexattr_setpshared(&mutex_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a mutex process shared attribute for the named auto-reset event!", result);
-            result = pthread_mutex_init(&_shared->mutex, &mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a mutex for the named auto-reset event!", result);
-            result = pthread_mutexattr_destroy(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a mutex attribute for the named auto-reset event!", result);
-
-            pthread_condattr_t cond_attribute;
-            result = pthread_condattr_init(&cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a conditional variable attribute for the named auto-reset event!", result);
-            result = pthread_condattr_setpshared(&cond_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a conditional variable process shared attribute for the named auto-reset event!", result);
-            result = pthread_cond_init(&_shared->cond, &cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a conditional variable for the named auto-reset event!", result);
-            result = pthread_condattr_destroy(&cond_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a conditional variable attribute for the named auto-reset event!", result);
-
-            _shared->signaled = signaled ? 1 : 0;
-        }
+        // New shared memory block is filled with zeros, so only the signaled state should be initialized
+        if (_shared.owner() && signaled)
+            _shared->signaled.store(1, std::memory_order_release);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _event = CreateEventA(nullptr, FALSE, signaled ? TRUE : FALSE, name.c_str());
         if (_event == nullptr)
@@ -82,16 +53,7 @@ public:
 #if defined(__APPLE__)
         fatality(SystemException("Named auto-reset event is not supported!"));
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should destroy a named auto-reset event
-        if (_shared.owner())
-        {
-            int result = pthread_mutex_destroy(&_shared->mutex);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a mutex for the named auto-reset event!", result));
-            result = pthread_cond_destroy(&_shared->cond);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a conditional variable for the named auto-reset event!", result));
-        }
+        // Nothing to destroy, the named auto-reset event state lives in the shared memory block
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_event))
             fatality(SystemException("Failed to close a named auto-reset event!"));
@@ -108,16 +70,9 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the named auto-reset event!", result);
-        ++_shared->signaled;
-        result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the named auto-reset event!", result);
-        result = pthread_cond_signal(&_shared->cond);
-        if (result != 0)
-            throwex SystemException("Failed to signal a named auto-reset event!", result);
+        _shared->signaled.fetch_add(1);
+        if (_shared->waiters.load() > 0)
+            Futex::WakeOne(_shared->signaled);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!SetEvent(_event))
             throwex SystemException("Failed to signal a named auto-reset event!");
@@ -129,15 +84,13 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the named auto-reset event!", result);
-        bool signaled = (_shared->signaled-- > 0);
-        _shared->signaled = (_shared->signaled < 0) ? 0 : _shared->signaled;
-        result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the named auto-reset event!", result);
-        return signaled;
+        uint32_t signaled = _shared->signaled.load(std::memory_order_relaxed);
+        while (signaled > 0)
+        {
+            if (_shared->signaled.compare_exchange_weak(signaled, signaled - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_event, 0);
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -153,26 +106,25 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the named auto-reset event!", result);
-        bool signaled = true;
-        while (!_shared->signaled)
+        if (TryWait())
+            return true;
+
+        uint64_t deadline = Timestamp::nano() + timespan.total();
+        for (;;)
         {
-            result = pthread_cond_timedwait(&_shared->cond, &_shared->mutex, &timeout);
-            if ((result != 0) && (result != ETIMEDOUT))
-                throwex SystemException("Failed to timeout waiting a conditional variable for the named auto-reset event!", result);
-            if (result == ETIMEDOUT)
-                signaled = (_shared->signaled > 0);
+            uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+                return false;
+
+            // Register the waiter and check the event again to avoid lost wake ups
+            _shared->waiters.fetch_add(1);
+            if (_shared->signaled.load() == 0)
+                Futex::TryWaitFor(_shared->signaled, 0, Timespan(deadline - current));
+            _shared->waiters.fetch_sub(1);
+
+            if (TryWait())
+                return true;
         }
-        _shared->signaled = (_shared->signaled > 0) ? (_shared->signaled - 1) : 0;
-        result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the named auto-reset event!", result);
-        return signaled;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_event, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -186,19 +138,14 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named auto-reset event is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a mutex for the named auto-reset event!", result);
-        while (!_shared->signaled)
+        while (!TryWait())
         {
-            result = pthread_cond_wait(&_shared->cond, &_shared->mutex);
-            if (result != 0)
-                throwex SystemException("Failed to waiting a conditional variable for the named auto-reset event!", result);
+            // Register the waiter and check the event again to avoid lost wake ups
+            _shared->waiters.fetch_add(1);
+            if (_shared->signaled.load() == 0)
+                Futex::Wait(_shared->signaled, 0);
+            _shared->waiters.fetch_sub(1);
         }
-        _shared->signaled = (_shared->signaled > 0) ? (_shared->signaled - 1) : 0;
-        result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a mutex for the named auto-reset event!", result);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_event, INFINITE);
         if (result != WAIT_OBJECT_0)
@@ -212,9 +159,10 @@ private:
     // Shared auto-reset event structure
     struct EventHeader
     {
-        pthread_mutex_t mutex;
-        pthread_cond_t cond;
-        int signaled;
+        // Count of signals
+        std::atomic<uint32_t> signaled;
+        // Count of waiting threads
+        std::atomic<uint32_t> waiters;
     };
 
     // Shared auto-reset event structure wrapper
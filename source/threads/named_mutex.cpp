@@ -17,8 +17,10 @@
 #include "threads/thread.h"
 #endif
 #if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+#include "system/process.h"
 #include "system/shared_type.h"
-#include <pthread.h>
+#include "threads/futex.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef max
@@ -34,29 +36,16 @@ class NamedMutex::Impl
 public:
     Impl(const std::string& name) : _name(name)
 #if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
-        , _shared(name)
+        , _shared(name), _pid((uint32_t)Process::CurrentProcessId())
 #endif
+        , _owner_dead(false)
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should initializate a named mutex
-        if (_shared.owner())
-        {
-            pthread_mutexattr_t mutex_attribute;
-            int result = pthread_mutexattr_init(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a named mutex attribute!", result);
-            result = pthread_mutexattr_setpshared(&mutex_attribute, PTHREAD_PROCESS_SHARED);
-            if (result != 0)
-                throwex SystemException("Failed to set a named mutex process shared attribute!", result);
-            result = pthread_mutex_init(&_shared->mutex, &mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to initialize a named mutex!", result);
-            result = pthread_mutexattr_destroy(&mutex_attribute);
-            if (result != 0)
-                throwex SystemException("Failed to destroy a named mutex attribute!", result);
-        }
+        // New shared memory block is filled with zeros, so the named mutex is created unlocked
+        if ((Process::CurrentProcessId() & ~(uint64_t)OWNER_MASK) != 0)
+            throwex SystemException("Current process Id does not fit into the named mutex state!");
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _mutex = CreateMutexA(nullptr, FALSE, name.c_str());
         if (_mutex == nullptr)
@@ -69,13 +58,7 @@ public:
 #if defined(__APPLE__)
         fatality(SystemException("Named mutex is not supported!"));
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        // Only the owner should destroy a named mutex
-        if (_shared.owner())
-        {
-            int result = pthread_mutex_destroy(&_shared->mutex);
-            if (result != 0)
-                fatality(SystemException("Failed to destroy a named mutex!", result));
-        }
+        // Nothing to destroy, the named mutex state lives in the shared memory block
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!CloseHandle(_mutex))
             fatality(SystemException("Failed to close a named mutex!"));
@@ -92,15 +75,18 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_trylock(&_shared->mutex);
-        if ((result != 0) && (result != EAGAIN) && (result != EBUSY) && (result != EDEADLK))
-            throwex SystemException("Failed to try lock a named mutex!", result);
-        return (result == 0);
+        uint32_t state = 0;
+        if (_shared->state.compare_exchange_strong(state, _pid, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            _owner_dead = false;
+            return true;
+        }
+        return Recover();
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_mutex, 0);
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
+        if ((result != WAIT_OBJECT_0) && (result != WAIT_ABANDONED) && (result != WAIT_TIMEOUT))
             throwex SystemException("Failed to try lock a named mutex!");
-        return (result == WAIT_OBJECT_0);
+        return Acquired(result);
 #endif
     }
 
@@ -111,18 +97,29 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = pthread_mutex_timedlock(&_shared->mutex, &timeout);
-        if ((result != 0) && (result != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a named mutex for the given timeout!", result);
-        return (result == 0);
+        if (TryLock())
+            return true;
+
+        uint64_t deadline = Timestamp::nano() + timespan.total();
+        for (;;)
+        {
+            uint32_t state;
+            if (Contend(state))
+                return true;
+
+            uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+                return false;
+
+            // Check the mutex owner process periodically while waiting
+            if (!Futex::TryWaitFor(_shared->state, state, Timespan(std::min(deadline - current, (uint64_t)RECOVERY_INTERVAL))) && Recover())
+                return true;
+        }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_mutex, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
-        if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
+        if ((result != WAIT_OBJECT_0) && (result != WAIT_ABANDONED) && (result != WAIT_TIMEOUT))
             throwex SystemException("Failed to try lock a named mutex for the given timeout!");
-        return (result == WAIT_OBJECT_0);
+        return Acquired(result);
 #endif
     }
 
@@ -131,24 +128,42 @@ public:
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_lock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to lock a named mutex!", result);
+        uint32_t state = 0;
+        if (_shared->state.compare_exchange_strong(state, _pid, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            _owner_dead = false;
+            return;
+        }
+
+        for (;;)
+        {
+            if (Contend(state))
+                return;
+
+            // Check the mutex owner process periodically while waiting
+            if (!Futex::TryWaitFor(_shared->state, state, Timespan(RECOVERY_INTERVAL)) && Recover())
+                return;
+        }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_mutex, INFINITE);
-        if (result != WAIT_OBJECT_0)
+        if ((result != WAIT_OBJECT_0) && (result != WAIT_ABANDONED))
             throwex SystemException("Failed to lock a named mutex!");
+        Acquired(result);
 #endif
     }
 
+    bool IsOwnerDead() const noexcept
+    {
+        return _owner_dead;
+    }
+
     void Unlock()
     {
 #if defined(__APPLE__)
         throwex SystemException("Named mutex is not supported!");
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        int result = pthread_mutex_unlock(&_shared->mutex);
-        if (result != 0)
-            throwex SystemException("Failed to unlock a named mutex!", result);
+        if ((_shared->state.exchange(0, std::memory_order_release) & WAITERS) != 0)
+            Futex::WakeOne(_shared->state);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!ReleaseMutex(_mutex))
             throwex SystemException("Failed to unlock a named mutex!");
@@ -158,17 +173,77 @@ public:
 private:
     std::string _name;
 #if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+    // Interval to check if the mutex owner process is still alive (in nanoseconds)
+    static const uint64_t RECOVERY_INTERVAL = 100000000;
+
+    // Mutex state: 0 - unlocked, otherwise the owner process Id with the optional waiters flag.
+    // Owner is stored together with the lock in the same atomic word, so the locked mutex
+    // always has a known owner process even if it dies right after the lock.
+    static const uint32_t OWNER_MASK = 0x7FFFFFFF;
+    static const uint32_t WAITERS = 0x80000000;
+
     // Shared mutex structure
     struct MutexHeader
     {
-        pthread_mutex_t mutex;
+        std::atomic<uint32_t> state;
     };
 
     // Shared mutex structure wrapper
     SharedType<MutexHeader> _shared;
+    uint32_t _pid;
+
+    // Try to acquire the contended mutex or mark it as contended before waiting
+    bool Contend(uint32_t& state)
+    {
+        state = _shared->state.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            // Other processes might wait for the mutex, so keep the waiters flag to wake them up on unlock
+            if (state == 0)
+            {
+                if (_shared->state.compare_exchange_weak(state, _pid | WAITERS, std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    _owner_dead = false;
+                    return true;
+                }
+            }
+            else if ((state & WAITERS) != 0)
+                return false;
+            else if (_shared->state.compare_exchange_weak(state, state | WAITERS, std::memory_order_relaxed))
+            {
+                state |= WAITERS;
+                return false;
+            }
+        }
+    }
+
+    // Take over the mutex locked by a dead process
+    bool Recover()
+    {
+        uint32_t state = _shared->state.load(std::memory_order_relaxed);
+        uint32_t owner = state & OWNER_MASK;
+        if ((owner == 0) || (owner == _pid) || Process::IsProcessRunning(owner))
+            return false;
+        if (!_shared->state.compare_exchange_strong(state, _pid | WAITERS, std::memory_order_acquire, std::memory_order_relaxed))
+            return false;
+
+        _owner_dead = true;
+        return true;
+    }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _mutex;
+
+    // Check the wait result and remember if the mutex was abandoned by its owner
+    bool Acquired(DWORD result)
+    {
+        if (result == WAIT_TIMEOUT)
+            return false;
+
+        _owner_dead = (result == WAIT_ABANDONED);
+        return true;
+    }
 #endif
+    bool _owner_dead;
 };
 
 //! @endcond
@@ -195,6 +270,8 @@ const std::string& NamedMutex::name() const { return impl().name(); }
 bool NamedMutex::TryLock() { return impl().TryLock(); }
 bool NamedMutex::TryLockFor(const Timespan& timespan) { return impl().TryLockFor(timespan); }
 
+bool NamedMutex::IsOwnerDead() const noexcept { return impl().IsOwnerDead(); }
+
 void NamedMutex::Lock() { impl().Lock(); }
 void NamedMutex::Unlock() { impl().Unlock(); }
 
@@ -13,9 +13,13 @@
 #include "threads/thread.h"
 #include "utility/validate_aligned_storage.h"
 
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
 #include <fcntl.h>
 #include <semaphore.h>
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+#include "system/process.h"
+#include "threads/futex.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef Yield
@@ -99,12 +103,16 @@ class NamedRWLock::Impl
     const uint32_t LOCK_EXCLUSIVE_MASK = (LOCK_EXCLUSIVE_WAKING | (LOCK_EXCLUSIVE_WAITERS_MASK << LOCK_EXCLUSIVE_WAITERS_SHIFT));
 
 public:
-    Impl(const std::string& name, uint32_t spin) : _value(name), _spin(spin)
+    Impl(const std::string& name, uint32_t spin) : _value(name),
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+        _wake(name + "_wake"), _pid(Process::CurrentProcessId()), _exclusive_wake(&_wake->exclusive_wake), _shared_wake(&_wake->shared_wake),
+#endif
+        _spin(spin)
     {
         // Owner of the read/write lock should initialize its value
         if (_value.owner())
             *_value = 0;
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         if (_value.owner())
         {
             _exclusive_wake = sem_open((this->name() + "_exclusive").c_str(), (O_CREAT | O_EXCL), 0666, 0);
@@ -123,6 +131,8 @@ public:
             if (_shared_wake == SEM_FAILED)
                 throwex SystemException("Failed to open an shared wake semaphore for the named read/write lock!");
         }
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        // New shared memory block is filled with zeros, so wake counters are initialized
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _exclusive_wake = CreateSemaphoreA(nullptr, 0, MAXLONG, (this->name() + "_exclusive").c_str());
         if (_exclusive_wake == nullptr)
@@ -135,7 +145,7 @@ public:
 
     ~Impl()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         int result = sem_close(_exclusive_wake);
         if (result != 0)
             fatality(SystemException("Failed to close an exclusive wake semaphore for the named read/write lock"));
@@ -200,7 +210,10 @@ public:
             return false;
 
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-        return __sync_bool_compare_and_swap(_value.ptr(), value, value + LOCK_OWNED);
+        if (!__sync_bool_compare_and_swap(_value.ptr(), value, value + LOCK_OWNED))
+            return false;
+        SetWriter(true);
+        return true;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         return (InterlockedCompareExchange(_value.ptr(), value + LOCK_OWNED, value) == value);
 #endif
@@ -218,10 +231,14 @@ public:
 
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
             if (__sync_bool_compare_and_swap(_value.ptr(), value, value - LOCK_SHARED_OWNERS_INC))
+            {
+                SetWriter(true);
+                return true;
+            }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
             if (InterlockedCompareExchange(_value.ptr(), value - LOCK_SHARED_OWNERS_INC, value) == value)
-#endif
                 return true;
+#endif
         }
     }
 
@@ -266,9 +283,7 @@ public:
                 {
                     // Go to sleep
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                    int result = sem_wait(_shared_wake);
-                    if (result != 0)
-                        throwex SystemException("Failed to wait for a shared wake semaphore for the named read/write lock!");
+                    Sleep(_shared_wake);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                     DWORD result = WaitForSingleObject(_shared_wake, INFINITE);
                     if (result != WAIT_OBJECT_0)
@@ -317,9 +332,7 @@ public:
 #endif
                 {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                    int result = sem_wait(_exclusive_wake);
-                    if (result != 0)
-                        throwex SystemException("Failed to wait for an exclusive wake semaphore for the named read/write lock!");
+                    Sleep(_exclusive_wake);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                     DWORD result = WaitForSingleObject(_exclusive_wake, INFINITE);
                     if (result != WAIT_OBJECT_0)
@@ -342,6 +355,10 @@ public:
             // Yield to other threads
             Thread::Yield();
         }
+
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        SetWriter(true);
+#endif
     }
 
     void UnlockRead()
@@ -370,9 +387,7 @@ public:
 #endif
                 {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                    int result = sem_post(_exclusive_wake);
-                    if (result != 0)
-                        throwex SystemException("Failed to release an exclusive wake semaphore for the named read/write lock!");
+                    Wake(_exclusive_wake, 1);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                     if (!ReleaseSemaphore(_exclusive_wake, 1, nullptr))
                         throwex SystemException("Failed to release an exclusive wake semaphore for the named read/write lock!");
@@ -398,6 +413,10 @@ public:
 
     void UnlockWrite()
     {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        SetWriter(false);
+#endif
+
         while (true)
         {
             uint32_t value = (uint32_t)*_value;
@@ -412,9 +431,7 @@ public:
 #endif
                 {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                    int result = sem_post(_exclusive_wake);
-                    if (result != 0)
-                        throwex SystemException("Failed to release an exclusive wake semaphore for the named read/write lock!");
+                    Wake(_exclusive_wake, 1);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                     if (!ReleaseSemaphore(_exclusive_wake, 1, nullptr))
                         throwex SystemException("Failed to release an exclusive wake semaphore for the named read/write lock!");
@@ -436,12 +453,7 @@ public:
                     if (shared_waiters > 0)
                     {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                        while (shared_waiters-- > 0)
-                        {
-                            int result = sem_post(_shared_wake);
-                            if (result != 0)
-                                throwex SystemException("Failed to release a shared wake semaphore for the named read/write lock!");
-                        }
+                        Wake(_shared_wake, shared_waiters);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                         if (!ReleaseSemaphore(_shared_wake, shared_waiters, nullptr))
                             throwex SystemException("Failed to release a shared wake semaphore for the named read/write lock!");
@@ -458,6 +470,10 @@ public:
 
     void ConvertWriteToRead()
     {
+#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+        SetWriter(false);
+#endif
+
         while (true)
         {
             uint32_t value = (uint32_t)*_value;
@@ -473,12 +489,7 @@ public:
                 if (shared_waiters > 0)
                 {
 #if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
-                    while (shared_waiters-- > 0)
-                    {
-                        int result = sem_post(_shared_wake);
-                        if (result != 0)
-                            throwex SystemException("Failed to release a shared wake semaphore for the named read/write lock!");
-                    }
+                    Wake(_shared_wake, shared_waiters);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
                     if (!ReleaseSemaphore(_shared_wake, shared_waiters, nullptr))
                         throwex SystemException("Failed to release a shared wake semaphore for the named read/write lock!");
@@ -492,9 +503,97 @@ public:
 
 private:
     SharedType<volatile uint64_t> _value;
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
     sem_t* _exclusive_wake;
     sem_t* _shared_wake;
+
+    // Exclusive owner is not tracked, so locks of dead processes are not recovered
+    void SetWriter(bool) {}
+
+    // Sleep until the wake up is posted
+    void Sleep(sem_t* wake)
+    {
+        int result = sem_wait(wake);
+        if (result != 0)
+            throwex SystemException("Failed to wait for a wake semaphore for the named read/write lock!");
+    }
+
+    // Post the given count of wake ups
+    void Wake(sem_t* wake, uint32_t count)
+    {
+        while (count-- > 0)
+        {
+            int result = sem_post(wake);
+            if (result != 0)
+                throwex SystemException("Failed to release a wake semaphore for the named read/write lock!");
+        }
+    }
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+    // Interval to check if the exclusive owner process is still alive (in nanoseconds)
+    static const uint64_t RECOVERY_INTERVAL = 100000000;
+
+    // Shared wake structure
+    struct WakeHeader
+    {
+        // Count of pending exclusive and shared wake ups
+        std::atomic<uint32_t> exclusive_wake;
+        std::atomic<uint32_t> shared_wake;
+        // Exclusive owner process Id
+        std::atomic<uint64_t> writer;
+    };
+
+    // Shared wake structure wrapper
+    SharedType<WakeHeader> _wake;
+    uint64_t _pid;
+    std::atomic<uint32_t>* _exclusive_wake;
+    std::atomic<uint32_t>* _shared_wake;
+
+    // Store or clear the exclusive owner process Id. The lock word is fully packed with owner
+    // and waiter counters, so the owner is published after the exclusive lock is acquired and
+    // the death of the owner between these two steps is not recovered.
+    void SetWriter(bool owned)
+    {
+        _wake->writer.store(owned ? _pid : 0, std::memory_order_release);
+    }
+
+    // Sleep until the wake up is posted
+    void Sleep(std::atomic<uint32_t>* wake)
+    {
+        for (;;)
+        {
+            uint32_t count = wake->load(std::memory_order_acquire);
+            if (count > 0)
+            {
+                if (wake->compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                    return;
+                continue;
+            }
+
+            // Check the exclusive owner process periodically while sleeping
+            if (!Futex::TryWaitFor(*wake, 0, Timespan(RECOVERY_INTERVAL)))
+                Recover();
+        }
+    }
+
+    // Post the given count of wake ups
+    void Wake(std::atomic<uint32_t>* wake, uint32_t count)
+    {
+        wake->fetch_add(count, std::memory_order_release);
+        if (count == 1)
+            Futex::WakeOne(*wake);
+        else
+            Futex::WakeAll(*wake);
+    }
+
+    // Release the exclusive lock of a dead process
+    void Recover()
+    {
+        uint64_t writer = _wake->writer.load(std::memory_order_acquire);
+        if ((writer == 0) || (writer == _pid) || Process::IsProcessRunning(writer))
+            return;
+        if (_wake->writer.compare_exchange_strong(writer, 0, std::memory_order_acq_rel))
+            UnlockWrite();
+    }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _exclusive_wake;
     HANDLE _shared_wake;
@@ -16,10 +16,12 @@
 
 #if defined(__APPLE__)
 #include "threads/thread.h"
-#endif
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
 #include <fcntl.h>
 #include <semaphore.h>
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+#include "system/shared_type.h"
+#include "threads/futex.h"
+#include <atomic>
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
 #include <windows.h>
 #undef Yield
@@ -35,10 +37,13 @@ class NamedSemaphore::Impl
 {
 public:
     Impl(const std::string& name, int resources) : _name(name), _resources(resources)
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__) && !defined(__CYGWIN__)
+        , _shared(name)
+#endif
     {
         assert((resources > 0) && "Named semaphore resources counter must be greater than zero!");
 
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         _owner = true;
         // Try to create a named binary semaphore
         _semaphore = sem_open(name.c_str(), (O_CREAT | O_EXCL), 0666, resources);
@@ -51,6 +56,8 @@ public:
             else
                 _owner = false;
         }
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        // New shared memory block is filled with zeros, so the named semaphore is created with all resources available
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         _semaphore = CreateSemaphoreA(nullptr, resources, resources, name.c_str());
         if (_semaphore == nullptr)
@@ -60,7 +67,7 @@ public:
 
     ~Impl()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         int result = sem_close(_semaphore);
         if (result != 0)
             fatality(SystemException("Failed to close a named semaphore!"));
@@ -89,11 +96,19 @@ public:
 
     bool TryLock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         int result = sem_trywait(_semaphore);
         if ((result != 0) && (errno != EAGAIN))
             throwex SystemException("Failed to try lock a named semaphore!");
         return (result == 0);
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        uint32_t taken = _shared->taken.load(std::memory_order_relaxed);
+        while (taken < (uint32_t)_resources)
+        {
+            if (_shared->taken.compare_exchange_weak(taken, taken + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, 0);
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -128,13 +143,26 @@ public:
             return false;
         }
 #elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
-        struct timespec timeout;
-        timeout.tv_sec = timespan.seconds();
-        timeout.tv_nsec = timespan.nanoseconds() % 1000000000;
-        int result = sem_timedwait(_semaphore, &timeout);
-        if ((result != 0) && (errno != ETIMEDOUT))
-            throwex SystemException("Failed to try lock a named semaphore for the given timeout!");
-        return (result == 0);
+        if (TryLock())
+            return true;
+
+        uint64_t deadline = Timestamp::nano() + timespan.total();
+        for (;;)
+        {
+            uint64_t current = Timestamp::nano();
+            if (current >= deadline)
+                return false;
+
+            // Register the waiter and check the semaphore again to avoid lost wake ups
+            _shared->waiters.fetch_add(1);
+            uint32_t taken = _shared->taken.load();
+            if (taken >= (uint32_t)_resources)
+                Futex::TryWaitFor(_shared->taken, taken, Timespan(deadline - current));
+            _shared->waiters.fetch_sub(1);
+
+            if (TryLock())
+                return true;
+        }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, std::max((DWORD)1, (DWORD)timespan.milliseconds()));
         if ((result != WAIT_OBJECT_0) && (result != WAIT_TIMEOUT))
@@ -145,10 +173,20 @@ public:
 
     void Lock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         int result = sem_wait(_semaphore);
         if (result != 0)
             throwex SystemException("Failed to lock a named semaphore!");
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        while (!TryLock())
+        {
+            // Register the waiter and check the semaphore again to avoid lost wake ups
+            _shared->waiters.fetch_add(1);
+            uint32_t taken = _shared->taken.load();
+            if (taken >= (uint32_t)_resources)
+                Futex::Wait(_shared->taken, taken);
+            _shared->waiters.fetch_sub(1);
+        }
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         DWORD result = WaitForSingleObject(_semaphore, INFINITE);
         if (result != WAIT_OBJECT_0)
@@ -158,10 +196,19 @@ public:
 
     void Unlock()
     {
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
         int result = sem_post(_semaphore);
         if (result != 0)
             throwex SystemException("Failed to unlock a named semaphore!");
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+        uint32_t taken = _shared->taken.load(std::memory_order_relaxed);
+        do
+        {
+            if (taken == 0)
+                throwex SystemException("Failed to unlock a named semaphore!");
+        } while (!_shared->taken.compare_exchange_weak(taken, taken - 1));
+        if (_shared->waiters.load() > 0)
+            Futex::WakeOne(_shared->taken);
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
         if (!ReleaseSemaphore(_semaphore, 1, nullptr))
             throwex SystemException("Failed to unlock a named semaphore!");
@@ -171,9 +218,21 @@ public:
 private:
     std::string _name;
     int _resources;
-#if (defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)) && !defined(__CYGWIN__)
+#if defined(__APPLE__)
     sem_t* _semaphore;
     bool _owner;
+#elif (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__CYGWIN__)
+    // Shared semaphore structure
+    struct SemaphoreHeader
+    {
+        // Count of taken resources
+        std::atomic<uint32_t> taken;
+        // Count of waiting threads
+        std::atomic<uint32_t> waiters;
+    };
+
+    // Shared semaphore structure wrapper
+    SharedType<SemaphoreHeader> _shared;
 #elif defined(_WIN32) || defined(_WIN64) || defined(__CYGWIN__)
     HANDLE _semaphore;
 #endif
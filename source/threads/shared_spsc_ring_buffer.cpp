@@ -0,0 +1,222 @@
+/*!
+    \file shared_spsc_ring_buffer.cpp
+    \brief Process-shared single producer / single consumer wait-free ring buffer implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include "system/process.h"
+#include "threads/futex.h"
+#include "threads/thread.h"
+#include "time/timestamp.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+namespace CppCommon {
+
+//! @cond INTERNALS
+
+// Shared ring buffer layout placed at the beginning of the shared memory block
+struct SharedSPSCRingBuffer::Header
+{
+    // Ring buffer signature is published after the layout is initialized
+    static const uint32_t SIGNATURE = 0x53505343;
+
+    alignas(64) std::atomic<uint32_t> signature;
+    uint64_t capacity;
+    // Attached producer and consumer process Ids
+    alignas(64) std::atomic<uint64_t> producer;
+    alignas(64) std::atomic<uint64_t> consumer;
+    // Producer cursor
+    alignas(64) std::atomic<uint64_t> head;
+    // Consumer cursor
+    alignas(64) std::atomic<uint64_t> tail;
+    // Consumer wake up futex and waiting flag
+    alignas(64) std::atomic<uint32_t> signal;
+    std::atomic<uint32_t> waiting;
+
+    explicit Header(size_t size) : signature(0), capacity(size), producer(0), consumer(0), head(0), tail(0), signal(0), waiting(0) {}
+};
+
+//! @endcond
+
+SharedSPSCRingBuffer::SharedSPSCRingBuffer(const std::string& name, size_t capacity, SharedRingRole role)
+    : _shared(name, sizeof(Header) + capacity), _role(role), _header(nullptr), _buffer(nullptr), _capacity(capacity), _mask(capacity - 1), _pid(Process::CurrentProcessId())
+{
+    assert((capacity > 1) && "Ring buffer capacity must be greater than one!");
+    assert(((capacity & (capacity - 1)) == 0) && "Ring buffer capacity must be a power of two!");
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Process-shared ring buffer requires lock-free 64-bit atomics!");
+
+    _header = (Header*)_shared.ptr();
+    _buffer = (uint8_t*)_shared.ptr() + sizeof(Header);
+
+    if (_shared.owner())
+    {
+        // Initialize the layout and publish it to other processes
+        new(_header) Header(capacity);
+        _header->signature.store(Header::SIGNATURE, std::memory_order_release);
+    }
+    else
+    {
+        // Wait for the owner to initialize the layout
+        uint64_t deadline = Timestamp::nano() + Timespan::seconds(1).total();
+        while (_header->signature.load(std::memory_order_acquire) != Header::SIGNATURE)
+        {
+            if (Timestamp::nano() > deadline)
+                throwex SystemException("Shared ring buffer is not initialized!");
+            Thread::Yield();
+        }
+        if (_header->capacity != capacity)
+            throwex SystemException("Invalid shared ring buffer capacity!");
+    }
+
+    // Attach to the ring buffer and take over the role of a dead process
+    std::atomic<uint64_t>& owner = (_role == SharedRingRole::PRODUCER) ? _header->producer : _header->consumer;
+    uint64_t current = owner.load(std::memory_order_acquire);
+    do
+    {
+        if ((current != 0) && Process::IsProcessRunning(current))
+            throwex SystemException((_role == SharedRingRole::PRODUCER) ? "Shared ring buffer producer is already attached!" : "Shared ring buffer consumer is already attached!");
+    } while (!owner.compare_exchange_weak(current, _pid, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    // Dead consumer might leave its waiting flag
+    if (_role == SharedRingRole::CONSUMER)
+        _header->waiting.store(0, std::memory_order_release);
+}
+
+SharedSPSCRingBuffer::~SharedSPSCRingBuffer()
+{
+    // Detach from the ring buffer
+    std::atomic<uint64_t>& owner = (_role == SharedRingRole::PRODUCER) ? _header->producer : _header->consumer;
+    uint64_t current = _pid;
+    owner.compare_exchange_strong(current, 0, std::memory_order_acq_rel);
+}
+
+size_t SharedSPSCRingBuffer::size() const noexcept
+{
+    const uint64_t head = _header->head.load(std::memory_order_acquire);
+    const uint64_t tail = _header->tail.load(std::memory_order_acquire);
+
+    return (size_t)(head - tail);
+}
+
+bool SharedSPSCRingBuffer::Enqueue(const void* data, size_t size)
+{
+    assert((_role == SharedRingRole::PRODUCER) && "Only producer can enqueue into the shared ring buffer!");
+    assert((size <= _capacity) && "Data size should not be greater than ring buffer capacity!");
+    if (size > _capacity)
+        return false;
+
+    if (size == 0)
+        return true;
+
+    assert((data != nullptr) && "Pointer to the data should not be null!");
+    if (data == nullptr)
+        return false;
+
+    const uint64_t head = _header->head.load(std::memory_order_relaxed);
+    const uint64_t tail = _header->tail.load(std::memory_order_acquire);
+
+    // Check if there is required free space in the ring buffer
+    if ((size + head - tail) > _capacity)
+        return false;
+
+    // Copy data into the ring buffer
+    size_t head_index = (size_t)head & _mask;
+    size_t first = std::min(size, _capacity - head_index);
+    std::memcpy(_buffer + head_index, data, first);
+    std::memcpy(_buffer, (const uint8_t*)data + first, size - first);
+
+    // Increase the head cursor
+    _header->head.store(head + size, std::memory_order_release);
+
+    // Wake up the waiting consumer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_header->waiting.load(std::memory_order_relaxed) != 0)
+    {
+        _header->signal.fetch_add(1, std::memory_order_release);
+        Futex::WakeOne(_header->signal);
+    }
+
+    return true;
+}
+
+bool SharedSPSCRingBuffer::Dequeue(void* data, size_t& size)
+{
+    assert((_role == SharedRingRole::CONSUMER) && "Only consumer can dequeue from the shared ring buffer!");
+
+    if (size == 0)
+        return true;
+
+    assert((data != nullptr) && "Pointer to the data should not be null!");
+    if (data == nullptr)
+        return false;
+
+    const uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+    const uint64_t head = _header->head.load(std::memory_order_acquire);
+
+    // Get the ring buffer size
+    size_t available = (size_t)(head - tail);
+    if (size > available)
+        size = available;
+
+    // Check if the ring buffer is empty
+    if (size == 0)
+        return false;
+
+    // Copy data from the ring buffer
+    size_t tail_index = (size_t)tail & _mask;
+    size_t first = std::min(size, _capacity - tail_index);
+    std::memcpy(data, _buffer + tail_index, first);
+    std::memcpy((uint8_t*)data + first, _buffer, size - first);
+
+    // Increase the tail cursor
+    _header->tail.store(tail + size, std::memory_order_release);
+
+    return true;
+}
+
+void SharedSPSCRingBuffer::Wait()
+{
+    while (!TryWaitFor(Timespan::seconds(1)));
+}
+
+bool SharedSPSCRingBuffer::TryWaitFor(const Timespan& timespan)
+{
+    assert((_role == SharedRingRole::CONSUMER) && "Only consumer can wait for the shared ring buffer!");
+
+    if (!empty())
+        return true;
+
+    uint64_t deadline = Timestamp::nano() + timespan.total();
+    for (;;)
+    {
+        // Register the waiting consumer and check the ring buffer again to avoid lost wake ups
+        uint32_t signal = _header->signal.load(std::memory_order_acquire);
+        _header->waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!empty())
+        {
+            _header->waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        uint64_t current = Timestamp::nano();
+        bool result = (current < deadline) && Futex::TryWaitFor(_header->signal, signal, Timespan(deadline - current));
+        _header->waiting.store(0, std::memory_order_relaxed);
+
+        if (!empty())
+            return true;
+        if (!result)
+            return false;
+    }
+}
+
+} // namespace CppCommon
@@ -0,0 +1,187 @@
+/*!
+    \file clock.cpp
+    \brief Clock policies implementation
+    \author Ivan Shynkarenka
+    \date 17.10.2026
+    \copyright MIT License
+*/
+
+#include "time/clock.h"
+
+#include "threads/thread.h"
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#elif defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#endif
+
+namespace CppCommon {
+
+uint64_t CoarseClock::utc()
+{
+#if defined(__linux__)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_REALTIME_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_REALTIME_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#elif defined(_WIN32) || defined(_WIN64)
+    FILETIME ft;
+    GetSystemTimeAsFileTime(&ft);
+
+    ULARGE_INTEGER result;
+    result.LowPart = ft.dwLowDateTime;
+    result.HighPart = ft.dwHighDateTime;
+    return (result.QuadPart - 116444736000000000ull) * 100;
+#else
+    return Timestamp::utc();
+#endif
+}
+
+uint64_t CoarseClock::nano()
+{
+#if defined(__linux__)
+    struct timespec timestamp;
+    if (clock_gettime(CLOCK_MONOTONIC_COARSE, &timestamp) != 0)
+        throwex SystemException("Cannot get value of CLOCK_MONOTONIC_COARSE timer!");
+    return (timestamp.tv_sec * 1000000000) + timestamp.tv_nsec;
+#elif defined(_WIN32) || defined(_WIN64)
+    return GetTickCount64() * 1000000;
+#else
+    return Timestamp::nano();
+#endif
+}
+
+Timespan CoarseClock::resolution()
+{
+#if defined(__linux__)
+    struct timespec resolution;
+    if (clock_getres(CLOCK_REALTIME_COARSE, &resolution) != 0)
+        throwex SystemException("Cannot get resolution of CLOCK_REALTIME_COARSE timer!");
+    return Timespan((resolution.tv_sec * 1000000000) + resolution.tv_nsec);
+#elif defined(_WIN32) || defined(_WIN64)
+    DWORD adjustment, increment;
+    BOOL disabled;
+    if (!GetSystemTimeAdjustment(&adjustment, &increment, &disabled))
+        throwex SystemException("Cannot get the system time adjustment!");
+    return Timespan(increment * 100);
+#else
+    return Timespan(1);
+#endif
+}
+
+//! @cond INTERNALS
+namespace Internals {
+
+class CachedClockUpdater
+{
+public:
+    CachedClockUpdater() : _running(false), _timestamp(0), _interval(0) {}
+    ~CachedClockUpdater() { Stop(); }
+
+    bool IsRunning() const noexcept { return _running.load(std::memory_order_acquire); }
+
+    uint64_t utc()
+    {
+        if (_running.load(std::memory_order_acquire))
+            return _timestamp.load(std::memory_order_relaxed);
+        else
+            return CoarseClock::utc();
+    }
+
+    void Start(const Timespan& interval)
+    {
+        std::unique_lock<std::mutex> control(_control);
+        std::unique_lock<std::mutex> locker(_lock);
+
+        _interval = interval;
+        if (_thread.joinable())
+        {
+            _cond.notify_one();
+            return;
+        }
+
+        _timestamp.store(Timestamp::utc(), std::memory_order_relaxed);
+        _running.store(true, std::memory_order_release);
+        _thread = Thread::Start([this]() { Update(); });
+    }
+
+    void Stop()
+    {
+        // Start() must not run a new thread until the old one is joined
+        std::unique_lock<std::mutex> control(_control);
+
+        std::thread thread;
+        {
+            std::unique_lock<std::mutex> locker(_lock);
+
+            if (!_thread.joinable())
+                return;
+
+            _running.store(false, std::memory_order_release);
+            _cond.notify_one();
+            thread = std::move(_thread);
+        }
+        thread.join();
+    }
+
+private:
+    std::mutex _control;
+    std::mutex _lock;
+    std::condition_variable _cond;
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<uint64_t> _timestamp;
+    Timespan _interval;
+
+    void Update()
+    {
+        std::unique_lock<std::mutex> locker(_lock);
+        while (_running.load(std::memory_order_acquire))
+        {
+            _timestamp.store(Timestamp::utc(), std::memory_order_relaxed);
+            _cond.wait_for(locker, _interval.chrono());
+        }
+    }
+};
+
+CachedClockUpdater& GetCachedClockUpdater()
+{
+    static CachedClockUpdater updater;
+    return updater;
+}
+
+} // namespace Internals
+//! @endcond
+
+uint64_t CachedClock::utc()
+{
+    return Internals::GetCachedClockUpdater().utc();
+}
+
+bool CachedClock::IsRunning() noexcept
+{
+    return Internals::GetCachedClockUpdater().IsRunning();
+}
+
+void CachedClock::Start(const Timespan& interval)
+{
+    assert((interval.total() > 0) && "Cached clock update interval must be greater than zero!");
+    if (interval.total() <= 0)
+        throwex ArgumentException("Cached clock update interval must be greater than zero!");
+
+    Internals::GetCachedClockUpdater().Start(interval);
+}
+
+void CachedClock::Stop()
+{
+    Internals::GetCachedClockUpdater().Stop();
+}
+
+} // namespace CppCommon
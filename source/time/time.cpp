@@ -10,30 +10,276 @@
 
 #include "string/format.h"
 
+#include "utility/endian.h"
+
 #include <cassert>
+#include <cstring>
 
 #include <time.h>
 
 namespace CppCommon {
 
-Time::Time(const Timestamp& timestamp)
+namespace Internals {
+
+// Two-digit lookup table for the branch-free digit emission
+const char DIGITS[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+inline void Write2(char* buffer, unsigned value) noexcept
+{
+    std::memcpy(buffer, &DIGITS[value * 2], 2);
+}
+
+inline void Write4(char* buffer, unsigned value) noexcept
+{
+    Write2(buffer + 0, (value / 100) % 100);
+    Write2(buffer + 2, value % 100);
+}
+
+// Calendar date of the days since the epoch
+// https://howardhinnant.github.io/date_algorithms.html#civil_from_days
+struct CivilDate
+{
+    int64_t days;
+    int year;
+    int month;
+    int day;
+    int weekday;
+};
+
+void CivilFromDays(int64_t days, CivilDate& date) noexcept
+{
+    int64_t z = days + 719468;
+    int64_t era = ((z >= 0) ? z : (z - 146096)) / 146097;
+    int64_t doe = z - era * 146097;
+    int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    int64_t mp = (5 * doy + 2) / 153;
+    int64_t d = doy - (153 * mp + 2) / 5 + 1;
+    int64_t m = (mp < 10) ? (mp + 3) : (mp - 9);
+    int64_t y = yoe + era * 400 + ((m <= 2) ? 1 : 0);
+
+    date.days = days;
+    date.year = (int)y;
+    date.month = (int)m;
+    date.day = (int)d;
+    // 1970-01-01 was Thursday
+    date.weekday = (int)(((days % 7) + 11) % 7);
+}
+
+// Days since the epoch of the calendar date
+// https://howardhinnant.github.io/date_algorithms.html#days_from_civil
+int64_t DaysFromCivil(int64_t year, int64_t month, int64_t day) noexcept
 {
+    year -= (month <= 2) ? 1 : 0;
+    int64_t era = ((year >= 0) ? year : (year - 399)) / 400;
+    int64_t yoe = year - era * 400;
+    int64_t doy = (153 * ((month > 2) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+    int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+bool IsLeapYear(int year) noexcept
+{
+    return ((year % 4) == 0) && (((year % 100) != 0) || ((year % 400) == 0));
+}
+
+int DaysInMonth(int year, int month) noexcept
+{
+    static const int days[12] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    return ((month == 2) && IsLeapYear(year)) ? 29 : days[month - 1];
+}
+
+// Calendar date of the last converted day per thread
+const CivilDate& CachedCivilDate(int64_t days) noexcept
+{
+    thread_local CivilDate cache = { -1, 0, 0, 0, 0 };
+    if (cache.days != days)
+        CivilFromDays(days, cache);
+    return cache;
+}
+
+// Local calendar date & time of the last converted minute per thread
+struct LocalMinute
+{
+    int64_t minute;
     struct tm result;
-    time_t seconds = timestamp.seconds();
+};
+
+bool CachedLocalTime(int64_t seconds, struct tm& result)
+{
+    thread_local LocalMinute cache = { -1, {} };
+
+    int64_t minute = seconds / 60;
+    if (cache.minute != minute)
+    {
+        time_t start = (time_t)(minute * 60);
 #if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
+        if (localtime_r(&start, &cache.result) != &cache.result)
+            return false;
 #elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to date & time structure!", timestamp.total()));
+        if (localtime_s(&cache.result, &start))
+            return false;
 #endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
+        // Cache only whole minute time zone offsets
+        if (cache.result.tm_sec != 0)
+        {
+            time_t current = (time_t)seconds;
+            cache.minute = -1;
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+            return (localtime_r(&current, &result) == &result);
+#elif defined(_WIN32) || defined(_WIN64)
+            return (localtime_s(&result, &current) == 0);
+#endif
+        }
+        cache.minute = minute;
+    }
+
+    result = cache.result;
+    result.tm_sec = (int)(seconds - minute * 60);
+    return true;
+}
+
+// Parse two decimal digits, invalid characters are reported with the error flag
+inline int Parse2(const char* buffer, unsigned& error) noexcept
+{
+    unsigned d1 = (unsigned)(uint8_t)buffer[0] - '0';
+    unsigned d2 = (unsigned)(uint8_t)buffer[1] - '0';
+    error |= (unsigned)(d1 > 9) | (unsigned)(d2 > 9);
+    return (int)(d1 * 10 + d2);
+}
+
+// Parse eight decimal digits with SWAR arithmetic, invalid characters are reported with the error flag
+inline uint64_t Parse8(const char* buffer, unsigned& error) noexcept
+{
+    uint64_t value;
+    Endian::ReadLittleEndian(buffer, value);
+
+    // All bytes must be in range '0'..'9'
+    uint64_t high = value & 0xF0F0F0F0F0F0F0F0ull;
+    uint64_t over = (value + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull;
+    error |= (unsigned)((high != 0x3030303030303030ull) | (over != 0x3030303030303030ull));
+
+    value -= 0x3030303030303030ull;
+    value = (value * 10 + (value >> 8)) & 0x00FF00FF00FF00FFull;
+    value = (value * 100 + (value >> 16)) & 0x0000FFFF0000FFFFull;
+    value = (value * 10000 + (value >> 32)) & 0x00000000FFFFFFFFull;
+    return value;
+}
+
+bool ParseTimestamp(std::string_view str, uint64_t& timestamp) noexcept
+{
+    const char* data = str.data();
+    size_t size = str.size();
+
+    // Fixed part "YYYY-MM-DDThh:mm:ss"
+    if (size < 19)
+        return false;
+
+    unsigned error = 0;
+    int year = Parse2(data + 0, error) * 100 + Parse2(data + 2, error);
+    int month = Parse2(data + 5, error);
+    int day = Parse2(data + 8, error);
+    int hour = Parse2(data + 11, error);
+    int minute = Parse2(data + 14, error);
+    int second = Parse2(data + 17, error);
+    error |= (unsigned)(data[4] != '-') | (unsigned)(data[7] != '-');
+    error |= (unsigned)((data[10] != 'T') & (data[10] != 't') & (data[10] != ' '));
+    error |= (unsigned)(data[13] != ':') | (unsigned)(data[16] != ':');
+    error |= (unsigned)(year < 1970) | (unsigned)(month < 1) | (unsigned)(month > 12);
+    error |= (unsigned)(hour > 23) | (unsigned)(minute > 59) | (unsigned)(second > 59);
+    if (error != 0)
+        return false;
+    if ((day < 1) || (day > DaysInMonth(year, month)))
+        return false;
+
+    size_t index = 19;
+
+    // Optional fraction
+    uint64_t nanoseconds = 0;
+    if ((index < size) && ((data[index] == '.') || (data[index] == ',')))
+    {
+        size_t start = ++index;
+        while ((index < size) && ((unsigned)(uint8_t)data[index] - '0' <= 9))
+            ++index;
+        size_t count = index - start;
+        if (count == 0)
+            return false;
+
+        // Pad the fraction with zeros up to nine digits
+        char fraction[9] = { '0', '0', '0', '0', '0', '0', '0', '0', '0' };
+        std::memcpy(fraction, data + start, (count < 9) ? count : 9);
+        nanoseconds = Parse8(fraction, error) * 10 + (uint64_t)(fraction[8] - '0');
+    }
+
+    // Optional time zone designator
+    int64_t offset = 0;
+    if (index < size)
+    {
+        char designator = data[index++];
+        if ((designator == 'Z') || (designator == 'z'))
+        {
+            // UTC time
+        }
+        else if ((designator == '+') || (designator == '-'))
+        {
+            if ((size - index) < 2)
+                return false;
+            int offset_hours = Parse2(data + index, error);
+            int offset_minutes = 0;
+            index += 2;
+            if (index < size)
+            {
+                if (data[index] == ':')
+                    ++index;
+                if ((size - index) < 2)
+                    return false;
+                offset_minutes = Parse2(data + index, error);
+                index += 2;
+            }
+            error |= (unsigned)(offset_hours > 23) | (unsigned)(offset_minutes > 59);
+            offset = (offset_hours * 60 + offset_minutes) * 60;
+            if (designator == '-')
+                offset = -offset;
+        }
+        else
+            return false;
+    }
+
+    if ((error != 0) || (index != size))
+        return false;
+
+    int64_t seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+    if ((seconds < 0) || ((uint64_t)seconds > (UINT64_MAX - nanoseconds) / 1000000000ull))
+        return false;
+
+    timestamp = (uint64_t)seconds * 1000000000ull + nanoseconds;
+    return true;
+}
+
+} // namespace Internals
+
+Time::Time(const Timestamp& timestamp)
+{
+    uint64_t seconds = timestamp.seconds();
+    uint64_t daytime = seconds % 86400;
+    const Internals::CivilDate& date = Internals::CachedCivilDate((int64_t)(seconds / 86400));
+    _year = date.year;
+    _month = date.month;
+    _weekday = date.weekday;
+    _day = date.day;
+    _hour = (int)(daytime / 3600);
+    _minute = (int)((daytime % 3600) / 60);
+    _second = (int)(daytime % 60);
     _millisecond = timestamp.milliseconds() % 1000;
     _microsecond = timestamp.microseconds() % 1000;
     _nanosecond = timestamp.nanoseconds() % 1000;
@@ -99,21 +345,8 @@ Time::Time(int year, int month, int day, int hour, int minute, int second, int m
 
 UtcTimestamp Time::utcstamp() const
 {
-    struct tm result;
-    result.tm_year = _year - 1900;
-    result.tm_mon = _month - 1;
-    result.tm_mday = _day;
-    result.tm_hour = _hour;
-    result.tm_min = _minute;
-    result.tm_sec = _second;
-    result.tm_isdst = -1;
-
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    time_t seconds = timegm(&result);
-#elif defined(_WIN32) || defined(_WIN64)
-    time_t seconds = _mkgmtime(&result);
-#endif
-    if (seconds == -1)
+    int64_t seconds = Internals::DaysFromCivil(_year, _month, _day) * 86400 + _hour * 3600 + _minute * 60 + _second;
+    if (seconds < 0)
         throwex SystemException("Cannot convert date & time to UTC timestamp!");
 
     return UtcTimestamp(seconds * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
@@ -137,40 +370,77 @@ LocalTimestamp Time::localstamp() const
     return LocalTimestamp(seconds * 1000000000ull + _millisecond * 1000000ull + _microsecond * 1000ull + _nanosecond);
 }
 
-UtcTime::UtcTime(const Timestamp& timestamp)
+std::string Time::string() const
 {
-    struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (gmtime_r(&seconds, &result) != &result)
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (gmtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to UTC date & time structure!", timestamp.total()));
-#endif
-    _year = result.tm_year + 1900;
-    _month = result.tm_mon + 1;
-    _weekday = result.tm_wday;
-    _day = result.tm_mday;
-    _hour = result.tm_hour;
-    _minute = result.tm_min;
-    _second = result.tm_sec % 60;
-    _millisecond = timestamp.milliseconds() % 1000;
-    _microsecond = timestamp.microseconds() % 1000;
-    _nanosecond = timestamp.nanoseconds() % 1000;
+    std::string result(ISO8601_SIZE, '0');
+    string(result.data());
+    return result;
+}
+
+size_t Time::string(char* buffer) const noexcept
+{
+    Internals::Write4(buffer + 0, (unsigned)_year);
+    buffer[4] = '-';
+    Internals::Write2(buffer + 5, (unsigned)_month);
+    buffer[7] = '-';
+    Internals::Write2(buffer + 8, (unsigned)_day);
+    buffer[10] = 'T';
+    Internals::Write2(buffer + 11, (unsigned)_hour);
+    buffer[13] = ':';
+    Internals::Write2(buffer + 14, (unsigned)_minute);
+    buffer[16] = ':';
+    Internals::Write2(buffer + 17, (unsigned)_second);
+    buffer[19] = '.';
+    buffer[20] = (char)('0' + _millisecond / 100);
+    Internals::Write2(buffer + 21, (unsigned)(_millisecond % 100));
+    buffer[23] = (char)('0' + _microsecond / 100);
+    Internals::Write2(buffer + 24, (unsigned)(_microsecond % 100));
+    buffer[26] = (char)('0' + _nanosecond / 100);
+    Internals::Write2(buffer + 27, (unsigned)(_nanosecond % 100));
+    return ISO8601_SIZE;
+}
+
+UtcTime::UtcTime(const Timestamp& timestamp) : Time(timestamp)
+{
+}
+
+std::string UtcTime::string() const
+{
+    std::string result(ISO8601_SIZE + 1, '0');
+    string(result.data());
+    return result;
+}
+
+size_t UtcTime::string(char* buffer) const noexcept
+{
+    size_t size = Time::string(buffer);
+    buffer[size++] = 'Z';
+    return size;
+}
+
+UtcTime UtcTime::Parse(std::string_view str)
+{
+    UtcTime result(Timestamp(0));
+    if (!TryParse(str, result))
+        throwex ArgumentException(format("Cannot parse date & time from the given string: {}", str));
+    return result;
+}
+
+bool UtcTime::TryParse(std::string_view str, UtcTime& time) noexcept
+{
+    uint64_t timestamp;
+    if (!Internals::ParseTimestamp(str, timestamp))
+        return false;
+
+    time = UtcTime(Timestamp(timestamp));
+    return true;
 }
 
 LocalTime::LocalTime(const Timestamp& timestamp)
 {
     struct tm result;
-    time_t seconds = timestamp.seconds();
-#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
-    if (localtime_r(&seconds, &result) != &result)
+    if (!Internals::CachedLocalTime((int64_t)timestamp.seconds(), result))
         throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
-#elif defined(_WIN32) || defined(_WIN64)
-    if (localtime_s(&result, &seconds))
-        throwex SystemException(format("Cannot convert the given timestamp ({}) to local date & time structure!", timestamp.total()));
-#endif
     _year = result.tm_year + 1900;
     _month = result.tm_mon + 1;
     _weekday = result.tm_wday;
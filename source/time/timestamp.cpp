@@ -10,6 +10,22 @@
 
 #include "math/math.h"
 
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#if defined(__i386__) || defined(__x86_64__) || defined(__amd64__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#elif defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#endif
+
 #if defined(__APPLE__)
 #include <mach/mach.h>
 #include <mach/mach_time.h>
@@ -295,4 +311,257 @@ uint64_t Timestamp::rdts()
 #endif
 }
 
+//! @cond INTERNALS
+namespace Internals {
+
+//! Calibrated time stamp counter clock
+/*!
+    Converts time stamp counter values into nanoseconds of the high resolution
+    clock with a fixed-point multiplier. Conversion parameters are published
+    with a sequence lock, so readers never block.
+
+    Every calibration period one of the readers measures the error between
+    the high resolution clock and the time stamp counter clock. The positive
+    error greater than the snap threshold is fixed with a forward jump, any
+    other error is slewed during the next calibration period, so the clock
+    never goes backward. The slew is bounded by the calibration period: if
+    the next calibration is late (e.g. the clock is not used for a long time)
+    the rest of the interval is scaled with the measured frequency, so the
+    slew does not turn into the opposite drift.
+*/
+class TscClock
+{
+public:
+    //! Calibration period in nanoseconds
+    static const uint64_t PERIOD = 1000000000;
+    //! Initial calibration interval in nanoseconds
+    static const uint64_t INTERVAL = 2000000;
+    //! Forward jump threshold in nanoseconds
+    static const uint64_t SNAP = 1000000;
+
+    TscClock() : _available(IsAvailable()), _sequence(0), _base_tsc(0), _base_nano(0), _multiplier(0), _frequency(0), _period(0), _calibrating(false)
+    {
+        if (!_available)
+            return;
+
+        // Measure the time stamp counter frequency during the initial calibration interval
+        uint64_t tsc1, nano1;
+        Sample(tsc1, nano1);
+        uint64_t tsc2, nano2;
+        do
+        {
+            Sample(tsc2, nano2);
+        } while ((nano2 - nano1) < INTERVAL);
+
+        if (tsc2 <= tsc1)
+        {
+            _available = false;
+            return;
+        }
+
+        _start_tsc = tsc1;
+        _start_nano = nano1;
+        _base_tsc.store(tsc2, std::memory_order_relaxed);
+        _base_nano.store(nano2, std::memory_order_relaxed);
+        _multiplier.store(Multiplier(nano2 - nano1, tsc2 - tsc1), std::memory_order_relaxed);
+        _frequency.store(Multiplier(nano2 - nano1, tsc2 - tsc1), std::memory_order_relaxed);
+        _period.store(Math::MulDiv64(PERIOD, tsc2 - tsc1, nano2 - nano1), std::memory_order_release);
+    }
+
+    bool available() const noexcept { return _available; }
+
+    uint64_t nano()
+    {
+        uint64_t base_tsc, base_nano, multiplier, frequency, period;
+        uint32_t sequence;
+        do
+        {
+            sequence = _sequence.load(std::memory_order_acquire);
+            base_tsc = _base_tsc.load(std::memory_order_relaxed);
+            base_nano = _base_nano.load(std::memory_order_relaxed);
+            multiplier = _multiplier.load(std::memory_order_relaxed);
+            frequency = _frequency.load(std::memory_order_relaxed);
+            period = _period.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence & 1) || (sequence != _sequence.load(std::memory_order_relaxed)));
+
+        uint64_t tsc = Timestamp::rdts();
+
+        // Another thread might update the base after the time stamp counter was read
+        if (tsc <= base_tsc)
+            return base_nano;
+
+        uint64_t delta = tsc - base_tsc;
+        if (delta >= period)
+            Recalibrate();
+
+        return base_nano + Convert(delta, period, multiplier, frequency);
+    }
+
+private:
+    bool _available;
+    uint64_t _start_tsc;
+    uint64_t _start_nano;
+    std::atomic<uint32_t> _sequence;
+    std::atomic<uint64_t> _base_tsc;
+    std::atomic<uint64_t> _base_nano;
+    // Slewed multiplier of the current calibration period
+    std::atomic<uint64_t> _multiplier;
+    // Multiplier of the measured time stamp counter frequency
+    std::atomic<uint64_t> _frequency;
+    // Calibration period in time stamp counter cycles
+    std::atomic<uint64_t> _period;
+    std::atomic<bool> _calibrating;
+
+    static bool IsAvailable()
+    {
+#if defined(__i386__) || defined(__x86_64__) || defined(__amd64__) || defined(_M_IX86) || defined(_M_X64)
+        // Check the invariant time stamp counter CPUID flag
+        unsigned int registers[4] = { 0 };
+#if defined(_MSC_VER)
+        __cpuid((int*)registers, 0x80000000);
+        if (registers[0] < 0x80000007)
+            return false;
+        __cpuid((int*)registers, 0x80000007);
+#else
+        if (__get_cpuid_max(0x80000000, nullptr) < 0x80000007)
+            return false;
+        __get_cpuid(0x80000007, &registers[0], &registers[1], &registers[2], &registers[3]);
+#endif
+        if ((registers[3] & (1 << 8)) == 0)
+            return false;
+#if defined(__linux__)
+        // Kernel switches away from the time stamp counter clock source when
+        // counters of different CPUs are not synchronized
+        std::ifstream stream("/sys/devices/system/clocksource/clocksource0/current_clocksource");
+        std::string clocksource;
+        if (stream >> clocksource)
+            return (clocksource == "tsc");
+#endif
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    static void Sample(uint64_t& tsc, uint64_t& nano)
+    {
+        // Take the closest pair of the time stamp counter and the high resolution clock values
+        uint64_t best = std::numeric_limits<uint64_t>::max();
+        tsc = nano = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            uint64_t before = Timestamp::rdts();
+            uint64_t current = Timestamp::nano();
+            uint64_t after = Timestamp::rdts();
+            if ((after - before) < best)
+            {
+                best = after - before;
+                tsc = before + (after - before) / 2;
+                nano = current;
+            }
+        }
+    }
+
+    //! Get 32.32 fixed-point multiplier of nanoseconds per time stamp counter cycle
+    static uint64_t Multiplier(uint64_t nanoseconds, uint64_t cycles)
+    {
+        return Math::MulDiv64(nanoseconds, 1ull << 32, cycles);
+    }
+
+    static uint64_t Scale(uint64_t cycles, uint64_t multiplier) noexcept
+    {
+#if defined(__SIZEOF_INT128__) && (defined(__GNUC__) || defined(__clang__))
+        // 128-bit integer is a compiler extension, so mark it to keep pedantic builds quiet
+        __extension__ typedef unsigned __int128 uint128_t;
+        return (uint64_t)(((uint128_t)cycles * multiplier) >> 32);
+#else
+        uint64_t high = (cycles >> 32) * multiplier;
+        uint64_t low = ((cycles & 0xFFFFFFFF) * multiplier) >> 32;
+        return high + low;
+#endif
+    }
+
+    //! Convert time stamp counter cycles since the base into nanoseconds
+    static uint64_t Convert(uint64_t cycles, uint64_t period, uint64_t multiplier, uint64_t frequency) noexcept
+    {
+        // Slew only during the calibration period
+        if (cycles <= period)
+            return Scale(cycles, multiplier);
+        else
+            return Scale(period, multiplier) + Scale(cycles - period, frequency);
+    }
+
+    void Recalibrate()
+    {
+        // Only one thread calibrates the clock, others continue with the current parameters
+        if (_calibrating.exchange(true, std::memory_order_acquire))
+            return;
+
+        uint64_t tsc, nano;
+        Sample(tsc, nano);
+
+        uint64_t base_tsc = _base_tsc.load(std::memory_order_relaxed);
+        uint64_t base_nano = _base_nano.load(std::memory_order_relaxed);
+        uint64_t multiplier = _multiplier.load(std::memory_order_relaxed);
+        uint64_t frequency = _frequency.load(std::memory_order_relaxed);
+        uint64_t period = _period.load(std::memory_order_relaxed);
+
+        if (tsc > base_tsc)
+        {
+            // Current value of the time stamp counter clock is the new base to keep it continuous
+            uint64_t current = base_nano + Convert(tsc - base_tsc, period, multiplier, frequency);
+
+            // Frequency measured from the clock start is the most precise one
+            period = Math::MulDiv64(PERIOD, tsc - _start_tsc, nano - _start_nano);
+            frequency = Multiplier(nano - _start_nano, tsc - _start_tsc);
+
+            if (nano > (current + SNAP))
+            {
+                // Jump forward if the clock is far behind (e.g. after the system suspend)
+                current = nano;
+                multiplier = frequency;
+            }
+            else
+            {
+                // Slew the error during the next calibration period
+                int64_t error = std::clamp((int64_t)(nano - current), -(int64_t)PERIOD / 2, (int64_t)PERIOD / 2);
+                multiplier = Multiplier(PERIOD + error, period);
+            }
+
+            uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+            _sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            _base_tsc.store(tsc, std::memory_order_relaxed);
+            _base_nano.store(current, std::memory_order_relaxed);
+            _multiplier.store(multiplier, std::memory_order_relaxed);
+            _frequency.store(frequency, std::memory_order_relaxed);
+            _period.store(period, std::memory_order_relaxed);
+            _sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        _calibrating.store(false, std::memory_order_release);
+    }
+};
+
+TscClock& GetTscClock()
+{
+    static TscClock clock;
+    return clock;
+}
+
+} // namespace Internals
+//! @endcond
+
+uint64_t Timestamp::fast()
+{
+    Internals::TscClock& clock = Internals::GetTscClock();
+    return clock.available() ? clock.nano() : nano();
+}
+
+bool Timestamp::IsTscAvailable()
+{
+    return Internals::GetTscClock().available();
+}
+
 } // namespace CppCommon
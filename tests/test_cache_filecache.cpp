@@ -63,3 +63,40 @@ TEST_CASE("File cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("File cache with the cached clock", "[CppCommon][Cache]")
+{
+    CachedClock::Start(Timespan::milliseconds(1));
+
+    FileCache cache(CachedClock::now);
+    cache.insert("123", "123");
+    cache.insert("456", "456", CppCommon::Timespan::milliseconds(100));
+    REQUIRE(cache.find("456").first);
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(200));
+
+    // Watchdog the file cache with the cached clock
+    cache.watchdog();
+
+    REQUIRE(cache.find("123").first);
+    REQUIRE(!cache.find("456").first);
+
+    CachedClock::Stop();
+}
+
+TEST_CASE("File cache swap", "[CppCommon][Cache]")
+{
+    // Clock is swapped together with entries
+    FileCache cache1([]() { return Timestamp(1000); });
+    FileCache cache2([]() { return Timestamp(2000); });
+    cache1.insert("123", "123", Timespan::nanoseconds(500));
+    cache2.insert("456", "456", Timespan::nanoseconds(500));
+    swap(cache1, cache2);
+
+    // Entries are checked with the clock of their original cache
+    cache1.watchdog();
+    REQUIRE(cache1.find("456").first);
+    cache2.watchdog();
+    REQUIRE(cache2.find("123").first);
+}
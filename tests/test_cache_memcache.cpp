@@ -63,3 +63,26 @@ TEST_CASE("Memory cache", "[CppCommon][Cache]")
     REQUIRE(cache.empty());
     REQUIRE(cache.size() == 0);
 }
+
+TEST_CASE("Memory cache with the coarse clock", "[CppCommon][Cache]")
+{
+    MemCache<std::string, int, CoarseClock> cache;
+
+    cache.insert("123", 123);
+    cache.insert("456", 456, CppCommon::Timespan::milliseconds(100));
+
+    Timestamp timeout;
+    int result = 0;
+    REQUIRE(cache.find("456", result, timeout));
+    REQUIRE(result == 456);
+    REQUIRE(timeout > CoarseClock::now());
+
+    // Sleep for a while...
+    Thread::SleepFor(Timespan::milliseconds(200));
+
+    // Watchdog the memory cache with the coarse clock
+    cache.watchdog();
+
+    REQUIRE(cache.find("123"));
+    REQUIRE(!cache.find("456"));
+}
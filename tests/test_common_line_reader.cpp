@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "common/line_reader.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+namespace {
+
+// Memory reader which returns data in small chunks
+class ChunkReader : public Reader
+{
+public:
+    ChunkReader(const std::string& data, size_t chunk) : _data(data), _chunk(chunk), _offset(0) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = std::min(std::min(size, _chunk), _data.size() - _offset);
+        std::memcpy(buffer, _data.data() + _offset, result);
+        _offset += result;
+        return result;
+    }
+
+private:
+    std::string _data;
+    size_t _chunk;
+    size_t _offset;
+};
+
+} // namespace
+
+TEST_CASE("Line reader", "[CppCommon][Common]")
+{
+    std::string long_line(100, 'x');
+    ChunkReader source("first\r\n\nthird line\n" + long_line + "\nlast", 7);
+
+    // Small buffer forces the buffer compaction and growth
+    LineReader reader(source, 16);
+    std::string_view line;
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == "first");
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line.empty());
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == "third line");
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == long_line);
+    REQUIRE(reader.ReadLine(line));
+    REQUIRE(line == "last");
+    REQUIRE(!reader.ReadLine(line));
+    REQUIRE(reader.lines() == 5);
+
+    // Custom delimiter
+    ChunkReader csv("a,b,,c", 2);
+    LineReader fields(csv, 4, ',');
+    std::string result;
+    while (fields.ReadLine(line))
+        result += "[" + std::string(line) + "]";
+    REQUIRE(result == "[a][b][][c]");
+
+    // Read all lines skips empty lines
+    ChunkReader text("one\r\ntwo\r\rthree\n\n", 3);
+    auto lines = text.ReadAllLines();
+    REQUIRE(lines.size() == 3);
+    REQUIRE(lines[0] == "one");
+    REQUIRE(lines[1] == "two");
+    REQUIRE(lines[2] == "three");
+}
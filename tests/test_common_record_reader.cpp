@@ -0,0 +1,89 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "common/record_reader.h"
+#include "errors/exceptions.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+namespace {
+
+// Memory reader which returns data in small chunks
+class ChunkReader : public Reader
+{
+public:
+    ChunkReader(const std::vector<uint8_t>& data, size_t chunk) : _data(data), _chunk(chunk), _offset(0) {}
+
+    size_t Read(void* buffer, size_t size) override
+    {
+        size_t result = std::min(std::min(size, _chunk), _data.size() - _offset);
+        std::memcpy(buffer, _data.data() + _offset, result);
+        _offset += result;
+        return result;
+    }
+
+private:
+    std::vector<uint8_t> _data;
+    size_t _chunk;
+    size_t _offset;
+};
+
+} // namespace
+
+TEST_CASE("Record reader", "[CppCommon][Common]")
+{
+    std::span<const uint8_t> record;
+
+    // Fixed-size records
+    ChunkReader fixed({ 1, 2, 3, 4, 5, 6, 7, 8, 9 }, 2);
+    RecordReader reader1(fixed, 4);
+    REQUIRE(reader1.ReadRecord(3, record));
+    REQUIRE(record.size() == 3);
+    REQUIRE(record[0] == 1);
+    REQUIRE(reader1.ReadRecord(6, record));
+    REQUIRE(record[5] == 9);
+    REQUIRE(!reader1.ReadRecord(3, record));
+    REQUIRE(reader1.records() == 2);
+
+    // Length-prefixed records
+    std::vector<uint8_t> data;
+    for (size_t length : { 0, 3, 300 })
+    {
+        data.push_back((uint8_t)(length & 0xFF));
+        data.push_back((uint8_t)(length >> 8));
+        for (size_t i = 0; i < length; ++i)
+            data.push_back((uint8_t)i);
+    }
+    ChunkReader prefixed(data, 5);
+    RecordReader reader2(prefixed, 16);
+    REQUIRE(reader2.ReadPrefixedRecord(record, 2));
+    REQUIRE(record.empty());
+    REQUIRE(reader2.ReadPrefixedRecord(record, 2));
+    REQUIRE(record.size() == 3);
+    REQUIRE(reader2.ReadPrefixedRecord(record, 2));
+    REQUIRE(record.size() == 300);
+    REQUIRE(record[299] == (uint8_t)299);
+    REQUIRE(!reader2.ReadPrefixedRecord(record, 2));
+
+    // Truncated record
+    ChunkReader truncated({ 10, 0, 0, 0, 1, 2 }, 3);
+    RecordReader reader3(truncated);
+    REQUIRE_THROWS_AS(reader3.ReadPrefixedRecord(record), RuntimeException);
+
+    // Record greater than the maximal record size
+    ChunkReader huge({ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, 8);
+    RecordReader reader4(huge);
+    REQUIRE(reader4.max_record() == RecordReader::DEFAULT_MAX_RECORD);
+    REQUIRE_THROWS_AS(reader4.ReadPrefixedRecord(record, 8), RuntimeException);
+    ChunkReader limited({ 3, 1, 2, 3, 4, 1, 2, 3, 4 }, 4);
+    RecordReader reader5(limited, 16, 4);
+    REQUIRE(reader5.ReadPrefixedRecord(record, 1));
+    REQUIRE(record.size() == 3);
+    REQUIRE_THROWS_AS(reader5.ReadPrefixedRecord(record, 1), RuntimeException);
+    REQUIRE_THROWS_AS(reader5.ReadRecord(5, record), ArgumentException);
+}
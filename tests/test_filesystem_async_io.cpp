@@ -0,0 +1,115 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/async_io.h"
+#include "filesystem/exceptions.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+namespace {
+
+void TestAsyncIO(AsyncIOBackend backend)
+{
+    const size_t pages = 64;
+    const size_t page = 4096;
+
+    std::vector<uint8_t> output(pages * page);
+    for (size_t i = 0; i < output.size(); ++i)
+        output[i] = (uint8_t)(i / page + i);
+
+    File file("test.tmp");
+    file.OpenOrCreate(true, true, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+
+    AsyncIO engine(8, backend);
+    REQUIRE(engine.backend() == backend);
+    REQUIRE(engine.depth() == 8);
+    REQUIRE(engine.pending() == 0);
+
+    // Write pages in the reverse order with more operations than the queue depth
+    size_t written = 0;
+    for (size_t i = pages; i > 0; --i)
+        engine.Write(file, output.data() + (i - 1) * page, page, (i - 1) * page, [&written](int64_t result) { if (result > 0) written += (size_t)result; });
+    bool synced = false;
+    engine.Drain();
+    engine.Sync(file, [&synced](int64_t result) { synced = (result == 0); });
+    REQUIRE(engine.Wait() == 1);
+    REQUIRE(engine.pending() == 0);
+    REQUIRE(written == output.size());
+    REQUIRE(synced);
+    REQUIRE(file.size() == output.size());
+
+    // Read pages with registered buffers and files
+    std::vector<uint8_t> input(pages * page);
+    engine.RegisterBuffers({ { input.data(), input.size() } });
+    engine.RegisterFiles({ &file });
+    size_t read = 0;
+    for (size_t i = 0; i < pages; ++i)
+        engine.Read(file, input.data() + i * page, page, i * page, [&read](int64_t result) { if (result > 0) read += (size_t)result; });
+    engine.Drain();
+    REQUIRE(read == input.size());
+    REQUIRE(input == output);
+    engine.UnregisterFiles();
+    engine.UnregisterBuffers();
+
+    // Read with the future result
+    uint8_t buffer[16];
+    auto future = engine.Read(file, buffer, sizeof(buffer), page);
+    REQUIRE(engine.Submit() == 1);
+    engine.Wait();
+    REQUIRE(future.get() == 16);
+    REQUIRE(std::memcmp(buffer, output.data() + page, sizeof(buffer)) == 0);
+
+    // Read after the end of file
+    future = engine.Read(file, buffer, sizeof(buffer), output.size());
+    engine.Wait();
+    REQUIRE(future.get() == 0);
+
+    file.Close();
+    File::Remove(file);
+}
+
+} // namespace
+
+TEST_CASE("Asynchronous I/O engine with thread pool backend", "[CppCommon][FileSystem]")
+{
+    TestAsyncIO(AsyncIOBackend::THREADS);
+}
+
+TEST_CASE("Asynchronous I/O engine with io_uring backend", "[CppCommon][FileSystem]")
+{
+    if (AsyncIO::IsUringAvailable())
+        TestAsyncIO(AsyncIOBackend::URING);
+}
+
+TEST_CASE("Asynchronous I/O engine with direct file", "[CppCommon][FileSystem]")
+{
+    File file("test.tmp");
+    file.Create(true, true, FileAttributes::DIRECT);
+
+    alignas(4096) static uint8_t buffer[2 * 4096];
+    std::memset(buffer, 0x5A, sizeof(buffer));
+
+    AsyncIO engine(8, AsyncIOBackend::THREADS);
+    if (file.IsFileDirect())
+    {
+        // Unaligned buffer, size or offset is rejected before the submission
+        REQUIRE_THROWS_AS(engine.Write(file, buffer + 1, 4096, 0, [](int64_t) {}), FileSystemException);
+        REQUIRE_THROWS_AS(engine.Write(file, buffer, 100, 0, [](int64_t) {}), FileSystemException);
+        REQUIRE_THROWS_AS(engine.Read(file, buffer, 4096, 100, [](int64_t) {}), FileSystemException);
+        REQUIRE(engine.pending() == 0);
+    }
+
+    // Aligned operations are performed
+    int64_t written = 0;
+    engine.Write(file, buffer, 4096, 0, [&written](int64_t result) { written = result; });
+    engine.Drain();
+    REQUIRE(written == 4096);
+
+    file.Close();
+    File::Remove(file);
+}
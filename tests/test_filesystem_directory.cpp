@@ -99,6 +99,13 @@ TEST_CASE("Directory iterator", "[CppCommon][FileSystem]")
     REQUIRE(test.GetSymlinksRecursive().size() == 2);
     REQUIRE(test.GetSymlinksRecursive("test4.*").size() == 1);
 
+    // Check directory entries with the compiled pattern set
+    PatternSet patterns(".*\\.tmp");
+    REQUIRE(test.GetEntries(patterns).size() == 3);
+    REQUIRE(test.GetFilesRecursive(patterns).size() == 13);
+    REQUIRE(test.GetDirectories(PatternSet("!test1;!test2")).size() == 3);
+    REQUIRE(test.GetEntries(PatternSet()).size() == 8);
+
     // Remove complex directory structure
     REQUIRE(Directory::RemoveAll(test) == Path::current());
 }
@@ -0,0 +1,64 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <algorithm>
+#include <atomic>
+
+using namespace CppCommon;
+
+TEST_CASE("Directory scanner", "[CppCommon][FileSystem]")
+{
+    // Create the directory tree
+    Directory test = Directory::Create(Path::current() / "test");
+    for (int i = 0; i < 5; ++i)
+    {
+        Directory subdir = Directory::CreateTree(test / std::to_string(i) / "nested");
+        for (int j = 0; j < 10; ++j)
+            File::WriteAllText(subdir / (std::to_string(j) + ".txt"), std::string(j, 'x'));
+    }
+    File::WriteAllText(test / "root.txt", "root");
+    Symlink::CreateSymlink(test / "0", test / "link");
+
+    // Scan the top level only
+    auto entries = DirectoryScanner::ScanAll(test, false);
+    REQUIRE(entries.size() == 7);
+    REQUIRE(std::count_if(entries.begin(), entries.end(), [](const DirectoryEntry& entry) { return entry.type == FileType::DIRECTORY; }) == 5);
+    REQUIRE(std::count_if(entries.begin(), entries.end(), [](const DirectoryEntry& entry) { return entry.type == FileType::SYMLINK; }) == 1);
+
+    // Scan recursively with the entry status (symbolic links are not followed)
+    entries = DirectoryScanner::ScanAll(test, true, true);
+    REQUIRE(entries.size() == 7 + 5 + 50);
+    for (const auto& entry : entries)
+    {
+        if (entry.path.extension() == ".txt")
+        {
+            REQUIRE(entry.type == FileType::REGULAR);
+            REQUIRE(entry.size == File(entry.path).size());
+            REQUIRE(entry.modified > 0);
+        }
+    }
+
+    // Scan recursively in parallel
+    std::atomic<size_t> files(0);
+    std::atomic<size_t> directories(0);
+    DirectoryScanner::Scan(test, [&](const DirectoryEntry& entry)
+    {
+        if (entry.type == FileType::REGULAR)
+            ++files;
+        else if (entry.type == FileType::DIRECTORY)
+            ++directories;
+    }, true, false, 4);
+    REQUIRE(files == 51);
+    REQUIRE(directories == 10);
+    REQUIRE(DirectoryScanner::ScanAll(test, true, false, 4).size() == entries.size());
+
+    // Scan of the missing directory raises an exception
+    REQUIRE_THROWS_AS(DirectoryScanner::ScanAll(test / "missing"), FileSystemException);
+
+    Directory::RemoveAll(test);
+}
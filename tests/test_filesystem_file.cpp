@@ -5,8 +5,17 @@
 #include "test.h"
 
 #include "filesystem/filesystem.h"
+#include "system/pipe.h"
 #include "utility/countof.h"
 
+#include <atomic>
+#include <thread>
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace CppCommon;
 
 TEST_CASE("File common", "[CppCommon][FileSystem]")
@@ -66,6 +75,9 @@ TEST_CASE("File common", "[CppCommon][FileSystem]")
     test.Flush();
     REQUIRE(test.offset() == 8);
     REQUIRE(test.size() == 8);
+    test.SyncRange(0, 8);
+    test.DataSync();
+    test.Sync();
     test.Seek(0);
     REQUIRE(test.offset() == 0);
     REQUIRE(test.size() == 8);
@@ -120,3 +132,248 @@ TEST_CASE("File read/write static methods", "[CppCommon][FileSystem]")
     REQUIRE(File::ReadAllText("test.tmp") == text);
     File::Remove("test.tmp");
 }
+
+TEST_CASE("File scatter/gather and positional I/O", "[CppCommon][FileSystem]")
+{
+    std::string header = "The quick ";
+    std::string payload(20000, 'x');
+    std::string trailer = " lazy dog";
+    ConstIOBuffer output[] = { { header.data(), header.size() }, { payload.data(), payload.size() }, { trailer.data(), trailer.size() } };
+    size_t total = header.size() + payload.size() + trailer.size();
+
+    // Write small buffers through the internal buffer and large buffers directly
+    File test("test.tmp");
+    test.Create(true, true);
+    REQUIRE(test.Write("@", 1) == 1);
+    REQUIRE(test.WriteV(std::span<const ConstIOBuffer>(output, 1)) == header.size());
+    REQUIRE(test.WriteV(output) == total);
+    test.Flush();
+    REQUIRE(test.size() == 1 + header.size() + total);
+
+    // Read small and large buffers
+    test.Seek(0);
+    char first;
+    std::string buffer1(header.size(), 0);
+    IOBuffer input1[] = { { &first, 1 }, { buffer1.data(), buffer1.size() } };
+    REQUIRE(test.ReadV(input1) == 1 + header.size());
+    REQUIRE(first == '@');
+    REQUIRE(buffer1 == header);
+    std::string buffer2(header.size(), 0);
+    std::string buffer3(payload.size() + trailer.size() + 100, 0);
+    IOBuffer input2[] = { { buffer2.data(), buffer2.size() }, { buffer3.data(), buffer3.size() } };
+    REQUIRE(test.ReadV(input2) == total);
+    REQUIRE(buffer2 == header);
+    REQUIRE(buffer3.substr(0, payload.size() + trailer.size()) == payload + trailer);
+
+    // Positional read and write do not change the file offset
+    uint64_t offset = test.offset();
+    REQUIRE(test.WriteAt("THE", 3, 1 + header.size()) == 3);
+    char positional[3];
+    REQUIRE(test.ReadAt(positional, sizeof(positional), 1 + header.size()) == 3);
+    REQUIRE(std::string(positional, sizeof(positional)) == "THE");
+    IOBuffer input3[] = { { buffer1.data(), 4 }, { buffer2.data(), 6 } };
+    REQUIRE(test.ReadAt(input3, 1) == 10);
+    REQUIRE(buffer1.substr(0, 4) == "The ");
+    REQUIRE(buffer2.substr(0, 6) == "quick ");
+    REQUIRE(test.ReadAt(positional, sizeof(positional), test.size()) == 0);
+    REQUIRE(test.offset() == offset);
+    test.Close();
+
+    File::Remove(test);
+}
+
+TEST_CASE("File direct I/O", "[CppCommon][FileSystem]")
+{
+    // Prepare the data which is not aligned to the direct I/O block size
+    std::vector<uint8_t> data(3 * File::DIRECT_ALIGNMENT + 123);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = (uint8_t)(i % 251);
+
+    // Write the file with the direct I/O if it is supported by the filesystem
+    File test("test.tmp");
+    test.Create(false, true, FileAttributes::DIRECT, File::DEFAULT_PERMISSIONS, 10000);
+    REQUIRE(test.Write(data.data(), 1000) == 1000);
+    REQUIRE(test.Write(data.data() + 1000, data.size() - 1000) == data.size() - 1000);
+    test.Close();
+    REQUIRE(test.size() == data.size());
+    REQUIRE(!test.IsFileDirect());
+
+    // Read the file with the direct I/O
+    test.Open(true, false, false, FileAttributes::DIRECT);
+    test.Advise(FileAdvice::SEQUENTIAL);
+    std::vector<uint8_t> buffer(data.size() + 100);
+    size_t size = 0;
+    while (size_t result = test.Read(buffer.data() + size, 777))
+        size += result;
+    REQUIRE(size == data.size());
+    REQUIRE(std::equal(data.begin(), data.end(), buffer.begin()));
+
+    // Seek to the unaligned offset and read the tail
+    test.Seek(data.size() - 10);
+    REQUIRE(test.Read(buffer.data(), buffer.size()) == 10);
+    REQUIRE(std::equal(data.end() - 10, data.end(), buffer.begin()));
+    test.Advise(FileAdvice::DONTNEED);
+    test.Close();
+
+    File::Remove(test);
+}
+
+TEST_CASE("File direct I/O mode", "[CppCommon][FileSystem]")
+{
+    File test("test.tmp");
+    test.Create(true, true, FileAttributes::DIRECT);
+
+#if defined(__linux__)
+    // Direct I/O is enabled if the filesystem supports it
+    int probe = open(test.string().c_str(), O_RDONLY | O_DIRECT);
+    bool supported = (probe >= 0);
+    if (probe >= 0)
+        close(probe);
+    REQUIRE(test.IsFileDirect() == supported);
+    if (supported)
+        REQUIRE((fcntl((int)(size_t)test.native(), F_GETFL) & O_DIRECT) != 0);
+#endif
+
+    // Concurrent unaligned and aligned positional operations
+    const size_t threads = 4;
+    const size_t block = 1000;
+    const size_t blocks = 64;
+    std::atomic<size_t> errors(0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&test, &errors, t]()
+        {
+            std::vector<uint8_t> output(block);
+            std::vector<uint8_t> input(block);
+            for (size_t i = t; i < blocks; i += threads)
+            {
+                std::fill(output.begin(), output.end(), (uint8_t)i);
+                if (test.WriteAt(output.data(), output.size(), i * block) != output.size())
+                    ++errors;
+                if ((test.ReadAt(input.data(), input.size(), i * block) != input.size()) || (input != output))
+                    ++errors;
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    REQUIRE(errors == 0);
+
+#if defined(__linux__)
+    // Direct I/O mode is not changed by unaligned operations
+    if (supported)
+        REQUIRE((fcntl((int)(size_t)test.native(), F_GETFL) & O_DIRECT) != 0);
+#endif
+    test.Close();
+    REQUIRE(!test.IsFileDirect());
+
+    // Validate the whole file
+    std::vector<uint8_t> content = File::ReadAllBytes(test);
+    REQUIRE(content.size() == (block * blocks));
+    for (size_t i = 0; i < content.size(); ++i)
+        REQUIRE(content[i] == (uint8_t)(i / block));
+
+    File::Remove(test);
+}
+
+TEST_CASE("File zero-copy transfer", "[CppCommon][FileSystem]")
+{
+    std::string text;
+    for (int i = 0; i < 10000; ++i)
+        text += std::to_string(i);
+    File::WriteAllText("test.tmp", text);
+
+    // Copy the whole file
+    File source("test.tmp");
+    File destination("test2.tmp");
+    source.Open(true, false);
+    destination.Create(false, true);
+    REQUIRE(source.CopyTo(destination) == text.size());
+    REQUIRE(source.offset() == text.size());
+    destination.Close();
+    REQUIRE(File::ReadAllText(destination) == text);
+
+    // Copy the part of the file after the buffered read
+    source.Seek(0);
+    char buffer[10];
+    REQUIRE(source.Read(buffer, sizeof(buffer)) == sizeof(buffer));
+    destination.Open(false, true, true);
+    REQUIRE(destination.Write("#", 1) == 1);
+    REQUIRE(source.CopyTo(destination, 1000) == 1000);
+    REQUIRE(source.Read(buffer, 1) == 1);
+    REQUIRE(buffer[0] == text[1010]);
+    destination.Close();
+    REQUIRE(File::ReadAllText(destination) == "#" + text.substr(10, 1000));
+
+    // Transfer the file tail into the pipe
+    Pipe pipe;
+    source.Seek(text.size() - 100);
+    REQUIRE(source.Transfer(pipe.writer()) == 100);
+    source.Close();
+    std::string tail(100, 0);
+    REQUIRE(pipe.Read(tail.data(), tail.size()) == 100);
+    REQUIRE(tail == text.substr(text.size() - 100));
+
+    // Copy the file with the path copy
+    File::Remove(destination);
+    Path::Copy(source, destination);
+    REQUIRE(File::ReadAllText(destination) == text);
+
+    File::Remove(source);
+    File::Remove(destination);
+}
+
+TEST_CASE("File buffers", "[CppCommon][FileSystem]")
+{
+    // Pooled buffers are reused by files opened one after another
+    const uint8_t* read_buffer = nullptr;
+    const uint8_t* write_buffer = nullptr;
+    for (int i = 0; i < 10; ++i)
+    {
+        File test("test.tmp");
+        test.OpenOrCreate(true, true, true);
+        REQUIRE(test.read_buffer().empty());
+        REQUIRE(test.write_buffer().empty());
+        REQUIRE(test.Write(std::to_string(i)) == 1);
+        test.Seek(0);
+        REQUIRE(test.ReadAllText() == std::to_string(i));
+        REQUIRE(test.read_buffer().size() == File::DEFAULT_BUFFER);
+        REQUIRE(test.write_buffer().size() == File::DEFAULT_BUFFER);
+        if (i > 0)
+        {
+            REQUIRE(test.read_buffer().data() == read_buffer);
+            REQUIRE(test.write_buffer().data() == write_buffer);
+        }
+        read_buffer = test.read_buffer().data();
+        write_buffer = test.write_buffer().data();
+        test.Close();
+        REQUIRE(test.read_buffer().empty());
+        REQUIRE(test.write_buffer().empty());
+    }
+
+    // Caller supplied buffers
+    uint8_t read[16];
+    uint8_t write[16];
+    File test("test.tmp");
+    test.Open(true, true, true);
+    test.SetBuffers(read, write);
+    REQUIRE(test.Write("0123456789", 10) == 10);
+    REQUIRE(test.size() == 0);
+    REQUIRE(test.Write("ABCDEFGHIJ", 10) == 10);
+    test.Flush();
+    REQUIRE(test.size() == 20);
+    test.Seek(0);
+    REQUIRE(test.ReadAllText() == "0123456789ABCDEFGHIJ");
+    test.Close();
+
+    // Unbuffered file with empty caller supplied buffers
+    test.Open(true, false);
+    test.SetBuffers({}, {});
+    char buffer[5];
+    REQUIRE(test.Read(buffer, sizeof(buffer)) == sizeof(buffer));
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "01234");
+    test.Close();
+
+    File::Remove(test);
+}
@@ -0,0 +1,92 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/exceptions.h"
+#include "filesystem/journal_writer.h"
+
+#include <atomic>
+#include <cerrno>
+#include <thread>
+
+using namespace CppCommon;
+
+TEST_CASE("Group commit journal writer", "[CppCommon][FileSystem]")
+{
+    const size_t threads = 8;
+    const size_t records = 100;
+    const std::string record = "0123456789abcdef";
+
+    {
+        JournalWriter journal("test.tmp");
+        REQUIRE(journal.size() == 0);
+        REQUIRE(journal.Append(record.data(), record.size()) == 0);
+        REQUIRE(journal.records() == 1);
+        REQUIRE(journal.commits() == 1);
+
+        // Append records from concurrent threads
+        std::atomic<size_t> misaligned(0);
+        std::vector<std::thread> appenders;
+        for (size_t i = 0; i < threads; ++i)
+        {
+            appenders.emplace_back([&journal, &record, &misaligned]()
+            {
+                for (size_t j = 0; j < records; ++j)
+                {
+                    uint64_t offset = journal.Append(record.data(), record.size());
+                    if ((offset % record.size()) != 0)
+                        ++misaligned;
+                }
+            });
+        }
+        for (auto& appender : appenders)
+            appender.join();
+
+        REQUIRE(misaligned == 0);
+        REQUIRE(journal.records() == (threads * records + 1));
+        REQUIRE(journal.commits() <= journal.records());
+        REQUIRE(journal.size() == (threads * records + 1) * record.size());
+
+        // Append a record through the writer interface
+        REQUIRE(journal.Write(record) == record.size());
+        journal.Close();
+    }
+
+    // Reopen the journal to append at its end
+    JournalWriter journal("test.tmp");
+    REQUIRE(journal.size() == (threads * records + 2) * record.size());
+    REQUIRE(journal.Append(record.data(), record.size()) == (threads * records + 2) * record.size());
+    journal.Close();
+
+    REQUIRE(File::ReadAllText("test.tmp").size() == (threads * records + 3) * record.size());
+    File::Remove("test.tmp");
+}
+
+#if defined(__linux__)
+TEST_CASE("Group commit journal writer failure", "[CppCommon][FileSystem]")
+{
+    const std::string record = "0123456789abcdef";
+
+    // Writes into /dev/full always fail with ENOSPC
+    JournalWriter journal("/dev/full");
+
+    // The original commit failure is raised for the failed and all further appends
+    for (int i = 0; i < 2; ++i)
+    {
+        int error = 0;
+        try
+        {
+            journal.Append(record.data(), record.size());
+        }
+        catch (const FileSystemException& ex)
+        {
+            error = ex.system_error();
+        }
+        REQUIRE(error == ENOSPC);
+    }
+    REQUIRE(journal.records() == 0);
+    REQUIRE(journal.commits() == 0);
+}
+#endif
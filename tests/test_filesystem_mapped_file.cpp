@@ -0,0 +1,93 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "filesystem/filesystem.h"
+
+#include <cstring>
+
+using namespace CppCommon;
+
+TEST_CASE("Memory-mapped file", "[CppCommon][FileSystem]")
+{
+    std::string text("The quick brown fox jumps over the lazy dog");
+    File::WriteAllText("test.tmp", text);
+
+    // Map the whole file for reading
+    MappedFile test("test.tmp");
+    REQUIRE(!test.IsMapped());
+    test.Map(false);
+    REQUIRE(test.IsMapped());
+    REQUIRE(!test.IsWritable());
+    REQUIRE(test.offset() == 0);
+    REQUIRE(test.size() == text.size());
+    REQUIRE(std::memcmp(test.data(), text.data(), text.size()) == 0);
+    test.Advise(MappedFileAdvice::SEQUENTIAL);
+    REQUIRE(test.ReadAllText() == text);
+    REQUIRE(test.position() == text.size());
+    test.Unmap();
+    REQUIRE(!test.IsMapped());
+
+    // Map the unaligned file window for reading
+    test.Map(false, 4, 5);
+    REQUIRE(test.offset() == 4);
+    REQUIRE(test.size() == 5);
+    REQUIRE(std::string((const char*)test.data(), test.size()) == "quick");
+    test.Unmap();
+
+    // Map the window out of the file bounds
+    REQUIRE_THROWS_AS(test.Map(false, 40, 10), FileSystemException);
+    REQUIRE(!test.IsMapped());
+
+    // Map the whole file for writing
+    test.Map(true);
+    REQUIRE(test.IsWritable());
+    test.Seek(4);
+    REQUIRE(test.Write("QUICK", 5) == 5);
+    REQUIRE(test.position() == 9);
+    test.Seek(test.size() - 3);
+    REQUIRE(test.Write("DOG and cat", 11) == 3);
+
+    // Grow the file and the mapped window
+    test.Resize(text.size() + 8);
+    REQUIRE(test.size() == text.size() + 8);
+    test.Seek(text.size());
+    REQUIRE(test.Write(" and cat", 8) == 8);
+    test.Sync(4, 5);
+    test.Flush();
+    test.Unmap();
+    REQUIRE(File::ReadAllText("test.tmp") == "The QUICK brown fox jumps over the lazy DOG and cat");
+
+    // Shrink the file which is not mapped
+    test.Resize(9);
+    REQUIRE(File::ReadAllText("test.tmp") == "The QUICK");
+
+    // Map the file with huge page alignment
+    test.Map(false, 0, 0, true);
+    REQUIRE(test.size() == 9);
+    REQUIRE(std::string((const char*)test.data(), test.size()) == "The QUICK");
+    test.Unmap();
+
+    File::Remove("test.tmp");
+}
+
+TEST_CASE("Memory-mapped empty file", "[CppCommon][FileSystem]")
+{
+    File::WriteEmpty("test.tmp");
+
+    MappedFile test("test.tmp");
+    test.Map(true);
+    REQUIRE(test.IsMapped());
+    REQUIRE(test.size() == 0);
+    REQUIRE(test.data() == nullptr);
+    REQUIRE(test.Write("test", 4) == 0);
+    test.Resize(4);
+    REQUIRE(test.size() == 4);
+    REQUIRE(test.Write("test", 4) == 4);
+    test.Unmap();
+    REQUIRE(File::ReadAllText("test.tmp") == "test");
+
+    File::Remove("test.tmp");
+}
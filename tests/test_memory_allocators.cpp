@@ -4,13 +4,18 @@
 
 #include "test.h"
 
+#include "containers/flatmap.h"
+#include "containers/hashmap.h"
+
 #include "memory/allocator.h"
 #include "memory/allocator_arena.h"
 #include "memory/allocator_heap.h"
 #include "memory/allocator_null.h"
 #include "memory/allocator_pool.h"
+#include "memory/allocator_shared.h"
 #include "memory/allocator_stack.h"
 
+#include <cstring>
 #include <list>
 #include <map>
 #include <vector>
@@ -442,3 +447,145 @@ TEST_CASE("Pool allocator with stl associative containers", "[CppCommon][Memory]
     u[2] = 20;
     u.clear();
 }
+
+TEST_CASE("Offset pointer", "[CppCommon][Memory]")
+{
+    int values[3] = { 0, 10, 20 };
+
+    OffsetPtr<int> ptr1;
+    REQUIRE(!ptr1);
+    REQUIRE(ptr1 == nullptr);
+    REQUIRE(ptr1.get() == nullptr);
+
+    ptr1 = values;
+    REQUIRE(ptr1);
+    REQUIRE(*ptr1 == 0);
+    REQUIRE(ptr1[2] == 20);
+
+    OffsetPtr<int> ptr2(ptr1);
+    REQUIRE(ptr2 == ptr1);
+    REQUIRE(*++ptr2 == 10);
+    REQUIRE((ptr2 - ptr1) == 1);
+    REQUIRE(ptr1 < ptr2);
+    REQUIRE(*(ptr1 + 2) == 20);
+
+    OffsetPtr<void> ptr3(ptr2);
+    REQUIRE(static_cast<OffsetPtr<int>>(ptr3) == ptr2);
+    REQUIRE(OffsetPtr<int>::pointer_to(values[2]).get() == &values[2]);
+}
+
+TEST_CASE("Shared memory manager with a fixed buffer", "[CppCommon][Memory]")
+{
+    alignas(std::max_align_t) uint8_t buffer[4096];
+
+    REQUIRE(SharedMemoryManager::Attach(buffer) == nullptr);
+
+    SharedMemoryManager* manager = SharedMemoryManager::Create(buffer, sizeof(buffer));
+    REQUIRE(manager != nullptr);
+    REQUIRE(SharedMemoryManager::Attach(buffer) == manager);
+    REQUIRE(manager->capacity() == sizeof(buffer));
+    REQUIRE(manager->allocated() == 0);
+    REQUIRE(manager->allocations() == 0);
+
+    void* ptr1 = manager->malloc(10);
+    REQUIRE(ptr1 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr1, alignof(std::max_align_t)));
+    void* ptr2 = manager->malloc(100, 64);
+    REQUIRE(ptr2 != nullptr);
+    REQUIRE(Memory::IsAligned(ptr2, 64));
+    void* ptr3 = manager->malloc(1000);
+    REQUIRE(ptr3 != nullptr);
+    REQUIRE(manager->allocated() == 1110);
+    REQUIRE(manager->allocations() == 3);
+
+    // Out of memory
+    REQUIRE(manager->malloc(4000) == nullptr);
+
+    // Freed blocks must be merged together
+    manager->free(ptr2, 100);
+    manager->free(ptr1, 10);
+    manager->free(ptr3, 1000);
+    REQUIRE(manager->allocated() == 0);
+    REQUIRE(manager->allocations() == 0);
+    void* ptr4 = manager->malloc(3000);
+    REQUIRE(ptr4 != nullptr);
+    manager->free(ptr4, 3000);
+
+    manager->reset();
+    REQUIRE(manager->allocated() == 0);
+    REQUIRE(manager->allocations() == 0);
+}
+
+TEST_CASE("Shared allocator with containers", "[CppCommon][Memory]")
+{
+    typedef SharedAllocator<int> IntAllocator;
+    typedef SharedAllocator<std::pair<int, int>> PairAllocator;
+    typedef std::vector<int, IntAllocator> SharedVector;
+    typedef HashMap<int, int, std::hash<int>, std::equal_to<int>, PairAllocator> SharedHashMap;
+    typedef FlatMap<int, int, std::less<int>, PairAllocator> SharedFlatMap;
+
+    struct Root
+    {
+        SharedVector vector;
+        SharedHashMap hashmap;
+        SharedFlatMap flatmap;
+
+        explicit Root(SharedMemoryManager& manager)
+            : vector(IntAllocator(manager)),
+              hashmap(16, -1, std::hash<int>(), std::equal_to<int>(), PairAllocator(manager)),
+              flatmap(16, std::less<int>(), PairAllocator(manager))
+        {}
+    };
+
+    alignas(std::max_align_t) static uint8_t buffer1[65536];
+    alignas(std::max_align_t) static uint8_t buffer2[65536];
+
+    // Build containers in the first buffer
+    SharedMemoryManager* manager = SharedMemoryManager::Create(buffer1, sizeof(buffer1));
+    Root* root = new(manager->malloc(sizeof(Root), alignof(Root))) Root(*manager);
+    manager->SetRoot(root);
+    for (int i = 0; i < 100; ++i)
+    {
+        root->vector.push_back(i);
+        root->hashmap.emplace(i, i * 10);
+        root->flatmap.emplace(i, i * 100);
+    }
+
+    // Copy the buffer to another address to emulate a different mapping
+    std::memcpy(buffer2, buffer1, sizeof(buffer1));
+    SharedMemoryManager* attached = SharedMemoryManager::Attach(buffer2);
+    REQUIRE(attached != nullptr);
+    Root* other = (Root*)attached->root();
+    REQUIRE((uint8_t*)other == (buffer2 + ((uint8_t*)root - buffer1)));
+    REQUIRE(other->vector.size() == 100);
+    REQUIRE(other->hashmap.size() == 100);
+    REQUIRE(other->flatmap.size() == 100);
+    for (int i = 0; i < 100; ++i)
+    {
+        REQUIRE(other->vector[i] == i);
+        auto it1 = other->hashmap.find(i);
+        REQUIRE(it1 != other->hashmap.end());
+        REQUIRE(it1->second == i * 10);
+        auto it2 = other->flatmap.find(i);
+        REQUIRE(it2 != other->flatmap.end());
+        REQUIRE(it2->second == i * 100);
+    }
+
+    // Modify containers through the attached manager
+    other->vector.push_back(100);
+    other->hashmap.emplace(100, 1000);
+    other->flatmap.erase(0);
+    REQUIRE(other->vector.size() == 101);
+    REQUIRE(other->hashmap.size() == 101);
+    REQUIRE(other->flatmap.size() == 99);
+
+    // Destroy containers
+    other->~Root();
+    attached->free(other, sizeof(Root));
+    REQUIRE(attached->allocated() == 0);
+    REQUIRE(attached->allocations() == 0);
+    root->~Root();
+    manager->free(root, sizeof(Root));
+    REQUIRE(manager->allocated() == 0);
+    REQUIRE(manager->allocations() == 0);
+}
@@ -4,6 +4,7 @@
 
 #include "test.h"
 
+#include "errors/exceptions.h"
 #include "string/encoding.h"
 
 using namespace CppCommon;
@@ -39,6 +40,89 @@ TEST_CASE("Encoding", "[CppCommon][String]")
     test("\xF0\x9D\x93\x83", u"\xD835\xDCC3", U"\x0001D4C3");
 }
 
+TEST_CASE("UTF-8 validation", "[CppCommon][String]")
+{
+    REQUIRE(Encoding::IsValidUTF8(""));
+    REQUIRE(Encoding::IsValidUTF8("Hello, World!"));
+    REQUIRE(Encoding::IsValidUTF8("\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"));
+
+    // Overlong encodings
+    REQUIRE(!Encoding::IsValidUTF8("\xC0\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xC1\xBF"));
+    REQUIRE(!Encoding::IsValidUTF8("\xE0\x9F\xBF"));
+    REQUIRE(!Encoding::IsValidUTF8("\xF0\x8F\xBF\xBF"));
+    // Surrogates
+    REQUIRE(!Encoding::IsValidUTF8("\xED\xA0\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xED\xBF\xBF"));
+    // Code points above U+10FFFF
+    REQUIRE(!Encoding::IsValidUTF8("\xF4\x90\x80\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xF5\x80\x80\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xFF"));
+    // Truncated and unexpected continuation bytes
+    REQUIRE(!Encoding::IsValidUTF8("\xC2"));
+    REQUIRE(!Encoding::IsValidUTF8("\xE1\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xF1\x80\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\x80"));
+    REQUIRE(!Encoding::IsValidUTF8("\xC2\x80\x80"));
+
+    // Invalid sequences at every position of the long string
+    std::string text;
+    for (size_t i = 0; i < 10; ++i)
+        text += "ASCII text \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 ";
+    REQUIRE(Encoding::IsValidUTF8(text));
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        std::string invalid = text;
+        invalid[i] = (char)0xFF;
+        REQUIRE(!Encoding::IsValidUTF8(invalid));
+        REQUIRE(!Encoding::IsValidUTF8(text.substr(0, i) + "\xE1\x80"));
+    }
+}
+
+TEST_CASE("UTF-8 counting", "[CppCommon][String]")
+{
+    std::string text;
+    for (size_t i = 0; i < 10; ++i)
+        text += "ASCII text \xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE6\x97\xA5\xE6\x9C\xAC \xF0\x9F\x98\x80 ";
+    std::u16string utf16 = Encoding::UTF8toUTF16(text);
+    std::u32string utf32 = Encoding::UTF8toUTF32(text);
+
+    REQUIRE(Encoding::CountUTF8(text) == utf32.size());
+    REQUIRE(Encoding::UTF16Length(text) == utf16.size());
+    REQUIRE(Encoding::UTF8Length(utf16) == text.size());
+    REQUIRE(Encoding::UTF8Length(utf32) == text.size());
+    REQUIRE(Encoding::IsValidUTF16(utf16));
+    REQUIRE(!Encoding::IsValidUTF16(u"\xD835"));
+    REQUIRE(!Encoding::IsValidUTF16(u"\xDCC3\xD835"));
+}
+
+TEST_CASE("UTF conversion into buffer", "[CppCommon][String]")
+{
+    std::string utf8 = "prefix:";
+    REQUIRE(Encoding::UTF16toUTF8(u"\x0061\xD835\xDCC3", utf8));
+    REQUIRE(Encoding::UTF32toUTF8(U"\x00002126", utf8));
+    REQUIRE(utf8 == "prefix:\x61\xF0\x9D\x93\x83\xE2\x84\xA6");
+
+    std::u16string utf16 = u"prefix:";
+    REQUIRE(Encoding::UTF8toUTF16("\x61\xF0\x9D\x93\x83", utf16));
+    REQUIRE(Encoding::UTF32toUTF16(U"\x00002126", utf16));
+    REQUIRE(utf16 == u"prefix:\x0061\xD835\xDCC3\x2126");
+
+    std::u32string utf32 = U"prefix:";
+    REQUIRE(Encoding::UTF8toUTF32("\x61\xF0\x9D\x93\x83", utf32));
+    REQUIRE(Encoding::UTF16toUTF32(u"\x2126", utf32));
+    REQUIRE(utf32 == U"prefix:\x00000061\x0001D4C3\x00002126");
+
+    // Invalid strings leave the buffer unchanged
+    REQUIRE(!Encoding::UTF8toUTF16("\xED\xA0\x80", utf16));
+    REQUIRE(utf16 == u"prefix:\x0061\xD835\xDCC3\x2126");
+    REQUIRE(!Encoding::UTF16toUTF8(u"\xD835", utf8));
+    REQUIRE(utf8 == "prefix:\x61\xF0\x9D\x93\x83\xE2\x84\xA6");
+    REQUIRE(!Encoding::UTF32toUTF16(U"\x00110000", utf16));
+    REQUIRE(utf16 == u"prefix:\x0061\xD835\xDCC3\x2126");
+    REQUIRE_THROWS_AS(Encoding::UTF8toUTF32("\xC0\x80"), ArgumentException);
+}
+
 TEST_CASE("Base16 Encoding", "[CppCommon][String]")
 {
     REQUIRE(Encoding::Base16Encode("") == "");
@@ -78,6 +162,166 @@ TEST_CASE("Base64 Encoding", "[CppCommon][String]")
     REQUIRE(Encoding::Base64Decode("U2FtcGxlIEJhc2U2NCBlbmNvZGluZzogfmAnIiE/QCMkJV4mKigpe31bXTw+LC46Oy0rPV98L1w=") == "Sample Base64 encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\");
 }
 
+TEST_CASE("Base Encoding of large data", "[CppCommon][String]")
+{
+    // Repeated blocks cover vectorized and scalar code paths
+    for (size_t count = 0; count < 100; ++count)
+    {
+        std::string data, base16, base32, base64;
+        for (size_t i = 0; i < count; ++i)
+        {
+            data += "fooba";
+            base16 += "666F6F6261";
+            base32 += "MZXW6YTB";
+        }
+        for (size_t i = 0; i < (data.size() / 3); ++i)
+            base64 += (i % 5 == 0) ? "Zm9v" : (i % 5 == 1) ? "YmFm" : (i % 5 == 2) ? "b29i" : (i % 5 == 3) ? "YWZv" : "b2Jh";
+        REQUIRE(Encoding::Base16Encode(data) == base16);
+        REQUIRE(Encoding::Base16Decode(base16) == data);
+        REQUIRE(Encoding::Base32Encode(data) == base32);
+        REQUIRE(Encoding::Base32Decode(base32) == data);
+        REQUIRE(Encoding::Base64Encode(data).substr(0, base64.size()) == base64);
+        REQUIRE(Encoding::Base64Decode(Encoding::Base64Encode(data)) == data);
+    }
+
+    // Round trip of all byte values with unaligned lengths
+    std::string bytes;
+    for (size_t i = 0; i < 1000; ++i)
+        bytes += (char)((i * 131 + 7) % 256);
+    for (size_t size = 0; size < bytes.size(); size += 7)
+    {
+        std::string data = bytes.substr(0, size);
+        REQUIRE(Encoding::Base16Decode(Encoding::Base16Encode(data)) == data);
+        REQUIRE(Encoding::Base32Decode(Encoding::Base32Encode(data)) == data);
+        REQUIRE(Encoding::Base64Decode(Encoding::Base64Encode(data)) == data);
+    }
+
+    // Lower case Base16
+    REQUIRE(Encoding::Base16Decode("666f6f626172666f6f626172666f6f626172666f6f626172666f6f626172666f6f626172") == "foobarfoobarfoobarfoobarfoobarfoobar");
+}
+
+TEST_CASE("Base Encoding into buffer", "[CppCommon][String]")
+{
+    std::string buffer = "prefix:";
+    Encoding::Base16Encode("foobar", buffer);
+    REQUIRE(buffer == "prefix:666F6F626172");
+    buffer.clear();
+    Encoding::Base32Encode("foobar", buffer);
+    REQUIRE(buffer == "MZXW6YTBOI======");
+    buffer.clear();
+    Encoding::Base64Encode("foobar", buffer);
+    Encoding::Base64Encode("foob", buffer);
+    REQUIRE(buffer == "Zm9vYmFyZm9vYg==");
+
+    buffer = "prefix:";
+    REQUIRE(Encoding::Base16Decode("666F6F626172", buffer));
+    REQUIRE(buffer == "prefix:foobar");
+    REQUIRE(Encoding::Base32Decode("MZXW6YTBOI======", buffer));
+    REQUIRE(buffer == "prefix:foobarfoobar");
+    REQUIRE(Encoding::Base64Decode("Zm9vYg==", buffer));
+    REQUIRE(buffer == "prefix:foobarfoobarfoob");
+
+    // Invalid input leaves the buffer unchanged
+    buffer = "prefix:";
+    REQUIRE(!Encoding::Base64Decode("Zm9", buffer));
+    REQUIRE(buffer == "prefix:");
+    REQUIRE(Encoding::Base64Decode("", buffer));
+    REQUIRE(buffer == "prefix:");
+
+    // Invalid characters are rejected
+    REQUIRE(!Encoding::Base16Decode("666G", buffer));
+    REQUIRE(!Encoding::Base16Decode("66 6", buffer));
+    REQUIRE(!Encoding::Base16Decode("66\xC6", buffer));
+    REQUIRE(!Encoding::Base32Decode("MZXW6YT!", buffer));
+    REQUIRE(!Encoding::Base32Decode("MZ=W6YTB", buffer));
+    REQUIRE(!Encoding::Base32Decode("MZXW6===MZXW6YTB", buffer));
+    REQUIRE(!Encoding::Base32Decode("MZXW6Y==", buffer));
+    REQUIRE(!Encoding::Base64Decode("Zm9v!mFy", buffer));
+    REQUIRE(!Encoding::Base64Decode("Zm9vYm\nF", buffer));
+    REQUIRE(!Encoding::Base64Decode("Zm9v\xC6mFy", buffer));
+    REQUIRE(buffer == "prefix:");
+
+    // Padding is allowed only at the end
+    REQUIRE(!Encoding::Base64Decode("Zg==Zm9v", buffer));
+    REQUIRE(!Encoding::Base64Decode("Zm=v", buffer));
+    REQUIRE(!Encoding::Base64Decode("Z===", buffer));
+    REQUIRE(!Encoding::Base64Decode("====", buffer));
+    REQUIRE(buffer == "prefix:");
+    REQUIRE(Encoding::Base64Decode("Zm8=", buffer));
+    REQUIRE(buffer == "prefix:fo");
+
+    // Invalid characters of long strings are found by vectorized decoders
+    std::string base16 = Encoding::Base16Encode(std::string(100, 'x'));
+    std::string base64 = Encoding::Base64Encode(std::string(100, 'x'));
+    for (size_t i = 0; i < base16.size(); i += 7)
+    {
+        std::string invalid = base16;
+        invalid[i] = 'G';
+        REQUIRE(!Encoding::Base16Decode(invalid, buffer));
+    }
+    for (size_t i = 0; i < (base64.size() - 4); i += 7)
+    {
+        std::string invalid = base64;
+        invalid[i] = (i % 2) ? '=' : '*';
+        REQUIRE(!Encoding::Base64Decode(invalid, buffer));
+    }
+    REQUIRE(buffer == "prefix:fo");
+}
+
+TEST_CASE("Base64 streaming", "[CppCommon][String]")
+{
+    std::string data;
+    for (size_t i = 0; i < 1000; ++i)
+        data += (char)((i * 131 + 7) % 256);
+    std::string base64 = Encoding::Base64Encode(data);
+
+    for (size_t chunk = 1; chunk < 64; chunk += 5)
+    {
+        Base64Encoder encoder;
+        std::string encoded;
+        for (size_t i = 0; i < data.size(); i += chunk)
+            encoder.Encode(std::string_view(data).substr(i, chunk), encoded);
+        encoder.Finish(encoded);
+        REQUIRE(encoded == base64);
+
+        Base64Decoder decoder;
+        std::string decoded;
+        for (size_t i = 0; i < base64.size(); i += chunk)
+            decoder.Decode(std::string_view(base64).substr(i, chunk), decoded);
+        REQUIRE(decoder.Finish());
+        REQUIRE(decoded == data);
+    }
+
+    // Truncated Base64 data
+    Base64Decoder decoder;
+    std::string decoded;
+    REQUIRE(decoder.Decode("Zm9vYmF", decoded));
+    REQUIRE(decoded == "foo");
+    REQUIRE(!decoder.Finish());
+
+    // Invalid Base64 data
+    decoded.clear();
+    REQUIRE(decoder.Decode("Zm9v", decoded));
+    REQUIRE(!decoder.Decode("Ym*y", decoded));
+    REQUIRE(!decoder.Decode("YmFy", decoded));
+    REQUIRE(decoded == "foo");
+    REQUIRE(!decoder.Finish());
+
+    // Data after the padding
+    decoded.clear();
+    REQUIRE(decoder.Decode("Zm", decoded));
+    REQUIRE(decoder.Decode("8=", decoded));
+    REQUIRE(decoded == "fo");
+    REQUIRE(!decoder.Decode("Zm9v", decoded));
+    REQUIRE(!decoder.Finish());
+
+    // Decoder is reusable after finish
+    decoded.clear();
+    REQUIRE(decoder.Decode("Zm8=", decoded));
+    REQUIRE(decoder.Finish());
+    REQUIRE(decoded == "fo");
+}
+
 TEST_CASE("URL Encoding", "[CppCommon][String]")
 {
     REQUIRE(Encoding::URLEncode("Sample URL encoding: ~`'\"!?@#$%^&*(){}[]<>,.:;-+=_|/\\") == "Sample+URL+encoding%3A+~%60%27%22%21%3F%40%23%24%25%5E%26%2A%28%29%7B%7D%5B%5D%3C%3E%2C.%3A%3B-%2B%3D_%7C/%5C");
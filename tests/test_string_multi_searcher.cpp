@@ -0,0 +1,116 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "string/multi_searcher.h"
+#include "string/string_utils.h"
+
+using namespace CppCommon;
+
+namespace {
+
+// Reference search: the first match by its end position, the longest one at the same end
+bool ReferenceFind(const std::vector<std::string>& patterns, std::string_view str, size_t position, bool ignore_case, MultiSearcher::Match& match)
+{
+    for (size_t end = position + 1; end <= str.size(); ++end)
+    {
+        bool found = false;
+        for (size_t i = 0; i < patterns.size(); ++i)
+        {
+            const std::string& pattern = patterns[i];
+            if ((pattern.size() > (end - position)) || (found && (pattern.size() <= match.size)))
+                continue;
+            std::string_view candidate = str.substr(end - pattern.size(), pattern.size());
+            if (ignore_case ? StringUtils::CompareNoCase(candidate, pattern) : (candidate == pattern))
+            {
+                match = { i, end - pattern.size(), pattern.size() };
+                found = true;
+            }
+        }
+        if (found)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
+TEST_CASE("Multiple substrings searcher", "[CppCommon][String]")
+{
+    MultiSearcher empty;
+    REQUIRE(empty.empty());
+    REQUIRE(!empty.Contains("test"));
+    REQUIRE(empty.CountAll("test") == 0);
+
+    MultiSearcher searcher({ "he", "she", "his", "hers" });
+    REQUIRE(searcher.size() == 4);
+    REQUIRE(searcher.Contains("ushers"));
+    REQUIRE(!searcher.Contains("unknown"));
+
+    MultiSearcher::Match match;
+    REQUIRE(searcher.Find("ushers", match));
+    REQUIRE(match.pattern == 1);
+    REQUIRE(match.position == 1);
+    REQUIRE(match.size == 3);
+
+    auto matches = searcher.FindAll("ushers and his hero");
+    REQUIRE(matches.size() == 3);
+    REQUIRE(matches[0].pattern == 1);
+    REQUIRE(matches[1].pattern == 2);
+    REQUIRE(matches[1].position == 11);
+    REQUIRE(matches[2].pattern == 0);
+    REQUIRE(matches[2].position == 15);
+    REQUIRE(searcher.CountAll("ushers and his hero") == 3);
+
+    std::string str = "ushers and his hero";
+    REQUIRE(searcher.ReplaceAll(str, { "HE", "SHE", "HIS", "HERS" }));
+    REQUIRE(str == "uSHErs and HIS HEro");
+    REQUIRE(!searcher.ReplaceAll(str, { "HE", "SHE", "HIS", "HERS" }));
+    REQUIRE_THROWS_AS(searcher.ReplaceAll(str, { "HE" }), ArgumentException);
+    REQUIRE_THROWS_AS(MultiSearcher({ "a", "" }), ArgumentException);
+
+    // Case insensitive search
+    MultiSearcher headers({ "content-length", "transfer-encoding" }, true);
+    REQUIRE(headers.Contains("GET / HTTP/1.1\r\nTransfer-Encoding: chunked\r\n"));
+    REQUIRE(headers.CountAll("Content-Length: 0\r\nCONTENT-LENGTH: 1\r\n") == 2);
+    REQUIRE(!headers.Contains("Content-Type: text/plain\r\n"));
+}
+
+TEST_CASE("Multiple substrings searcher against reference", "[CppCommon][String]")
+{
+    std::string text;
+    for (size_t i = 0; i < 500; ++i)
+        text += (char)("abcABC\x80\xFF-"[(i * 7919 + i / 3) % 9]);
+
+    std::vector<std::vector<std::string>> sets = {
+        { "a" },
+        { "ab", "b", "abc" },
+        { "aa", "aB", "Ca", "\x80\xFF" },
+        { "abcABC", "bcA", "c", "-" },
+        { "a", "b", "c", "A", "B", "C", "\x80", "\xFF", "-" }
+    };
+
+    for (const auto& patterns : sets)
+    {
+        for (bool ignore_case : { false, true })
+        {
+            MultiSearcher searcher(patterns, ignore_case);
+            for (size_t position = 0; position < text.size(); position += 17)
+            {
+                MultiSearcher::Match expected = { 0, 0, 0 };
+                MultiSearcher::Match actual = { 0, 0, 0 };
+                bool found = ReferenceFind(patterns, text, position, ignore_case, expected);
+                REQUIRE(searcher.Find(text, actual, position) == found);
+                if (found)
+                {
+                    REQUIRE(actual.pattern == expected.pattern);
+                    REQUIRE(actual.position == expected.position);
+                    REQUIRE(actual.size == expected.size);
+                }
+            }
+        }
+    }
+}
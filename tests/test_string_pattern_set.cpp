@@ -0,0 +1,73 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "string/pattern_set.h"
+
+#include <regex>
+
+using namespace CppCommon;
+
+TEST_CASE("Pattern set", "[CppCommon][String]")
+{
+    PatternSet patterns1("Demo.*;Live.*");
+    REQUIRE(patterns1.size() == 2);
+    REQUIRE(patterns1.Match("DemoAccount"));
+    REQUIRE(patterns1.Match("LiveAccount"));
+    REQUIRE(!patterns1.Match("UnknownAccount"));
+
+    PatternSet patterns2("!Demo.*;!Live.*");
+    REQUIRE(!patterns2.Match("DemoAccount"));
+    REQUIRE(!patterns2.Match("LiveAccount"));
+    REQUIRE(patterns2.Match("UnknownAccount"));
+
+    // Invalid pattern never matches, but keeps the negative result
+    PatternSet patterns3("!Demo.*;![");
+    REQUIRE(!patterns3.Match("DemoAccount"));
+    REQUIRE(patterns3.Match("UnknownAccount"));
+
+    PatternSet patterns4;
+    REQUIRE(patterns4.empty());
+    REQUIRE(!patterns4.Match("test"));
+    patterns4.Add(".*\\.txt");
+    patterns4.Add("temp.*", true);
+    REQUIRE(patterns4.Match("file.txt"));
+    REQUIRE(patterns4.Match("temp.txt"));
+    REQUIRE(!patterns4.Match("temp.bak"));
+    REQUIRE(patterns4.Match("file.bak"));
+    REQUIRE_THROWS_AS(patterns4.Add("(abc"), ArgumentException);
+    patterns4.Clear();
+    REQUIRE(patterns4.empty());
+
+    REQUIRE(PatternSet::FromRegex("").empty());
+    REQUIRE(PatternSet::FromRegex("a;b").Match("a;b"));
+}
+
+TEST_CASE("Pattern set matchers", "[CppCommon][String]")
+{
+    const char* patterns[] = {
+        // Glob matcher
+        "", "abc", "^abc$", ".*", ".*\\.log", "test.*", ".*test.*", "a.*b.*c", "a.*?c",
+        // DFA matcher
+        "[a-z_]+_\\d{4}\\.(log|txt)", "(?:ab|cd)*", "a{2,3}b?", "[^.]+", "\\w+\\s\\w+", "a|b|", ".\\..",
+        // std::regex matcher
+        "(a)\\1", "a(?=b)b", "\\bab"
+    };
+    const char* strings[] = {
+        "", "abc", "ab", "abcabc", "test", "test.log", "a.log", "my_test_file", "aXbYc", "ac", "abbc",
+        "file_2016.log", "file_16.txt", "abcd", "cdab", "aa", "aaab", "aab", "no.dots", "hello world",
+        "a", "b", "a.b", "line\nbreak", "aa", "ab"
+    };
+
+    for (auto pattern : patterns)
+    {
+        PatternSet set;
+        set.Add(pattern);
+        std::regex regex(pattern);
+        for (auto str : strings)
+            REQUIRE(set.Match(str) == std::regex_match(str, regex));
+    }
+}
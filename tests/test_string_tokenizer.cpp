@@ -0,0 +1,159 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "string/string_utils.h"
+#include "string/tokenizer.h"
+
+using namespace CppCommon;
+
+namespace {
+
+std::vector<std::string> Collect(StringTokenizer tokenizer)
+{
+    std::vector<std::string> result;
+    for (auto token : tokenizer)
+        result.emplace_back(token);
+    return result;
+}
+
+class TestWriter : public Writer
+{
+public:
+    std::string data;
+    size_t calls = 0;
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        data.append((const char*)buffer, size);
+        return size;
+    }
+
+    size_t WriteV(std::span<const ConstIOBuffer> buffers) override
+    {
+        ++calls;
+        return Writer::WriteV(buffers);
+    }
+};
+
+} // namespace
+
+TEST_CASE("String tokenizer", "[CppCommon][String]")
+{
+    // Same semantics as split by character
+    for (auto str : { "", ",", "a", "a,b", ",a,,b,", ",,,", "a foo a bar a baz" })
+    {
+        for (bool skip_empty : { false, true })
+        {
+            REQUIRE(Collect(StringTokenizer(str, ',', skip_empty)) == StringUtils::Split(str, ',', skip_empty));
+            REQUIRE(Collect(StringTokenizer(str, "a ", skip_empty)) == StringUtils::Split(str, "a ", skip_empty));
+            REQUIRE(Collect(StringTokenizer::ByAny(str, ", ", skip_empty)) == StringUtils::SplitByAny(str, ", ", skip_empty));
+        }
+    }
+
+    REQUIRE(Collect(StringTokenizer("a,b", ',')) == std::vector<std::string>({ "a", "b" }));
+    REQUIRE(Collect(StringTokenizer(",a,,b,", ',')) == std::vector<std::string>({ "", "a", "", "b", "" }));
+    REQUIRE(Collect(StringTokenizer(",a,,b,", ',', true)) == std::vector<std::string>({ "a", "b" }));
+    REQUIRE(Collect(StringTokenizer("a::b::::c", "::")) == std::vector<std::string>({ "a", "b", "", "c" }));
+    REQUIRE(Collect(StringTokenizer("abc", "")) == std::vector<std::string>({ "abc" }));
+    REQUIRE(Collect(StringTokenizer("", ',')) == std::vector<std::string>({ "" }));
+    REQUIRE(Collect(StringTokenizer("", ',', true)).empty());
+
+    // Tokens refer to the source string
+    std::string source = "key=value";
+    StringTokenizer tokenizer(source, '=');
+    std::string_view token;
+    REQUIRE(tokenizer.Next(token));
+    REQUIRE(token == "key");
+    REQUIRE(token.data() == source.data());
+    REQUIRE(tokenizer.rest() == "value");
+    REQUIRE(tokenizer.Next(token));
+    REQUIRE(token == "value");
+    REQUIRE(tokenizer.rest().empty());
+    REQUIRE(!tokenizer.Next(token));
+    REQUIRE(!tokenizer.Next(token));
+    tokenizer.Reset();
+    REQUIRE(tokenizer.Next(token));
+    REQUIRE(token == "key");
+
+    // Iterator
+    StringTokenizer words("one two three", ' ');
+    auto it = words.begin();
+    REQUIRE(it != words.end());
+    REQUIRE(*it == "one");
+    REQUIRE(it->size() == 3);
+    REQUIRE(*(++it) == "two");
+    REQUIRE(*(it++) == "two");
+    REQUIRE(*it == "three");
+    REQUIRE(++it == words.end());
+}
+
+TEST_CASE("String tokenizer by any delimiter", "[CppCommon][String]")
+{
+    // Long strings cover both vectorized and scalar search paths
+    std::string str;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        str += std::to_string(i * 7919);
+        str += " ,;\t|:\x80\xFF"[i % 8];
+    }
+
+    for (auto delimiters : { ",", ";,", " ,;\t", " ,;\t|:\x80\xFF", " ,;\t|:\x80\xFF" "0", "" })
+    {
+        for (bool skip_empty : { false, true })
+        {
+            REQUIRE(Collect(StringTokenizer::ByAny(str, delimiters, skip_empty)) == StringUtils::SplitByAny(str, delimiters, skip_empty));
+            for (size_t offset = 0; offset < 40; ++offset)
+                REQUIRE(Collect(StringTokenizer::ByAny(std::string_view(str).substr(offset, 50 + offset), delimiters, skip_empty)) == StringUtils::SplitByAny(std::string_view(str).substr(offset, 50 + offset), delimiters, skip_empty));
+        }
+    }
+
+    REQUIRE(Collect(StringUtils::TokenizeByAny("a b,c;;d", " ,;", true)) == std::vector<std::string>({ "a", "b", "c", "d" }));
+    REQUIRE(Collect(StringUtils::Tokenize("a b", ' ')) == std::vector<std::string>({ "a", "b" }));
+    REQUIRE(Collect(StringUtils::Tokenize("a--b", "--")) == std::vector<std::string>({ "a", "b" }));
+}
+
+TEST_CASE("Join into buffer", "[CppCommon][String]")
+{
+    std::string result = "prefix:";
+    REQUIRE(StringUtils::Join(result, StringUtils::Tokenize("a foo a bar a baz", ' '), '+') == "prefix:a+foo+a+bar+a+baz");
+
+    std::vector<std::string> tokens = { "a", "", " ", "b" };
+    result.clear();
+    REQUIRE(StringUtils::Join(result, tokens, ", ") == "a, ,  , b");
+    result.clear();
+    REQUIRE(StringUtils::Join(result, tokens, ", ", true) == "a,  , b");
+    result.clear();
+    REQUIRE(StringUtils::Join(result, tokens, ", ", true, true) == "a, b");
+    result.clear();
+    REQUIRE(StringUtils::Join(result, std::vector<std::string_view>(), ',').empty());
+
+    // Delimiter is placed only between joined tokens
+    result.clear();
+    REQUIRE(StringUtils::Join(result, std::vector<std::string>({ "a", "b", "" }), ',', true) == "a,b");
+}
+
+TEST_CASE("Join into writer", "[CppCommon][String]")
+{
+    TestWriter writer;
+    REQUIRE(StringUtils::Join(writer, StringUtils::Tokenize("a foo a bar a baz", ' '), "+") == 17);
+    REQUIRE(writer.data == "a+foo+a+bar+a+baz");
+    REQUIRE(writer.calls == 1);
+
+    std::vector<std::string> tokens = { "a", "", " ", "b" };
+    writer.data.clear();
+    REQUIRE(StringUtils::Join(writer, tokens, ",", true, true) == 3);
+    REQUIRE(writer.data == "a,b");
+
+    // Many tokens are written in several batches
+    std::string str;
+    for (size_t i = 0; i < 1000; ++i)
+        str += std::to_string(i) + ",";
+    writer.data.clear();
+    writer.calls = 0;
+    REQUIRE(StringUtils::Join(writer, StringUtils::Tokenize(str, ',', true), ";") == (str.size() - 1));
+    REQUIRE(writer.data == StringUtils::Join(StringUtils::Split(str, ',', true), ";"));
+    REQUIRE(writer.calls > 1);
+}
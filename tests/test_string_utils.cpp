@@ -89,6 +89,22 @@ TEST_CASE("String utilities", "[CppCommon][String]")
 
     REQUIRE(CppCommon::StringUtils::Join(CppCommon::StringUtils::Split("a foo a bar a baz", ' '), '+') == "a+foo+a+bar+a+baz");
     REQUIRE(CppCommon::StringUtils::Join(CppCommon::StringUtils::Split("a foo a bar a baz", "a "), "the ") == "the foo the bar the baz");
+    REQUIRE(CppCommon::StringUtils::Join(std::vector<std::string>({ "a", "b", "" }), ',', true) == "a,b");
+    REQUIRE(CppCommon::StringUtils::Join(std::vector<std::string>({ "", "a", " ", "b", " " }), ", ", true, true) == "a, b");
+
+    REQUIRE(StringUtils::CompareNoCase("Content-Type", "content-TYPE"));
+    REQUIRE(!StringUtils::CompareNoCase("Content-Type", "Content-Typo"));
+    REQUIRE(!StringUtils::CompareNoCase("Content-Type", "Content-Type "));
+
+    REQUIRE(CppCommon::StringUtils::CountAll("aaaa", "aa") == 2);
+    REQUIRE(CppCommon::StringUtils::CountAll("aaaa", "") == 0);
+    str = "aaaa";
+    REQUIRE(!CppCommon::StringUtils::ReplaceAll(str, "", "b"));
+    REQUIRE(CppCommon::StringUtils::ReplaceAll(str, "aa", "b"));
+    REQUIRE(str == "bb");
+    REQUIRE(CppCommon::StringUtils::ReplaceAll(str, "b", "c"));
+    REQUIRE(str == "cc");
+    REQUIRE(!CppCommon::StringUtils::ReplaceAll(str, "b", "c"));
 
     REQUIRE(CppCommon::StringUtils::IsPatternMatch("Demo.*;Live.*", "DemoAccount"));
     REQUIRE(CppCommon::StringUtils::IsPatternMatch("Demo.*;Live.*", "LiveAccount"));
@@ -116,3 +132,47 @@ TEST_CASE("String utilities", "[CppCommon][String]")
     REQUIRE(StringUtils::FromString<int>("100") == 100);
     REQUIRE(StringUtils::FromString<double>("123.456") == 123.456);
 }
+
+TEST_CASE("String utilities vectorized search and case conversion", "[CppCommon][String]")
+{
+    // Long strings cover both vectorized and scalar paths
+    std::string text;
+    for (size_t i = 0; i < 300; ++i)
+        text += "Header-" + std::to_string(i * 7919 % 1000) + ": Value\xC0\xFF\r\n";
+
+    for (auto substr : { "H", "He", "Hea", "\r\n", "Value\xC0", "9: V", ": Value\xC0\xFF\r\nHeader-0", "missing", "\n\n" })
+    {
+        for (size_t offset = 0; offset < 64; ++offset)
+        {
+            std::string_view view = std::string_view(text).substr(offset, 100 + offset * 7);
+            for (size_t position = 0; position < 40; position += 3)
+                REQUIRE(StringUtils::Find(view, substr, position) == view.find(substr, position));
+        }
+    }
+    REQUIRE(StringUtils::Find("abc", "", 1) == 1);
+    REQUIRE(StringUtils::Find("abc", "", 4) == std::string::npos);
+    REQUIRE(StringUtils::Find("abc", "abcd") == std::string::npos);
+    REQUIRE(StringUtils::CountAll(text, "\r\n") == 300);
+
+    std::string replaced = text;
+    REQUIRE(StringUtils::ReplaceAll(replaced, "\r\n", "\n"));
+    REQUIRE(replaced.size() == (text.size() - 300));
+    REQUIRE(StringUtils::ReplaceAll(replaced, "\n", "\r\n"));
+    REQUIRE(replaced == text);
+
+    // Only ASCII characters are converted
+    std::string lower = StringUtils::ToLower(text);
+    std::string upper = StringUtils::ToUpper(text);
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        char ch = text[i];
+        REQUIRE(lower[i] == (((ch >= 'A') && (ch <= 'Z')) ? (char)(ch + 32) : ch));
+        REQUIRE(upper[i] == (((ch >= 'a') && (ch <= 'z')) ? (char)(ch - 32) : ch));
+    }
+    REQUIRE(StringUtils::CompareNoCase(lower, upper));
+    REQUIRE(StringUtils::CompareNoCase(text, upper));
+    upper[upper.size() - 3] = '@';
+    REQUIRE(!StringUtils::CompareNoCase(lower, upper));
+    REQUIRE(!StringUtils::CompareNoCase("@", "`"));
+    REQUIRE(!StringUtils::CompareNoCase("[", "{"));
+}
@@ -18,4 +18,5 @@ TEST_CASE("CPU management", "[CppCommon][System]")
     REQUIRE(CPU::TotalCores().second == CPU::PhysicalCores());
     REQUIRE(CPU::ClockSpeed() > 0);
     REQUIRE((CPU::HyperThreading() || !CPU::HyperThreading()));
+    REQUIRE((!CPU::HasAVX2() || CPU::HasSSSE3()));
 }
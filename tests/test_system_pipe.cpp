@@ -4,9 +4,12 @@
 
 #include "test.h"
 
+#include "filesystem/file.h"
 #include "system/pipe.h"
+#include "system/pipe_multiplexer.h"
 
 #include <thread>
+#include <vector>
 
 using namespace CppCommon;
 
@@ -61,3 +64,231 @@ TEST_CASE("Pipe threads", "[CppCommon][System]")
     // Check result
     REQUIRE(crc == result);
 }
+
+TEST_CASE("Pipe scatter/gather", "[CppCommon][System]")
+{
+    Pipe pipe;
+
+    std::string header = "header";
+    std::string payload = "payload";
+    std::string trailer = "trailer";
+    ConstIOBuffer output[] = { { header.data(), header.size() }, { payload.data(), payload.size() }, { trailer.data(), trailer.size() } };
+    REQUIRE(pipe.WriteV(output) == 20);
+
+    char buffer1[6];
+    char buffer2[14];
+    IOBuffer input[] = { { buffer1, sizeof(buffer1) }, { buffer2, sizeof(buffer2) } };
+    REQUIRE(pipe.ReadV(input) == 20);
+    REQUIRE(std::string(buffer1, sizeof(buffer1)) == "header");
+    REQUIRE(std::string(buffer2, sizeof(buffer2)) == "payloadtrailer");
+}
+
+TEST_CASE("Pipe splice", "[CppCommon][System]")
+{
+    std::string text = "splice text data";
+    File::WriteAllText("test.tmp", text);
+
+    // Move the file content into the pipe and back into another file
+    Pipe pipe;
+    File source("test.tmp");
+    source.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    REQUIRE(pipe.SpliceFrom(source.native(), 1024) == text.size());
+    REQUIRE(pipe.SpliceFrom(source.native(), 1024) == 0);
+    source.Close();
+
+    File destination("test2.tmp");
+    destination.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    REQUIRE(pipe.SpliceTo(destination.native(), 4) == 4);
+    REQUIRE(pipe.SpliceTo(destination.native(), 1024) == text.size() - 4);
+    destination.Close();
+    REQUIRE(File::ReadAllText(destination) == text);
+
+    File::Remove(source);
+    File::Remove(destination);
+}
+
+TEST_CASE("Pipe non-blocking splice", "[CppCommon][System]")
+{
+    std::string text = "splice text data";
+    File::WriteAllText("test.tmp", text);
+
+    Pipe pipe;
+    pipe.SetBlocking(false);
+
+    // Empty pipe does not block
+    File destination("test2.tmp");
+    destination.Create(false, true, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    REQUIRE(pipe.SpliceTo(destination.native(), 1024) == 0);
+    REQUIRE(pipe.IsWouldBlock());
+
+    // Full pipe does not block
+    std::vector<uint8_t> buffer(4096);
+    while (pipe.Write(buffer.data(), buffer.size()) > 0);
+    File source("test.tmp");
+    source.Open(true, false, false, File::DEFAULT_ATTRIBUTES, File::DEFAULT_PERMISSIONS, 0);
+    REQUIRE(pipe.SpliceFrom(source.native(), 1024) == 0);
+    REQUIRE(pipe.IsWouldBlock());
+    source.Close();
+    ConstIOBuffer output[] = { { text.data(), text.size() } };
+    REQUIRE(pipe.SpliceV(output) == 0);
+    REQUIRE(pipe.IsWouldBlock());
+
+    // End of the pipe is not a would-block condition
+    pipe.CloseWrite();
+    while (pipe.SpliceTo(destination.native(), 65536) > 0);
+    REQUIRE(!pipe.IsWouldBlock());
+    destination.Close();
+
+    File::Remove(source);
+    File::Remove(destination);
+}
+
+TEST_CASE("Pipe capacity", "[CppCommon][System]")
+{
+    Pipe pipe(256 * 1024);
+    REQUIRE(pipe.capacity() > 0);
+#if defined(__linux__)
+    REQUIRE(pipe.capacity() >= 256 * 1024);
+    REQUIRE(pipe.SetCapacity(4096) == 4096);
+    REQUIRE(pipe.capacity() == 4096);
+#endif
+}
+
+TEST_CASE("Pipe non-blocking mode", "[CppCommon][System]")
+{
+    Pipe pipe;
+    REQUIRE(pipe.IsBlocking());
+    pipe.SetBlocking(false);
+    REQUIRE(!pipe.IsBlocking());
+
+    // Empty pipe does not block
+    int item = 0;
+    REQUIRE(pipe.Read(&item, sizeof(item)) == 0);
+    REQUIRE(pipe.IsWouldBlock());
+    REQUIRE(!pipe.WaitRead(Timespan::milliseconds(10)));
+    REQUIRE(pipe.WaitWrite(Timespan::milliseconds(10)));
+
+    item = 123;
+    REQUIRE(pipe.Write(&item, sizeof(item)) == sizeof(item));
+    REQUIRE(pipe.WaitRead(Timespan::milliseconds(10)));
+    item = 0;
+    REQUIRE(pipe.Read(&item, sizeof(item)) == sizeof(item));
+    REQUIRE(item == 123);
+    REQUIRE(!pipe.IsWouldBlock());
+
+    // Full pipe does not block
+    std::vector<uint8_t> buffer(4096);
+    while (pipe.Write(buffer.data(), buffer.size()) > 0);
+    REQUIRE(pipe.IsWouldBlock());
+    REQUIRE(!pipe.WaitWrite(Timespan::milliseconds(10)));
+    REQUIRE(pipe.Read(buffer.data(), buffer.size()) == buffer.size());
+
+    // End of the pipe is not a would-block condition
+    pipe.CloseWrite();
+    while (pipe.Read(buffer.data(), buffer.size()) > 0);
+    REQUIRE(!pipe.IsWouldBlock());
+}
+
+TEST_CASE("Pipe vmsplice", "[CppCommon][System]")
+{
+    Pipe pipe;
+
+    std::string header = "header";
+    std::string payload = "payload";
+    ConstIOBuffer output[] = { { header.data(), header.size() }, { payload.data(), payload.size() } };
+    REQUIRE(pipe.SpliceV(output) == 13);
+
+    char buffer[13];
+    REQUIRE(pipe.Read(buffer, sizeof(buffer)) == 13);
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "headerpayload");
+}
+
+TEST_CASE("Pipe multiplexer", "[CppCommon][System]")
+{
+    const int pipes_count = 4;
+    const int items_to_produce = 10000;
+
+    std::vector<std::unique_ptr<Pipe>> pipes;
+    std::vector<size_t> received(pipes_count, 0);
+    std::vector<bool> closed(pipes_count, false);
+
+    PipeMultiplexer multiplexer(1024);
+    for (int i = 0; i < pipes_count; ++i)
+    {
+        pipes.emplace_back(std::make_unique<Pipe>());
+        multiplexer.Add(*pipes.back(), [&received, &closed, i](Pipe&, const void*, size_t size)
+        {
+            if (size == 0)
+                closed[i] = true;
+            received[i] += size;
+        });
+    }
+    REQUIRE(multiplexer.size() == pipes_count);
+
+    // Start producers threads
+    std::vector<std::thread> producers;
+    for (int i = 0; i < pipes_count; ++i)
+    {
+        producers.emplace_back([&pipes, i, items_to_produce]()
+        {
+            for (int j = 0; j < items_to_produce; ++j)
+                pipes[i]->Write(&j, sizeof(j));
+            pipes[i]->CloseWrite();
+        });
+    }
+
+    // Drain all pipes from the current thread
+    size_t total = multiplexer.Drain();
+
+    // Wait for producers threads
+    for (auto& producer : producers)
+        producer.join();
+
+    // Check result
+    REQUIRE(multiplexer.empty());
+    REQUIRE(total == pipes_count * items_to_produce * sizeof(int));
+    for (int i = 0; i < pipes_count; ++i)
+    {
+        REQUIRE(received[i] == items_to_produce * sizeof(int));
+        REQUIRE(closed[i]);
+    }
+}
+
+TEST_CASE("Pipe multiplexer handlers modify pipes", "[CppCommon][System]")
+{
+    Pipe pipe1;
+    Pipe pipe2;
+    Pipe pipe3;
+    pipe3.SetBlocking(false);
+
+    PipeMultiplexer multiplexer;
+    size_t received3 = 0;
+    auto handler3 = [&received3](Pipe&, const void*, size_t size) { received3 += size; };
+    size_t calls2 = 0;
+    auto handler2 = [&calls2](Pipe&, const void*, size_t) { ++calls2; };
+
+    // The first handler removes itself and the second pipe, then adds the third pipe
+    multiplexer.Add(pipe1, [&](Pipe& pipe, const void*, size_t)
+    {
+        multiplexer.Remove(pipe);
+        multiplexer.Remove(pipe2);
+        for (int i = 0; i < 100; ++i)
+            multiplexer.Add(pipe3, handler3);
+    });
+    multiplexer.Add(pipe2, handler2);
+    REQUIRE(multiplexer.size() == 2);
+
+    int item = 123;
+    REQUIRE(pipe1.Write(&item, sizeof(item)) == sizeof(item));
+    REQUIRE(pipe2.Write(&item, sizeof(item)) == sizeof(item));
+    REQUIRE(pipe3.Write(&item, sizeof(item)) == sizeof(item));
+
+    REQUIRE(multiplexer.Poll(Timespan::seconds(1)) == sizeof(item));
+    REQUIRE(calls2 == 0);
+    REQUIRE(received3 == 0);
+    REQUIRE(multiplexer.size() == 100);
+
+    // Added pipes are polled from the next call, duplicates of the non-blocking pipe find no data
+    REQUIRE(multiplexer.Poll(Timespan::seconds(1)) == sizeof(item));
+    REQUIRE(received3 == sizeof(item));
+}
@@ -17,3 +17,61 @@ TEST_CASE("Process", "[CppCommon][System]")
     REQUIRE(Process::CurrentProcess().IsRunning());
     REQUIRE(Process::ParentProcess().IsRunning());
 }
+
+#if defined(unix) || defined(__unix) || defined(__unix__)
+TEST_CASE("Process capture output", "[CppCommon][System]")
+{
+    std::vector<std::string> arguments = { "hello", "world" };
+    std::string output;
+    std::string error;
+    REQUIRE(Process::Capture("echo", &arguments, nullptr, nullptr, &output, &error) == 0);
+    REQUIRE(output == "hello world\n");
+    REQUIRE(error.empty());
+
+    // Overridden environment variables must be merged with the current environment
+    std::map<std::string, std::string> envars = { { "CPPCOMMON_TEST", "test" } };
+    arguments = { "-c", "echo $CPPCOMMON_TEST; test -n \"$PATH\"" };
+    output.clear();
+    REQUIRE(Process::Capture("/bin/sh", &arguments, &envars, nullptr, &output) == 0);
+    REQUIRE(output == "test\n");
+
+    std::string directory = "/";
+    output.clear();
+    REQUIRE(Process::Capture("pwd", nullptr, nullptr, &directory, &output) == 0);
+    REQUIRE(output == "/\n");
+
+    arguments = { "-c", "echo failure >&2; exit 3" };
+    output.clear();
+    REQUIRE(Process::Capture("/bin/sh", &arguments, nullptr, nullptr, &output, &error) == 3);
+    REQUIRE(output.empty());
+    REQUIRE(error == "failure\n");
+}
+
+TEST_CASE("Process execute many", "[CppCommon][System]")
+{
+    const int count = 64;
+
+    std::vector<std::vector<std::string>> arguments;
+    std::vector<Pipe> pipes(count);
+    std::vector<Pipe*> outputs;
+    for (int i = 0; i < count; ++i)
+    {
+        arguments.push_back({ "-c", "echo " + std::to_string(i) + "; exit " + std::to_string(i % 4) });
+        outputs.push_back(&pipes[i]);
+    }
+
+    std::vector<Process> processes = Process::ExecuteMany("/bin/sh", arguments, nullptr, nullptr, &outputs);
+    REQUIRE(processes.size() == count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        char buffer[16];
+        size_t size = 0;
+        size_t read;
+        while ((read = pipes[i].Read(buffer + size, sizeof(buffer) - size)) > 0)
+            size += read;
+        REQUIRE(std::string(buffer, size) == std::to_string(i) + "\n");
+        REQUIRE(processes[i].Wait() == (i % 4));
+    }
+}
+#endif
@@ -0,0 +1,121 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "system/reactor.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+#if defined(__linux__)
+
+TEST_CASE("Reactor timers", "[CppCommon][System]")
+{
+    Reactor reactor;
+    REQUIRE(reactor.empty());
+
+    int once = 0;
+    int periodic = 0;
+    reactor.AddTimer(Timespan::milliseconds(10), [&once]() { ++once; });
+    Reactor::Token token = reactor.AddTimer(Timespan::milliseconds(1), [&periodic]() { ++periodic; }, true);
+    REQUIRE(reactor.size() == 2);
+
+    // One-shot timer is removed after the first call
+    while (once == 0)
+        reactor.Poll(Timespan::seconds(1));
+    REQUIRE(once == 1);
+    REQUIRE(periodic > 0);
+    REQUIRE(reactor.size() == 1);
+
+    REQUIRE(reactor.Remove(token));
+    REQUIRE(!reactor.Remove(token));
+    REQUIRE(reactor.empty());
+    REQUIRE(reactor.Poll(Timespan::milliseconds(5)) == 0);
+}
+
+TEST_CASE("Reactor pipes", "[CppCommon][System]")
+{
+    Reactor reactor(16);
+
+    Pipe pipe;
+    std::string data;
+    bool closed = false;
+    reactor.AddPipe(pipe, [&](Pipe&, const void* buffer, size_t size)
+    {
+        if (size == 0)
+            closed = true;
+        else
+            data.append((const char*)buffer, size);
+    });
+
+    // Edge-triggered readiness must drain the whole pipe with the small buffer
+    std::string message = "Edge-triggered reactor drains the whole pipe!";
+    REQUIRE(pipe.Write(message.data(), message.size()) == message.size());
+    REQUIRE(reactor.Poll(Timespan::seconds(1)) > 0);
+    REQUIRE(data == message);
+    REQUIRE(!closed);
+
+    pipe.CloseWrite();
+    while (!closed)
+        reactor.Poll(Timespan::seconds(1));
+    REQUIRE(reactor.empty());
+}
+
+TEST_CASE("Reactor events", "[CppCommon][System]")
+{
+    Reactor reactor;
+
+    std::atomic<int> fired(0);
+    Reactor::Token event = reactor.AddEvent([&fired]() { ++fired; });
+
+    // Many signals are coalesced into a single handler call
+    REQUIRE(reactor.Signal(event));
+    REQUIRE(reactor.Signal(event));
+    REQUIRE(reactor.Poll(Timespan::seconds(1)) == 1);
+    REQUIRE(fired == 1);
+    REQUIRE(reactor.Poll(Timespan::zero()) == 0);
+
+    // Signal the event and stop the reactor from another thread
+    std::thread thread([&reactor, event]()
+    {
+        reactor.Signal(event);
+        Thread::Sleep(10);
+        reactor.Stop();
+    });
+    reactor.Run();
+    thread.join();
+    REQUIRE(fired == 2);
+
+    // Timer and event sources are not confused
+    Reactor::Token timer = reactor.AddTimer(Timespan::seconds(10), []() {});
+    REQUIRE(!reactor.Signal(timer));
+    REQUIRE(reactor.Remove(event));
+    REQUIRE(!reactor.Signal(event));
+}
+
+TEST_CASE("Reactor processes", "[CppCommon][System]")
+{
+    Reactor reactor;
+
+    std::vector<std::string> arguments = { "-c", "echo reactor; exit 7" };
+    Pipe output;
+    Process process = Process::Execute("/bin/sh", &arguments, nullptr, nullptr, nullptr, &output);
+
+    std::string data;
+    int result = -1;
+    reactor.AddPipe(output, [&data](Pipe&, const void* buffer, size_t size) { data.append((const char*)buffer, size); });
+    reactor.AddProcess(process, [&result](Process&, int code) { result = code; });
+
+    while (!reactor.empty())
+        reactor.Poll(Timespan::seconds(1));
+    REQUIRE(data == "reactor\n");
+    REQUIRE(result == 7);
+}
+
+#endif
@@ -6,6 +6,7 @@
 
 #include "system/shared_memory.h"
 
+#include <cerrno>
 #include <cstring>
 
 using namespace CppCommon;
@@ -31,3 +32,48 @@ TEST_CASE("Shared memory manager", "[CppCommon][System]")
     // Read from the shared memory buffer
     REQUIRE(std::memcmp(shared1.ptr(), shared2.ptr(), size) == 0);
 }
+
+TEST_CASE("Shared memory manager flags", "[CppCommon][System]")
+{
+    const char* name = "shared_memory_flags_test";
+    size_t size = 4 * 1048576;
+
+    // Huge pages fall back to transparent huge pages if hugetlbfs is not available
+    SharedMemory shared1(name, size, SharedMemoryFlags::HUGE_PAGES | SharedMemoryFlags::POPULATE);
+    REQUIRE(shared1.owner());
+    REQUIRE(shared1.size() == size);
+    REQUIRE((shared1.flags() & SharedMemoryFlags::HUGE_PAGES));
+    REQUIRE(shared1.node() == -1);
+
+    std::memset(shared1.ptr(), 0x5A, size);
+
+    SharedMemory shared2(name, size, SharedMemoryFlags::HUGE_PAGES);
+    REQUIRE(!shared2.owner());
+    REQUIRE(shared2.huge() == shared1.huge());
+    REQUIRE(std::memcmp(shared1.ptr(), shared2.ptr(), size) == 0);
+
+    // Constant pointer must point to the same shared memory buffer
+    const SharedMemory& shared3 = shared2;
+    REQUIRE(shared3.ptr() == shared2.ptr());
+}
+
+#if defined(__linux__)
+TEST_CASE("Shared memory manager NUMA node", "[CppCommon][System]")
+{
+    size_t size = 4 * 1048576;
+
+    // Bind to the first NUMA node
+    try
+    {
+        SharedMemory shared("shared_memory_numa_test", size, SharedMemoryFlags::POPULATE, 0);
+        REQUIRE(shared.node() == 0);
+        REQUIRE(((const uint8_t*)shared.ptr())[size - 1] == 0);
+    }
+    catch (const SystemException& ex)
+    {
+        // Skip kernels and containers without NUMA support
+        if ((ex.system_error() != ENOSYS) && (ex.system_error() != EINVAL))
+            throw;
+    }
+}
+#endif
@@ -0,0 +1,153 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "errors/exceptions.h"
+#include "threads/async_writer.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+using namespace CppCommon;
+
+namespace {
+
+// Memory writer which can be paused to emulate a slow device
+class MemoryWriter : public Writer
+{
+public:
+    std::string data;
+    std::atomic<bool> paused{false};
+    std::atomic<bool> failed{false};
+    std::atomic<size_t> flushes{0};
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        while (paused)
+            std::this_thread::yield();
+        if (failed)
+            return 0;
+        data.append((const char*)buffer, size);
+        return size;
+    }
+
+    void Flush() override { ++flushes; }
+};
+
+} // namespace
+
+TEST_CASE("Asynchronous writer", "[CppCommon][Threads]")
+{
+    const size_t threads = 4;
+    const size_t records = 1000;
+
+    MemoryWriter target;
+    AsyncWriter writer(target, 100, AsyncWriterPolicy::BLOCK);
+    REQUIRE(writer.capacity() == 128);
+    REQUIRE(writer.policy() == AsyncWriterPolicy::BLOCK);
+
+    // Write fixed size records from concurrent threads
+    std::atomic<size_t> accepted(0);
+    std::vector<std::thread> producers;
+    for (size_t i = 0; i < threads; ++i)
+    {
+        producers.emplace_back([&writer, &accepted, i]()
+        {
+            std::string record = std::to_string(i) + "0123456789abcdef\n";
+            for (size_t j = 0; j < records; ++j)
+                accepted += writer.Write(record.data(), record.size());
+        });
+    }
+    for (auto& producer : producers)
+        producer.join();
+
+    // Write a buffer larger than the ring buffer capacity
+    std::string large(1000, 'x');
+    large.back() = '\n';
+    REQUIRE(writer.Write(large) == large.size());
+
+    // Flush barrier waits for all written buffers
+    writer.Flush();
+    REQUIRE(target.flushes > 0);
+    REQUIRE(writer.written() == (accepted + large.size()));
+    REQUIRE(writer.dropped() == 0);
+    REQUIRE(writer.writes() <= (threads * records + 1));
+    REQUIRE(target.data.size() == writer.written());
+
+    // Records must not be interleaved
+    size_t lines = 0;
+    size_t invalid = 0;
+    for (size_t start = 0; start < target.data.size(); ++lines)
+    {
+        size_t end = target.data.find('\n', start);
+        std::string line = target.data.substr(start, end - start);
+        if ((line != std::string(999, 'x')) && ((line.size() != 17) || (line.substr(1) != "0123456789abcdef")))
+            ++invalid;
+        start = end + 1;
+    }
+    REQUIRE(lines == (threads * records + 1));
+    REQUIRE(invalid == 0);
+
+    writer.Close();
+    REQUIRE(writer.Write(large) == 0);
+}
+
+TEST_CASE("Asynchronous writer backpressure policies", "[CppCommon][Threads]")
+{
+    const std::string record = "0123456789abcdef";
+
+    // Drop policy
+    {
+        MemoryWriter target;
+        target.paused = true;
+        AsyncWriter writer(target, 64, AsyncWriterPolicy::DROP);
+
+        size_t accepted = 0;
+        for (size_t i = 0; i < 100; ++i)
+            accepted += writer.Write(record);
+        REQUIRE(accepted < (100 * record.size()));
+        REQUIRE(writer.dropped() > 0);
+
+        target.paused = false;
+        writer.Flush();
+        REQUIRE(writer.written() == accepted);
+        REQUIRE((writer.written() + writer.dropped()) == (100 * record.size()));
+        REQUIRE(target.data.size() == accepted);
+    }
+
+    // Expand policy
+    {
+        MemoryWriter target;
+        target.paused = true;
+        AsyncWriter writer(target, 64, AsyncWriterPolicy::EXPAND);
+
+        std::string expected;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            std::string data = record + std::to_string(i);
+            REQUIRE(writer.Write(data) == data.size());
+            expected += data;
+        }
+
+        target.paused = false;
+        writer.Flush();
+        REQUIRE(writer.dropped() == 0);
+        REQUIRE(target.data == expected);
+    }
+}
+
+TEST_CASE("Asynchronous writer failure", "[CppCommon][Threads]")
+{
+    MemoryWriter target;
+    target.failed = true;
+    AsyncWriter writer(target, 64);
+
+    REQUIRE(writer.Write(std::string("0123456789abcdef")) == 16);
+    REQUIRE_THROWS_AS(writer.Flush(), RuntimeException);
+    REQUIRE(writer.Write(std::string("0123456789abcdef")) == 0);
+    REQUIRE(writer.dropped() == 32);
+    REQUIRE_THROWS_AS(writer.Close(), RuntimeException);
+}
@@ -8,6 +8,11 @@
 
 #include <thread>
 
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace CppCommon;
 
 #if !defined(__APPLE__)
@@ -53,3 +58,44 @@ TEST_CASE("Named mutex locker", "[CppCommon][Threads]")
 }
 
 #endif
+
+#if (defined(unix) || defined(__unix) || defined(__unix__)) && !defined(__APPLE__)
+TEST_CASE("Named mutex owner death recovery", "[CppCommon][Threads]")
+{
+    NamedMutex mutex("named_mutex_recovery_test");
+
+    // Child process locks the mutex and exits without unlocking it
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        NamedMutex* child = new NamedMutex("named_mutex_recovery_test");
+        child->Lock();
+        _exit(0);
+    }
+    REQUIRE(pid > 0);
+    int status;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+
+    // Mutex of the dead process is taken over and reported
+    REQUIRE(mutex.TryLockFor(Timespan::seconds(5)));
+    REQUIRE(mutex.IsOwnerDead());
+    mutex.Unlock();
+    REQUIRE(mutex.TryLock());
+    REQUIRE(!mutex.IsOwnerDead());
+    mutex.Unlock();
+
+    // Blocking lock takes over the mutex as well
+    pid = fork();
+    if (pid == 0)
+    {
+        NamedMutex* child = new NamedMutex("named_mutex_recovery_test");
+        child->Lock();
+        _exit(0);
+    }
+    REQUIRE(pid > 0);
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    mutex.Lock();
+    REQUIRE(mutex.IsOwnerDead());
+    mutex.Unlock();
+}
+#endif
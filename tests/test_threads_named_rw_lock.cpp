@@ -10,6 +10,11 @@
 #include <thread>
 #include <vector>
 
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace CppCommon;
 
 TEST_CASE("Named read/write lock", "[CppCommon][Threads]")
@@ -139,3 +144,29 @@ TEST_CASE("Named read/write locker", "[CppCommon][Threads]")
     for (int i = 0; i < consumers_count; ++i)
         REQUIRE(crcs[i] > 0);
 }
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Named read/write lock owner death recovery", "[CppCommon][Threads]")
+{
+    NamedRWLock lock("named_rw_lock_recovery_test");
+
+    // Child process locks the exclusive lock and exits without unlocking it
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        NamedRWLock* child = new NamedRWLock("named_rw_lock_recovery_test");
+        child->LockWrite();
+        _exit(0);
+    }
+    REQUIRE(pid > 0);
+    int status;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+    REQUIRE(!lock.TryLockRead());
+
+    // Exclusive lock of the dead process is released by the waiter
+    lock.LockRead();
+    lock.UnlockRead();
+    lock.LockWrite();
+    lock.UnlockWrite();
+}
+#endif
@@ -0,0 +1,92 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_mpsc_ring_queue.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Process-shared multiple producers / single consumer wait-free ring queue", "[CppCommon][Threads]")
+{
+    const char* name = "shared_mpsc_ring_queue_test";
+
+    SharedMPSCRingQueue<int> consumer(name, 4, 2, SharedRingRole::CONSUMER);
+    SharedMPSCRingQueue<int> producer1(name, 4, 2, SharedRingRole::PRODUCER);
+    SharedMPSCRingQueue<int> producer2(name, 4, 2, SharedRingRole::PRODUCER);
+    REQUIRE(consumer.capacity() == 4);
+    REQUIRE(consumer.producers() == 2);
+    REQUIRE(consumer.empty());
+
+    // All producer lanes are attached
+    REQUIRE_THROWS_AS(SharedMPSCRingQueue<int>(name, 4, 2, SharedRingRole::PRODUCER), SystemException);
+    // Layout must match
+    REQUIRE_THROWS_AS(SharedMPSCRingQueue<int>(name, 8, 2, SharedRingRole::PRODUCER), SystemException);
+
+    // Each producer lane is bounded by the capacity
+    for (int i = 0; i < 4; ++i)
+        REQUIRE(producer1.Enqueue(i));
+    REQUIRE(!producer1.Enqueue(4));
+    REQUIRE(producer2.Enqueue(100));
+    REQUIRE(consumer.size() == 5);
+
+    int item = -1;
+    REQUIRE((consumer.Dequeue(item) && (item == 0)));
+    std::vector<int> items;
+    REQUIRE(consumer.Dequeue([&items](const int& value) { items.push_back(value); }));
+    REQUIRE(items == std::vector<int>({ 1, 2, 3, 100 }));
+    REQUIRE(!consumer.Dequeue(item));
+    REQUIRE(!consumer.TryWaitFor(Timespan::milliseconds(10)));
+}
+
+TEST_CASE("Process-shared ring queue producers", "[CppCommon][Threads]")
+{
+    const char* name = "shared_mpsc_ring_queue_producers_test";
+    const size_t producers = 4;
+    const uint64_t count = 100000;
+
+    struct Item
+    {
+        uint64_t producer;
+        uint64_t sequence;
+    };
+
+    SharedMPSCRingQueue<Item> consumer(name, 256, producers, SharedRingRole::CONSUMER);
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < producers; ++i)
+    {
+        threads.emplace_back([name, i, count]()
+        {
+            SharedMPSCRingQueue<Item> producer(name, 256, producers, SharedRingRole::PRODUCER);
+            for (uint64_t j = 0; j < count; ++j)
+                while (!producer.Enqueue(Item{ i, j }))
+                    std::this_thread::yield();
+        });
+    }
+
+    // Items of the same producer must be in FIFO order
+    std::vector<uint64_t> expected(producers, 0);
+    uint64_t received = 0;
+    uint64_t invalid = 0;
+    while (received < (producers * count))
+    {
+        consumer.Wait();
+        Item item;
+        while (consumer.Dequeue(item))
+        {
+            if (item.sequence != expected[item.producer]++)
+                ++invalid;
+            ++received;
+        }
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    REQUIRE(invalid == 0);
+    REQUIRE(consumer.empty());
+}
@@ -0,0 +1,114 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "threads/shared_spsc_ring_buffer.h"
+
+#include <thread>
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace CppCommon;
+
+TEST_CASE("Process-shared single producer / single consumer wait-free ring buffer", "[CppCommon][Threads]")
+{
+    const char* name = "shared_spsc_ring_buffer_test";
+
+    SharedSPSCRingBuffer consumer(name, 16, SharedRingRole::CONSUMER);
+    SharedSPSCRingBuffer producer(name, 16, SharedRingRole::PRODUCER);
+    REQUIRE(consumer.capacity() == 16);
+    REQUIRE(consumer.empty());
+
+    // Only one live producer and consumer are allowed
+    REQUIRE_THROWS_AS(SharedSPSCRingBuffer(name, 16, SharedRingRole::PRODUCER), SystemException);
+    REQUIRE_THROWS_AS(SharedSPSCRingBuffer(name, 16, SharedRingRole::CONSUMER), SystemException);
+
+    char data[16] = "0123456789abcde";
+    REQUIRE(producer.Enqueue(data, 10));
+    REQUIRE(consumer.size() == 10);
+    REQUIRE(!producer.Enqueue(data, 10));
+    REQUIRE(consumer.TryWaitFor(Timespan::milliseconds(10)));
+
+    char buffer[16];
+    size_t size = 4;
+    REQUIRE((consumer.Dequeue(buffer, size) && (size == 4) && (std::memcmp(buffer, "0123", 4) == 0)));
+    size = sizeof(buffer);
+    REQUIRE((consumer.Dequeue(buffer, size) && (size == 6) && (std::memcmp(buffer, "456789", 6) == 0)));
+    REQUIRE(!consumer.Dequeue(buffer, size = sizeof(buffer)));
+    REQUIRE(!consumer.TryWaitFor(Timespan::milliseconds(10)));
+
+    // Wrap around the ring buffer end
+    REQUIRE(producer.Enqueue(data, 12));
+    size = sizeof(buffer);
+    REQUIRE((consumer.Dequeue(buffer, size) && (size == 12) && (std::memcmp(buffer, data, 12) == 0)));
+}
+
+TEST_CASE("Process-shared ring buffer wake up", "[CppCommon][Threads]")
+{
+    const char* name = "shared_spsc_ring_buffer_wake_test";
+    const uint64_t count = 100000;
+
+    SharedSPSCRingBuffer consumer(name, 1024, SharedRingRole::CONSUMER);
+
+    std::thread thread([name, count]()
+    {
+        SharedSPSCRingBuffer producer(name, 1024, SharedRingRole::PRODUCER);
+        for (uint64_t i = 0; i < count; ++i)
+            while (!producer.Enqueue(&i, sizeof(i)))
+                std::this_thread::yield();
+    });
+
+    // Consumer sleeps on the futex while the ring buffer is empty
+    uint64_t expected = 0;
+    uint64_t invalid = 0;
+    while (expected < count)
+    {
+        consumer.Wait();
+        uint64_t value;
+        size_t size = sizeof(value);
+        while (consumer.Dequeue(&value, size))
+        {
+            if (value != expected++)
+                ++invalid;
+            size = sizeof(value);
+        }
+    }
+    thread.join();
+
+    REQUIRE(invalid == 0);
+    REQUIRE(consumer.empty());
+}
+
+#if defined(unix) || defined(__unix) || defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Process-shared ring buffer producer crash", "[CppCommon][Threads]")
+{
+    const char* name = "shared_spsc_ring_buffer_crash_test";
+
+    SharedSPSCRingBuffer consumer(name, 64, SharedRingRole::CONSUMER);
+
+    // Child process attaches as a producer and exits without detaching
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        SharedSPSCRingBuffer* producer = new SharedSPSCRingBuffer(name, 64, SharedRingRole::PRODUCER);
+        producer->Enqueue("child", 5);
+        _exit(0);
+    }
+    REQUIRE(pid > 0);
+    int status;
+    REQUIRE(waitpid(pid, &status, 0) == pid);
+
+    // Producer role of the dead process is taken over
+    SharedSPSCRingBuffer producer(name, 64, SharedRingRole::PRODUCER);
+    REQUIRE(producer.Enqueue("parent", 6));
+
+    char buffer[64];
+    size_t size = sizeof(buffer);
+    REQUIRE((consumer.Dequeue(buffer, size) && (size == 11) && (std::memcmp(buffer, "childparent", 11) == 0)));
+}
+#endif
@@ -0,0 +1,87 @@
+//
+// Created by Ivan Shynkarenka on 17.10.2026
+//
+
+#include "test.h"
+
+#include "time/clock.h"
+
+#include <thread>
+#include <vector>
+
+using namespace CppCommon;
+
+TEST_CASE("Coarse clock", "[CppCommon][Time]")
+{
+    REQUIRE(CoarseClock::resolution().total() > 0);
+
+    uint64_t prev_utc = 0;
+    uint64_t prev_nano = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        uint64_t next_utc = CoarseClock::utc();
+        uint64_t next_nano = CoarseClock::nano();
+        REQUIRE(prev_utc <= next_utc);
+        REQUIRE(prev_nano <= next_nano);
+        prev_utc = next_utc;
+        prev_nano = next_nano;
+    }
+
+    // Coarse clock lags behind the precise clock for less than its resolution
+    uint64_t tolerance = CoarseClock::resolution().total() + Timespan::milliseconds(10).total();
+    uint64_t utc = CoarseClock::utc();
+    REQUIRE(utc <= Timestamp::utc());
+    REQUIRE((Timestamp::utc() - utc) < tolerance);
+    uint64_t nano = CoarseClock::nano();
+    REQUIRE(nano <= Timestamp::nano());
+    REQUIRE((Timestamp::nano() - nano) < tolerance);
+}
+
+TEST_CASE("Cached clock", "[CppCommon][Time]")
+{
+    REQUIRE(!CachedClock::IsRunning());
+    REQUIRE(CachedClock::utc() > 0);
+
+    CachedClock::Start(Timespan::milliseconds(1));
+    REQUIRE(CachedClock::IsRunning());
+
+    // Cached clock is updated by the background thread
+    uint64_t first = CachedClock::utc();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint64_t second = CachedClock::utc();
+    REQUIRE(first < second);
+    REQUIRE(second <= Timestamp::utc());
+    REQUIRE((Timestamp::utc() - second) < (uint64_t)Timespan::milliseconds(100).total());
+
+    // Change the update interval of the running background thread
+    CachedClock::Start(Timespan::milliseconds(2));
+    REQUIRE(CachedClock::IsRunning());
+
+    CachedClock::Stop();
+    REQUIRE(!CachedClock::IsRunning());
+    REQUIRE(CachedClock::now() > 0);
+}
+
+TEST_CASE("Cached clock concurrent start and stop", "[CppCommon][Time]")
+{
+    // Concurrent start and stop must not leave the background thread running forever
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([i]()
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                if (((i + j) % 2) == 0)
+                    CachedClock::Start(Timespan::milliseconds(1));
+                else
+                    CachedClock::Stop();
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CachedClock::Stop();
+    REQUIRE(!CachedClock::IsRunning());
+}
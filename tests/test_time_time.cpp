@@ -45,3 +45,50 @@ TEST_CASE("Time", "[CppCommon][Time]")
     UtcTime time9(std::chrono::system_clock::now() + std::chrono::milliseconds(10));
     std::this_thread::sleep_until(time9.chrono());
 }
+
+TEST_CASE("Time formatting", "[CppCommon][Time]")
+{
+    UtcTime time1(Timestamp(1468408953123456789ll));
+    REQUIRE(time1.weekday() == Weekday::Wednesday);
+    REQUIRE(time1.string() == "2016-07-13T11:22:33.123456789Z");
+    REQUIRE(Time(time1).string() == "2016-07-13T11:22:33.123456789");
+
+    char buffer[Time::ISO8601_SIZE + 1];
+    REQUIRE(time1.string(buffer) == Time::ISO8601_SIZE + 1);
+    REQUIRE(std::string(buffer, sizeof(buffer)) == "2016-07-13T11:22:33.123456789Z");
+
+    REQUIRE(UtcTime(Timestamp(0)).string() == "1970-01-01T00:00:00.000000000Z");
+    REQUIRE(UtcTime(Time(2000, 2, 29, 23, 59, 59)).string() == "2000-02-29T23:59:59.000000000Z");
+
+    // Calendar conversion matches the system one
+    UtcTime time2;
+    LocalTime time3(time2);
+    REQUIRE(UtcTime(time3) == time2);
+    REQUIRE(UtcTime(time2.utcstamp()) == time2);
+}
+
+TEST_CASE("Time parsing", "[CppCommon][Time]")
+{
+    REQUIRE(UtcTime::Parse("2016-07-13T11:22:33.123456789Z").utcstamp().total() == 1468408953123456789ll);
+    REQUIRE(UtcTime::Parse("2016-07-13t11:22:33.123456789z").utcstamp().total() == 1468408953123456789ll);
+    REQUIRE(UtcTime::Parse("2016-07-13 11:22:33.123456789").utcstamp().total() == 1468408953123456789ll);
+    REQUIRE(UtcTime::Parse("2016-07-13T14:22:33.123456789999+03:00").utcstamp().total() == 1468408953123456789ll);
+    REQUIRE(UtcTime::Parse("2016-07-13T06:22:33,123456789-0500").utcstamp().total() == 1468408953123456789ll);
+    REQUIRE(UtcTime::Parse("2016-07-13T11:22:33.5+00").utcstamp().total() == 1468408953500000000ll);
+    REQUIRE(UtcTime::Parse("2016-07-13T11:22:33Z").utcstamp().total() == 1468408953000000000ll);
+
+    UtcTime time(Timestamp(0));
+    REQUIRE(UtcTime::TryParse(UtcTime(Timestamp(1468408953123456789ll)).string(), time));
+    REQUIRE(time.utcstamp().total() == 1468408953123456789ll);
+
+    REQUIRE(!UtcTime::TryParse("", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13", time));
+    REQUIRE(!UtcTime::TryParse("2016-02-30T11:22:33Z", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13T24:22:33Z", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13T11:22:3Z", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13T11:22:33.Z", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13T11:22:33+01:", time));
+    REQUIRE(!UtcTime::TryParse("2016-07-13T11:22:33Zjunk", time));
+    REQUIRE(!UtcTime::TryParse("1969-12-31T23:59:59Z", time));
+    REQUIRE_THROWS_AS(UtcTime::Parse("garbage"), ArgumentException);
+}
@@ -42,3 +42,41 @@ TEST_CASE("Timestamp", "[CppCommon][Time]")
     Timestamp timestamp(std::chrono::system_clock::now() + std::chrono::milliseconds(10));
     std::this_thread::sleep_until(timestamp.chrono());
 }
+
+TEST_CASE("Fast timestamp", "[CppCommon][Time]")
+{
+    REQUIRE((Timestamp::fast() > 0));
+    REQUIRE((FastTimestamp().total() > 0));
+
+    // Fast timestamp is monotonic
+    uint64_t prev_fast = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        uint64_t next_fast = Timestamp::fast();
+        REQUIRE(prev_fast <= next_fast);
+        prev_fast = next_fast;
+    }
+
+    // Fast timestamp is close to the high resolution timestamp, even after the drift correction
+    for (int i = 0; i < 3; ++i)
+    {
+        uint64_t nano = Timestamp::nano();
+        uint64_t fast = Timestamp::fast();
+        uint64_t difference = (fast > nano) ? (fast - nano) : (nano - fast);
+        REQUIRE(difference < 1000000);
+        std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    }
+}
+
+TEST_CASE("Fast timestamp after idle periods", "[CppCommon][Time]")
+{
+    // Slew of the calibration error must not turn into the drift when the clock is not used for several calibration periods
+    for (int i = 0; i < 2; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+        uint64_t nano = Timestamp::nano();
+        uint64_t fast = Timestamp::fast();
+        uint64_t difference = (fast > nano) ? (fast - nano) : (nano - fast);
+        REQUIRE(difference < 1000000);
+    }
+}